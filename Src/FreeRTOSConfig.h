@@ -43,33 +43,6 @@
  * See http://www.freertos.org/a00110.html
  *----------------------------------------------------------*/
  
-extern unsigned int xButton_1TimeIn;
-extern unsigned int xButton_1TimeOut;
-extern unsigned int xButton_1TotalTime;
-
-extern unsigned int xButton_2TimeIn;
-extern unsigned int xButton_2TimeOut;
-extern unsigned int xButton_2TotalTime;
-
-extern unsigned int xPeriodic_TransTimeIn;
-extern unsigned int xPeriodic_TransTimeOut;
-extern unsigned int xPeriodic_TransTotalTime;
-
-extern unsigned int xUart_ReceiverTimeIn;
-extern unsigned int xUart_ReceiverTimeOut;
-extern unsigned int xUart_ReceiverTotalTime;
-
-extern unsigned int xLoad_1_SimTimeIn;
-extern unsigned int xLoad_1_SimTimeOut;
-extern unsigned int xLoad_1_SimTotalTime;
-
-extern unsigned int xLoad_2_SimTimeIn;
-extern unsigned int xLoad_2_SimTimeOut;
-extern unsigned int xLoad_2_SimTotalTime;
-
-extern unsigned int SystemTime;
-extern unsigned int CPULoad;
-
 /*****************************************************************/
 #define configUSE_PREEMPTION		1
 #define configUSE_IDLE_HOOK			1
@@ -88,6 +61,7 @@ extern unsigned int CPULoad;
 #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()	
 #define portGET_RUN_TIME_COUNTER_VALUE()					(T1TC)
 #define configUSE_STATS_FORMATTING_FUNCTIONS		1
+#define configSUPPORT_STATIC_ALLOCATION					1									/* Periodic tasks and the idle task in memory allocated at compile time */
 #define configSUPPORT_DYNAMIC_ALLOCATION				1
 #define configUSE_TRACE_FACILITY                1
 
@@ -97,78 +71,85 @@ extern unsigned int CPULoad;
 
 /* Configuration for EDF Scheduler */
 #define configUSE_EDF_SCHEDULER				1  						/* Enable EDF Scheduler */
+#define configUSE_EDF_ADMISSION_CONTROL		1							/* Reject task sets that are not schedulable */
+#define configUSE_EDF_LIMITED_PREEMPTION	1							/* Allow non-preemptive regions and preemption points */
+#define configUSE_EDF_PREEMPTION_THRESHOLD	1							/* Limit preemption of started jobs to tasks above a threshold */
+#define configUSE_EDF_SHARED_STACK			1							/* Run-to-completion jobs share one stack */
+#define configEDF_SHARED_STACK_SIZE			( ( unsigned short ) 400 )	/* Words, holds the deepest chain of preempted jobs */
+#define configUSE_EDF_MIXED_CRITICALITY		0							/* EDF-VD scheduling of HI and LO criticality tasks */
+#define configUSE_EDF_SERVERS				0							/* Budgeted servers for groups of tasks, needs thresholds off */
+#define configUSE_EDF_RECLAIMING			0							/* GRUB reclaiming of unused bandwidth by servers */
+#define configUSE_EDF_SLACK_STEALING		1							/* Run aperiodic jobs in the slack of periodic tasks, needs servers off */
+#define configUSE_EDF_FIRM_DEADLINES		1							/* (m,k)-firm tasks skip optional jobs under overload */
+#define configUSE_EDF_PRECEDENCE			1							/* Producer and consumer chains share an end-to-end deadline */
+extern volatile unsigned long ulCriticalNesting;											/* Of the port, 0 while an interrupt runs */
+#define configEDF_IS_INSIDE_INTERRUPT()		( ulCriticalNesting == 0UL )	/* Tasks only enter the kernel in critical sections, which interrupts cannot preempt */
+#define configUSE_EDF_TIMERS				1							/* Timer service whose callbacks are scheduled by deadline, see edf_timers.h */
+#define configEDF_TIMER_TASK_PERIOD			25							/* Shortest period of the timers, that of Heartbeat */
+#define configEDF_TIMER_TASK_WCET			1							/* The Heartbeat callback and the commands sent in one period */
+#define configEDF_TIMER_TASK_DEADLINE		3							/* Shortest deadline of the timers, that of Heartbeat */
+#define configUSE_EDF_DEFERRED_INTERRUPTS	1							/* Interrupts hand work to tasks with a deadline, see xTaskDeferFromISR() */
+#define configUSE_EDF_JOB_STATISTICS		1							/* Response time and lateness histograms per task, two Histogram_t in each TCB */
+#define configUSE_EDF_SNAPSHOT				1							/* Binary snapshots of the timing state of every task, see uxTaskGetSnapshot() */
+#define configEDF_RUN_TIME_COUNTS_PER_TICK	( configCPU_CLOCK_HZ / ( 1000UL * configTICK_RATE_HZ ) )	/* T1TC counts per tick with T1PR = 1000 */
+
+/* Configuration for queue latency tracking */
+#define configUSE_QUEUE_LATENCY				1							/* Timestamp the items of registered queues, see queue_latency.h */
+#define configQUEUE_LATENCY_MAX_QUEUES		1							/* Number of queues that can be registered */
+#define configQUEUE_LATENCY_MAX_ITEMS		3							/* Length of the longest registered queue */
+
+/* Configuration for the scheduler event trace */
+#define configUSE_EDF_TRACE					1							/* Record scheduler events in a ring buffer, see edf_trace.h */
+#define configEDF_TRACE_BUFFER_LENGTH		256							/* Number of records the ring holds, a power of two */
+#define configUSE_EDF_TRACE_STREAM			1							/* Stream the records to a host over UART1, on the P0.8 and P0.9 tick and idle pins */
+#define configEDF_TRACE_FRAME_RECORDS		16							/* Most records in one frame of the stream */
+#define configEDF_TRACE_MASK_INTERRUPTS()	( ( UBaseType_t ) __disable_irq() )	/* Interrupts do not nest on this port, so it has no portSET_INTERRUPT_MASK_FROM_ISR() */
+#define configEDF_TRACE_UNMASK_INTERRUPTS( x )	do{ if( ( x ) == 0U ){ __enable_irq(); } }while(0)
+
+
+/* Trace Hooks.  The tag of a task is the pin of PORT_0 driven high while it
+ * runs, tasks without a tag are not traced.  The time spent running by every
+ * task is accounted by the kernel, see configGENERATE_RUN_TIME_STATS.  Every
+ * switch, task entering or leaving the ready list, tick and queue operation
+ * is also recorded by the event trace.  A task switched out has left the
+ * ready list unless the kernel still holds it in its ready list, which is
+ * that of its server or the aperiodic ready list for some tasks. */
+extern void vEDFTraceTaskSwitchedIn( unsigned long uxTaskNumber );
+extern void vEDFTraceMovedToReady( unsigned long uxTaskNumber );
+extern void vEDFTraceLeftReady( unsigned long uxTaskNumber );
+extern void vEDFTraceTick( void );
+extern void vEDFTraceQueueSend( unsigned long uxQueueNumber );
+extern void vEDFTraceQueueReceive( unsigned long uxQueueNumber );
 
-
-/* Trace Hooks */
 #define traceTASK_SWITCHED_OUT()			do{	\
-																				if((int)pxCurrentTCB->pxTaskTag == 1){	\
-																					 GPIO_write(PORT_0, PIN2, PIN_IS_LOW);	\
-																					 xButton_1TimeOut = T1TC;\
-																					 xButton_1TotalTime += (xButton_1TimeOut - xButton_1TimeIn);\
-																				}	\
-																				else if((int)pxCurrentTCB->pxTaskTag == 2){ \
-																					GPIO_write(PORT_0, PIN3, PIN_IS_LOW);\
-																					xButton_2TimeOut = T1TC;\
-																					xButton_2TotalTime += (xButton_2TimeOut - xButton_2TimeIn);\
-																				}	\
-																				else if((int)pxCurrentTCB->pxTaskTag == 3){ \
-																					GPIO_write(PORT_0, PIN4, PIN_IS_LOW);\
-																					xPeriodic_TransTimeOut = T1TC;\
-																					xPeriodic_TransTotalTime += (xPeriodic_TransTimeOut - xPeriodic_TransTimeIn);\
+																				if( taskEDF_IS_READY( pxCurrentTCB ) == pdFALSE ){	\
+																					vEDFTraceLeftReady( pxCurrentTCB->uxTCBNumber );	\
 																				}	\
-																				else if((int)pxCurrentTCB->pxTaskTag == 4){ \
-																					GPIO_write(PORT_0, PIN5, PIN_IS_LOW);\
-																					xUart_ReceiverTimeOut = T1TC;\
-																					xUart_ReceiverTotalTime += (xUart_ReceiverTimeOut - xUart_ReceiverTimeIn);\
-																				}	\
-																				else if((int)pxCurrentTCB->pxTaskTag == 5){ \
-																					GPIO_write(PORT_0, PIN6, PIN_IS_LOW);\
-																					xLoad_1_SimTimeOut = T1TC;\
-																					xLoad_1_SimTotalTime += (xLoad_1_SimTimeOut - xLoad_1_SimTimeIn);\
-																				}	\
-																				else if((int)pxCurrentTCB->pxTaskTag == 6){ \
-																					GPIO_write(PORT_0, PIN7, PIN_IS_LOW);\
-																					xLoad_2_SimTimeOut = T1TC;\
-																					xLoad_2_SimTotalTime += (xLoad_2_SimTimeOut - xLoad_2_SimTimeIn);\
-																					SystemTime = T1TC;\
-																				CPULoad = (((xButton_1TotalTime + xButton_2TotalTime + xPeriodic_TransTotalTime \
-																				+ xUart_ReceiverTotalTime + xLoad_1_SimTotalTime + xLoad_2_SimTotalTime) / (float)SystemTime) * 100);\
+																				if( pxCurrentTCB->pxTaskTag != NULL ){	\
+																					GPIO_write(PORT_0, (int)pxCurrentTCB->pxTaskTag, PIN_IS_LOW);	\
 																				}	\
 																			}while(0)
 
-#define traceTASK_SWITCHED_IN()				do{\
-																				if((int)pxCurrentTCB->pxTaskTag == 1){	\
-																					GPIO_write(PORT_0, PIN9, PIN_IS_LOW);\
-																					GPIO_write(PORT_0, PIN2, PIN_IS_HIGH); \
-																					xButton_1TimeIn = T1TC;\
-																				}																				\
-																				else if((int)pxCurrentTCB->pxTaskTag == 2){ \
-																					GPIO_write(PORT_0, PIN9, PIN_IS_LOW);\
-																					GPIO_write(PORT_0, PIN3, PIN_IS_HIGH);\
-																					xButton_2TimeIn = T1TC;\
-																				}	\
-																				else if((int)pxCurrentTCB->pxTaskTag == 3){ \
-																					GPIO_write(PORT_0, PIN9, PIN_IS_LOW);\
-																					GPIO_write(PORT_0, PIN4, PIN_IS_HIGH);\
-																					xPeriodic_TransTimeIn = T1TC;\
-																				}	\
-																				else if((int)pxCurrentTCB->pxTaskTag == 4){ \
-																					GPIO_write(PORT_0, PIN9, PIN_IS_LOW);\
-																					GPIO_write(PORT_0, PIN5, PIN_IS_HIGH);\
-																					xUart_ReceiverTimeIn = T1TC;\
-																				}	\
-																				else if((int)pxCurrentTCB->pxTaskTag == 5){ \
-																					GPIO_write(PORT_0, PIN9, PIN_IS_LOW);\
-																					GPIO_write(PORT_0, PIN6, PIN_IS_HIGH);\
-																					xLoad_1_SimTimeIn = T1TC;\
-																				}	\
-																				else if((int)pxCurrentTCB->pxTaskTag == 6){ \
-																					GPIO_write(PORT_0, PIN9, PIN_IS_LOW);\
-																					GPIO_write(PORT_0, PIN7, PIN_IS_HIGH);\
-																					xLoad_2_SimTimeIn = T1TC;\
+#define traceTASK_SWITCHED_IN()				do{	\
+																				vEDFTraceTaskSwitchedIn( pxCurrentTCB->uxTCBNumber );	\
+																				if( pxCurrentTCB->pxTaskTag != NULL ){	\
+																					GPIO_write(PORT_0, PIN9, PIN_IS_LOW);	\
+																					GPIO_write(PORT_0, (int)pxCurrentTCB->pxTaskTag, PIN_IS_HIGH);	\
 																				}	\
 																			}while(0)
 
+#define traceMOVED_TASK_TO_READY_STATE( pxTCB )		vEDFTraceMovedToReady( ( pxTCB )->uxTCBNumber )
+#define traceTASK_INCREMENT_TICK( xTickCount )		vEDFTraceTick()
+
+/* Queue latency and event trace hooks, called with the queue locked */
+extern void vQueueLatencyTraceSend( void * pvQueue, long lCopyPosition );
+extern void vQueueLatencyTraceReceive( void * pvQueue );
+
+#define traceQUEUE_SEND( pxQueue )						do{ vQueueLatencyTraceSend( ( pxQueue ), ( long ) xCopyPosition ); vEDFTraceQueueSend( ( pxQueue )->uxQueueNumber ); }while(0)
+#define traceQUEUE_SEND_FROM_ISR( pxQueue )				do{ vQueueLatencyTraceSend( ( pxQueue ), ( long ) queueSEND_TO_BACK ); vEDFTraceQueueSend( ( pxQueue )->uxQueueNumber ); }while(0)
+#define traceQUEUE_RECEIVE( pxQueue )					do{ vQueueLatencyTraceReceive( pxQueue ); vEDFTraceQueueReceive( ( pxQueue )->uxQueueNumber ); }while(0)
+#define traceQUEUE_RECEIVE_FROM_ISR( pxQueue )			do{ vQueueLatencyTraceReceive( pxQueue ); vEDFTraceQueueReceive( ( pxQueue )->uxQueueNumber ); }while(0)
+
 /* Task Application Task Tag */
 #define configUSE_APPLICATION_TASK_TAG		1
 
@@ -187,6 +168,7 @@ to exclude the API function. */
 #define INCLUDE_vTaskSuspend			1
 #define INCLUDE_vTaskDelayUntil			1
 #define INCLUDE_vTaskDelay				1
+#define INCLUDE_xTaskGetSchedulerState	1
 
 #define vPortSVCHandler     SVC_Handler
 #define xPortPendSVHandler  PendSV_Handler
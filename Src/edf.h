@@ -0,0 +1,1357 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - EDF scheduler extensions
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Public API of the EDF scheduler extensions implemented in tasks.c.  These
+ * functions are only available when configUSE_EDF_SCHEDULER is set to 1 in
+ * FreeRTOSConfig.h.
+ */
+
+#ifndef INC_EDF_H
+#define INC_EDF_H
+
+#ifndef INC_TASK_H
+    #error "include FreeRTOS.h and task.h must appear in source files before include edf.h"
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/*-----------------------------------------------------------
+* Default values for the EDF configuration options.
+*----------------------------------------------------------*/
+
+/* Set to 1 to reject periodic tasks that would make the task set
+ * unschedulable under EDF.  The task set is checked with the processor demand
+ * analysis of edf_analysis.c, which must then be built with the kernel. */
+#ifndef configUSE_EDF_ADMISSION_CONTROL
+    #define configUSE_EDF_ADMISSION_CONTROL    0
+#endif
+
+/* Largest number of intervals admission control checks before it gives up and
+ * rejects the task set.  Each check walks every periodic task and server with
+ * the scheduler suspended.  A task set with a utilisation close to 1 needs the
+ * most. */
+#ifndef configEDF_ANALYSIS_MAX_STEPS
+    #define configEDF_ANALYSIS_MAX_STEPS    1000
+#endif
+
+/* Set to 1 to allow tasks to defer preemption until they reach a preemption
+ * point or leave a non-preemptive region. */
+#ifndef configUSE_EDF_LIMITED_PREEMPTION
+    #define configUSE_EDF_LIMITED_PREEMPTION    0
+#endif
+
+/* Set to 1 to give each task a preemption threshold that limits which tasks
+ * can preempt it once its job has started. */
+#ifndef configUSE_EDF_PREEMPTION_THRESHOLD
+    #define configUSE_EDF_PREEMPTION_THRESHOLD    0
+#endif
+
+/* Set to 1 to allow periodic tasks whose jobs run to completion to execute on
+ * a single shared stack instead of a stack per task. */
+#ifndef configUSE_EDF_SHARED_STACK
+    #define configUSE_EDF_SHARED_STACK    0
+#endif
+
+/* Size, in words, of the stack shared by run-to-completion jobs.  It must hold
+ * the deepest chain of run-to-completion jobs that can preempt each other. */
+#ifndef configEDF_SHARED_STACK_SIZE
+    #define configEDF_SHARED_STACK_SIZE    ( configMINIMAL_STACK_SIZE * 4 )
+#endif
+
+/* Period of the idle task in ticks.  The idle task reserves no bandwidth, the
+ * period only sets the deadline it is created with.  Once it runs it stays
+ * behind every job that has a deadline. */
+#ifndef configEDF_IDLE_TASK_PERIOD
+    #define configEDF_IDLE_TASK_PERIOD    200
+#endif
+
+/* Set to 1 to schedule HI and LO criticality tasks with EDF with virtual
+ * deadlines (EDF-VD). */
+#ifndef configUSE_EDF_MIXED_CRITICALITY
+    #define configUSE_EDF_MIXED_CRITICALITY    0
+#endif
+
+/* Set to 1 to allow groups of tasks to be scheduled inside servers that
+ * reserve a budget of processor time every server period. */
+#ifndef configUSE_EDF_SERVERS
+    #define configUSE_EDF_SERVERS    0
+#endif
+
+/* Set to 1 to let servers reclaim the bandwidth left unused by periodic jobs
+ * that complete before their WCET. */
+#ifndef configUSE_EDF_RECLAIMING
+    #define configUSE_EDF_RECLAIMING    0
+#endif
+
+/* Set to 1 to run aperiodic jobs in the slack of the periodic tasks instead of
+ * only when the processor would otherwise be idle. */
+#ifndef configUSE_EDF_SLACK_STEALING
+    #define configUSE_EDF_SLACK_STEALING    0
+#endif
+
+/* Set to 1 to let tasks with (m,k)-firm deadlines skip jobs under overload. */
+#ifndef configUSE_EDF_FIRM_DEADLINES
+    #define configUSE_EDF_FIRM_DEADLINES    0
+#endif
+
+/* Set to 1 to let chains of producer and consumer tasks share an end-to-end
+ * deadline. */
+#ifndef configUSE_EDF_PRECEDENCE
+    #define configUSE_EDF_PRECEDENCE    0
+#endif
+
+/* pdTRUE when the kernel is called from an interrupt, which does not run a job
+ * of the task it interrupted and so never releases the next task of a chain.
+ * Ports that cannot tell leave it pdFALSE, in which case only tasks may write
+ * to the queues between the tasks of a chain. */
+#ifndef configEDF_IS_INSIDE_INTERRUPT
+    #define configEDF_IS_INSIDE_INTERRUPT()    pdFALSE
+#endif
+
+/* Set to 1 to let tasks choose the deadline of their jobs, as required by the
+ * EDF timer service in edf_timers.c. */
+#ifndef configUSE_EDF_TIMERS
+    #define configUSE_EDF_TIMERS    0
+#endif
+
+/* Set to 1 to let interrupts hand work to a task together with a deadline by
+ * calling xTaskDeferFromISR(). */
+#ifndef configUSE_EDF_DEFERRED_INTERRUPTS
+    #define configUSE_EDF_DEFERRED_INTERRUPTS    0
+#endif
+
+/* Set to 1 to keep histograms of the response time and lateness of the jobs
+ * of every task, see xTaskGetJobStatistics(). */
+#ifndef configUSE_EDF_JOB_STATISTICS
+    #define configUSE_EDF_JOB_STATISTICS    0
+#endif
+
+/* Set to 1 to provide uxTaskGetSnapshot(), a binary alternative to
+ * uxTaskGetSystemState() and the formatted task lists. */
+#ifndef configUSE_EDF_SNAPSHOT
+    #define configUSE_EDF_SNAPSHOT    0
+#endif
+
+#if ( configUSE_EDF_LIMITED_PREEMPTION == 1 ) && ( configUSE_EDF_SCHEDULER != 1 )
+    #error configUSE_EDF_LIMITED_PREEMPTION requires configUSE_EDF_SCHEDULER to be set to 1
+#endif
+
+#if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 ) && ( configUSE_EDF_SCHEDULER != 1 )
+    #error configUSE_EDF_PREEMPTION_THRESHOLD requires configUSE_EDF_SCHEDULER to be set to 1
+#endif
+
+#if ( configUSE_EDF_MIXED_CRITICALITY == 1 )
+    #if ( configUSE_EDF_SCHEDULER != 1 )
+        #error configUSE_EDF_MIXED_CRITICALITY requires configUSE_EDF_SCHEDULER to be set to 1
+    #endif
+
+    /* Job budgets are measured with the run time stats counter. */
+    #if ( configGENERATE_RUN_TIME_STATS != 1 )
+        #error configUSE_EDF_MIXED_CRITICALITY requires configGENERATE_RUN_TIME_STATS to be set to 1
+    #endif
+
+    #ifndef configEDF_RUN_TIME_COUNTS_PER_TICK
+        #error configEDF_RUN_TIME_COUNTS_PER_TICK must be defined to the number of run time counter increments per tick
+    #endif
+#endif
+
+#if ( configUSE_EDF_SHARED_STACK == 1 )
+    #if ( configUSE_EDF_PREEMPTION_THRESHOLD != 1 )
+        #error configUSE_EDF_SHARED_STACK requires configUSE_EDF_PREEMPTION_THRESHOLD to be set to 1
+    #endif
+
+    #if ( INCLUDE_xTaskDelayUntil != 1 )
+        #error configUSE_EDF_SHARED_STACK requires INCLUDE_xTaskDelayUntil to be set to 1
+    #endif
+
+    #if ( portSTACK_GROWTH > 0 ) || ( portUSING_MPU_WRAPPERS == 1 )
+        #error configUSE_EDF_SHARED_STACK is only supported by ports without an MPU whose stack grows down
+    #endif
+#endif
+
+#if ( configUSE_EDF_SERVERS == 1 )
+    #if ( configUSE_EDF_SCHEDULER != 1 )
+        #error configUSE_EDF_SERVERS requires configUSE_EDF_SCHEDULER to be set to 1
+    #endif
+
+    /* The preemption stack is not aware of the server a task belongs to. */
+    #if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+        #error configUSE_EDF_SERVERS cannot be used with configUSE_EDF_PREEMPTION_THRESHOLD
+    #endif
+#endif
+
+/* The ticks skipped by tickless idle would not replenish or charge the
+ * budgets of servers, and aperiodic jobs are not held in the ready list the
+ * expected idle time is computed from. */
+#if ( configUSE_TICKLESS_IDLE != 0 ) && ( configUSE_EDF_SCHEDULER == 1 )
+    #if ( configUSE_EDF_SERVERS == 1 ) || ( configUSE_EDF_SLACK_STEALING == 1 )
+        #error configUSE_TICKLESS_IDLE cannot be used with configUSE_EDF_SERVERS or configUSE_EDF_SLACK_STEALING
+    #endif
+#endif
+
+#if ( configUSE_EDF_RECLAIMING == 1 )
+    #if ( configUSE_EDF_SERVERS != 1 )
+        #error configUSE_EDF_RECLAIMING requires configUSE_EDF_SERVERS to be set to 1
+    #endif
+
+    /* Job execution times are measured with the run time stats counter. */
+    #if ( configGENERATE_RUN_TIME_STATS != 1 )
+        #error configUSE_EDF_RECLAIMING requires configGENERATE_RUN_TIME_STATS to be set to 1
+    #endif
+
+    #ifndef configEDF_RUN_TIME_COUNTS_PER_TICK
+        #error configEDF_RUN_TIME_COUNTS_PER_TICK must be defined to the number of run time counter increments per tick
+    #endif
+#endif
+
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+    #if ( configUSE_EDF_SCHEDULER != 1 )
+        #error configUSE_EDF_SLACK_STEALING requires configUSE_EDF_SCHEDULER to be set to 1
+    #endif
+
+    /* Servers already give aperiodic work a bounded share of the processor. */
+    #if ( configUSE_EDF_SERVERS == 1 )
+        #error configUSE_EDF_SLACK_STEALING cannot be used with configUSE_EDF_SERVERS
+    #endif
+
+    /* The remaining execution time of each job is measured with the run time
+     * stats counter. */
+    #if ( configGENERATE_RUN_TIME_STATS != 1 )
+        #error configUSE_EDF_SLACK_STEALING requires configGENERATE_RUN_TIME_STATS to be set to 1
+    #endif
+
+    #ifndef configEDF_RUN_TIME_COUNTS_PER_TICK
+        #error configEDF_RUN_TIME_COUNTS_PER_TICK must be defined to the number of run time counter increments per tick
+    #endif
+#endif
+
+#if ( configUSE_EDF_FIRM_DEADLINES == 1 )
+    #if ( configUSE_EDF_SCHEDULER != 1 )
+        #error configUSE_EDF_FIRM_DEADLINES requires configUSE_EDF_SCHEDULER to be set to 1
+    #endif
+
+    /* Only jobs released by xTaskDelayUntil() have a known next release. */
+    #if ( INCLUDE_xTaskDelayUntil != 1 )
+        #error configUSE_EDF_FIRM_DEADLINES requires INCLUDE_xTaskDelayUntil to be set to 1
+    #endif
+
+    /* Overload is detected from the remaining execution time of each job,
+     * measured with the run time stats counter. */
+    #if ( configGENERATE_RUN_TIME_STATS != 1 )
+        #error configUSE_EDF_FIRM_DEADLINES requires configGENERATE_RUN_TIME_STATS to be set to 1
+    #endif
+
+    #ifndef configEDF_RUN_TIME_COUNTS_PER_TICK
+        #error configEDF_RUN_TIME_COUNTS_PER_TICK must be defined to the number of run time counter increments per tick
+    #endif
+#endif
+
+#if ( configUSE_EDF_PRECEDENCE == 1 )
+    #if ( configUSE_EDF_SCHEDULER != 1 )
+        #error configUSE_EDF_PRECEDENCE requires configUSE_EDF_SCHEDULER to be set to 1
+    #endif
+
+    /* The release time of each job is tracked so a successor can inherit it,
+     * which relies on the same run time accounting as the other extensions. */
+    #if ( configGENERATE_RUN_TIME_STATS != 1 )
+        #error configUSE_EDF_PRECEDENCE requires configGENERATE_RUN_TIME_STATS to be set to 1
+    #endif
+
+    #ifndef configEDF_RUN_TIME_COUNTS_PER_TICK
+        #error configEDF_RUN_TIME_COUNTS_PER_TICK must be defined to the number of run time counter increments per tick
+    #endif
+#endif
+
+#if ( configUSE_EDF_TIMERS == 1 ) && ( configUSE_EDF_SCHEDULER != 1 )
+    #error configUSE_EDF_TIMERS requires configUSE_EDF_SCHEDULER to be set to 1
+#endif
+
+#if ( configUSE_EDF_DEFERRED_INTERRUPTS == 1 )
+    #if ( configUSE_EDF_SCHEDULER != 1 )
+        #error configUSE_EDF_DEFERRED_INTERRUPTS requires configUSE_EDF_SCHEDULER to be set to 1
+    #endif
+
+    #if ( configUSE_TASK_NOTIFICATIONS != 1 )
+        #error configUSE_EDF_DEFERRED_INTERRUPTS requires configUSE_TASK_NOTIFICATIONS to be set to 1
+    #endif
+#endif
+
+#if ( configUSE_EDF_JOB_STATISTICS == 1 )
+    #if ( configUSE_EDF_SCHEDULER != 1 )
+        #error configUSE_EDF_JOB_STATISTICS requires configUSE_EDF_SCHEDULER to be set to 1
+    #endif
+
+    /* Jobs are released and completed by xTaskDelayUntil(). */
+    #if ( INCLUDE_xTaskDelayUntil != 1 )
+        #error configUSE_EDF_JOB_STATISTICS requires INCLUDE_xTaskDelayUntil to be set to 1
+    #endif
+
+    /* Completion times are measured between ticks with the run time stats
+     * counter. */
+    #if ( configGENERATE_RUN_TIME_STATS != 1 )
+        #error configUSE_EDF_JOB_STATISTICS requires configGENERATE_RUN_TIME_STATS to be set to 1
+    #endif
+
+    #ifndef configEDF_RUN_TIME_COUNTS_PER_TICK
+        #error configEDF_RUN_TIME_COUNTS_PER_TICK must be defined to the number of run time counter increments per tick
+    #endif
+
+    #include "histogram.h"
+#endif
+
+#if ( configUSE_EDF_SNAPSHOT == 1 )
+    #if ( configUSE_EDF_SCHEDULER != 1 )
+        #error configUSE_EDF_SNAPSHOT requires configUSE_EDF_SCHEDULER to be set to 1
+    #endif
+
+    /* Tasks are identified by their task number, and their state is read
+     * with eTaskGetState(). */
+    #if ( configUSE_TRACE_FACILITY != 1 )
+        #error configUSE_EDF_SNAPSHOT requires configUSE_TRACE_FACILITY to be set to 1
+    #endif
+
+    /* Misses are counted when xTaskDelayUntil() completes a job. */
+    #if ( INCLUDE_xTaskDelayUntil != 1 )
+        #error configUSE_EDF_SNAPSHOT requires INCLUDE_xTaskDelayUntil to be set to 1
+    #endif
+#endif
+
+/* Called with interrupts masked when the system switches criticality mode. */
+#ifndef traceEDF_CRITICALITY_MODE_SWITCH
+    #define traceEDF_CRITICALITY_MODE_SWITCH( eNewMode )
+#endif
+
+/* Called from the tick interrupt when the job of a task is skipped. */
+#ifndef traceEDF_JOB_SKIPPED
+    #define traceEDF_JOB_SKIPPED( pxTCB )
+#endif
+
+/* Returned by the periodic task creation functions when admitting the task
+ * would make the task set unschedulable. */
+#define errTASK_SET_NOT_SCHEDULABLE    ( -6 )
+
+/* The ulMagic member of every SystemSnapshot_t, which reads "EDFS" in the
+ * memory of a little endian processor. */
+#define taskSNAPSHOT_MAGIC          ( ( uint32_t ) 0x53464445UL )
+
+/* The ulState member of a TaskSnapshot_t holds the eTaskState of the task in
+ * its low byte, and taskSNAPSHOT_CHANGED if the record differs from the one
+ * the array held before the snapshot. */
+#define taskSNAPSHOT_STATE_MASK     ( ( uint32_t ) 0x000000FFUL )
+#define taskSNAPSHOT_CHANGED        ( ( uint32_t ) 0x00000100UL )
+
+/*-----------------------------------------------------------
+* TYPES
+*----------------------------------------------------------*/
+
+/* Criticality level of a task, and criticality mode of the system. */
+typedef enum
+{
+    eCriticalityLow = 0, /* Best effort.  Only guaranteed to meet deadlines in LO mode. */
+    eCriticalityHigh     /* Safety relevant.  Guaranteed to meet deadlines in both modes. */
+} eTaskCriticality;
+
+/*
+ * Parameters used to create a periodic task with
+ * xTaskPeriodicCreateFromParameters().  Members that are not used by the
+ * application should be left at zero.
+ */
+typedef struct xPERIODIC_TASK_PARAMETERS
+{
+    TaskFunction_t pvTaskCode;
+    const char * pcName;            /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+    configSTACK_DEPTH_TYPE usStackDepth;
+    void * pvParameters;
+    UBaseType_t uxPriority;
+    TickType_t xPeriod;             /*< Period of the task in ticks. */
+    TickType_t xWcet;               /*< Worst case execution time of one job in ticks.  0 if unknown, in which case the task is not accounted for by admission control. */
+    TickType_t xMaxNonPreemptive;   /*< Longest time in ticks the task runs without a preemption point or inside a non-preemptive region. */
+    BaseType_t xUsePreemptionPoints; /*< pdTRUE if jobs are only preemptable at vTaskPreemptionPoint() or when the task blocks. */
+    TickType_t xPreemptionThreshold; /*< Once a job has started only tasks with a period below this value can preempt it.  0 to use the period, which is plain EDF. */
+    BaseType_t xRunToCompletion;     /*< pdTRUE if pvTaskCode executes a single job and returns.  The job runs on the shared stack and must not block. */
+    eTaskCriticality eCriticality;   /*< Criticality of the task.  xWcet is its LO mode WCET. */
+    TickType_t xWcetHigh;            /*< HI mode WCET of a eCriticalityHigh task in ticks, at least xWcet. */
+    BaseType_t xAperiodic;           /*< pdTRUE if the task runs aperiodic jobs in the slack of the periodic tasks.  xWcet must be 0. */
+    UBaseType_t uxFirmMandatory;     /*< m of the (m,k)-firm constraint - at least m of any k consecutive jobs must meet their deadline. */
+    UBaseType_t uxFirmWindow;        /*< k of the (m,k)-firm constraint, at most 32.  0 if every job must meet its deadline. */
+    TickType_t xDeadline;            /*< Relative deadline of every job in ticks, at most xPeriod.  0 to use the period. */
+} PeriodicTaskParameters_t;
+
+/* Handle by which servers are referenced. */
+struct xEDF_SERVER;
+typedef struct xEDF_SERVER * ServerHandle_t;
+
+/* Order in which a server runs the tasks attached to it. */
+typedef enum
+{
+    eServerPolicyEDF = 0, /* Earliest absolute deadline first. */
+    eServerPolicyFIFO     /* In the order the tasks became ready. */
+} eServerPolicy;
+
+/* Used with the uxTaskGetServerState() function to return the state of each
+ * server in the system. */
+typedef struct xSERVER_STATUS
+{
+    ServerHandle_t xHandle;           /* The handle of the server. */
+    const char * pcServerName;        /* The name passed to xTaskCreateServer(). */ /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+    eServerPolicy ePolicy;            /* The order in which the server runs its tasks. */
+    TickType_t xBudget;               /* Ticks of processor time reserved every period. */
+    TickType_t xPeriod;               /* The server period in ticks. */
+    TickType_t xRemainingBudget;      /* Ticks of budget left in the current period. */
+    TickType_t xDeadline;             /* The tick at which the current period ends. */
+    UBaseType_t uxReadyTasks;         /* The number of attached tasks in the Ready state. */
+    uint32_t ulBudgetExhaustedCount;  /* The number of periods in which the budget ran out. */
+    uint32_t ulReclaimedTicks;        /* Ticks the tasks of the server ran on reclaimed bandwidth.  0 unless configUSE_EDF_RECLAIMING is 1. */
+} ServerStatus_t;
+
+/* Used with the vTaskGetAperiodicStats() function to return the response times
+ * of aperiodic jobs, measured from the time the task became ready until it
+ * blocked again. */
+typedef struct xAPERIODIC_STATS
+{
+    uint32_t ulCompletedJobs;         /* The number of aperiodic jobs that completed. */
+    uint32_t ulTotalResponseTime;     /* Sum of the response times of the completed jobs in ticks. */
+    TickType_t xMaxResponseTime;      /* The longest response time in ticks. */
+    uint32_t ulSlackStolenTicks;      /* Ticks aperiodic jobs ran while a periodic job was ready. */
+} AperiodicStats_t;
+
+/* Used with the xTaskGetFirmStatus() function to return the deadline history
+ * of a task.  Bit 0 of each history holds the most recent job. */
+typedef struct xFIRM_STATUS
+{
+    UBaseType_t uxMandatory;          /* m of the (m,k)-firm constraint of the task. */
+    UBaseType_t uxWindow;             /* k of the (m,k)-firm constraint of the task, 0 if every job is mandatory. */
+    uint32_t ulHistory;               /* Set bits are jobs that met their deadline, clear bits jobs that missed it or were skipped. */
+    uint32_t ulSkipHistory;           /* Set bits are jobs that were skipped. */
+    uint32_t ulMetJobs;               /* The number of jobs that met their deadline. */
+    uint32_t ulMissedJobs;            /* The number of jobs that completed after their deadline. */
+    uint32_t ulSkippedJobs;           /* The number of jobs that were skipped. */
+    uint32_t ulViolations;            /* The number of jobs after which fewer than m of the last k jobs met their deadline. */
+} FirmStatus_t;
+
+/* Used with the xTaskGetJobStatistics() function to return the distribution of
+ * the response times and lateness of the jobs of a task, in run time counter
+ * increments.  Lateness is negative for jobs that completed before their
+ * deadline. */
+#if ( configUSE_EDF_JOB_STATISTICS == 1 )
+    typedef struct xJOB_STATISTICS
+    {
+        HistogramSummary_t xResponseTime; /* From the release of each job until it completed. */
+        HistogramSummary_t xTardiness;    /* Lateness of the jobs that missed their deadline, 0 for the jobs that met it. */
+        uint32_t ulMissedDeadlines;       /* The number of jobs that completed after their deadline. */
+        int32_t lMinLateness;             /* The lateness of the earliest job relative to its deadline. */
+        int32_t lMaxLateness;             /* The lateness of the latest job relative to its deadline. */
+        int32_t lMeanLateness;            /* The mean lateness, rounded towards zero. */
+    } JobStatistics_t;
+#endif
+
+/* Filled in by uxTaskGetSnapshot().  Every member is a 32-bit word, so a host
+ * can decode the structure from a memory dump without knowing the padding
+ * rules of the compiler. */
+typedef struct xSYSTEM_SNAPSHOT
+{
+    uint32_t ulMagic;                 /* Always taskSNAPSHOT_MAGIC. */
+    uint32_t ulSequence;              /* Incremented by every snapshot taken into the structure. */
+    uint32_t ulTickCount;             /* The tick count when the snapshot was taken. */
+    uint32_t ulRunTime;               /* The run time counter value when the snapshot was taken, 0 if run time stats are not generated. */
+    uint32_t ulTasks;                 /* The number of TaskSnapshot_t records filled in. */
+    uint32_t ulChangedTasks;          /* The number of records marked taskSNAPSHOT_CHANGED. */
+} SystemSnapshot_t;
+
+/* One record per task in the array passed to uxTaskGetSnapshot(). */
+typedef struct xTASK_SNAPSHOT
+{
+    uint32_t ulTaskNumber;            /* The number the kernel gave the task when it was created, as in the xTaskNumber member of TaskStatus_t. */
+    uint32_t ulState;                 /* The eTaskState of the task, with taskSNAPSHOT_CHANGED if the record changed. */
+    uint32_t ulPeriod;                /* The period of the task in ticks. */
+    uint32_t ulDeadline;              /* The absolute deadline of the job of a ready or running task, otherwise 0. */
+    uint32_t ulWakeTime;              /* The tick count a blocked task waits for, 0 if it waits without a timeout or is not blocked. */
+    uint32_t ulRunTime;               /* The run time counter time spent running by the task, 0 if run time stats are not generated. */
+    uint32_t ulMissedDeadlines;       /* The number of jobs that completed after their deadline. */
+} TaskSnapshot_t;
+
+/*
+ * The memory of a periodic task created with xTaskPeriodicCreateStatic().  The
+ * TCB of a periodic task holds EDF members that do not fit in a StaticTask_t,
+ * so this structure reserves space for them after one.  Its contents are
+ * private to the kernel - it only exists so the application can allocate the
+ * memory at compile time.
+ */
+typedef struct xSTATIC_PERIODIC_TCB
+{
+    StaticTask_t xDummy1;
+    TickType_t xDummy2[ 3 ];
+    void * pvDummy3;
+    #if ( configUSE_EDF_LIMITED_PREEMPTION == 1 )
+        TickType_t xDummy4;
+        UBaseType_t uxDummy5;
+    #endif
+    #if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+        TickType_t xDummy6;
+        void * pvDummy7;
+        BaseType_t xDummy8;
+    #endif
+    #if ( configUSE_EDF_SHARED_STACK == 1 )
+        TaskFunction_t pxDummy9;
+        void * pvDummy10;
+        TickType_t xDummy11;
+    #endif
+    #if ( configUSE_EDF_MIXED_CRITICALITY == 1 )
+        eTaskCriticality eDummy12;
+        TickType_t xDummy13;
+    #endif
+    #if ( ( configUSE_EDF_MIXED_CRITICALITY == 1 ) || ( configUSE_EDF_RECLAIMING == 1 ) || ( configUSE_EDF_SLACK_STEALING == 1 ) || ( configUSE_EDF_FIRM_DEADLINES == 1 ) || ( configUSE_EDF_PRECEDENCE == 1 ) )
+        TickType_t xDummy14;
+        configRUN_TIME_COUNTER_TYPE ulDummy15;
+    #endif
+    #if ( configUSE_EDF_RECLAIMING == 1 )
+        UBaseType_t uxDummy16;
+        TickType_t xDummy17;
+    #endif
+    #if ( configUSE_EDF_SERVERS == 1 )
+        void * pvDummy18;
+    #endif
+    #if ( configUSE_EDF_SLACK_STEALING == 1 )
+        BaseType_t xDummy19[ 2 ];
+        TickType_t xDummy20;
+    #endif
+    #if ( configUSE_EDF_FIRM_DEADLINES == 1 )
+        UBaseType_t uxDummy21[ 2 ];
+        uint32_t ulDummy22[ 6 ];
+        void * pvDummy23;
+    #endif
+    #if ( configUSE_EDF_PRECEDENCE == 1 )
+        void * pvDummy24;
+        TickType_t xDummy25[ 3 ];
+        const void * pvDummy26;
+    #endif
+    #if ( configUSE_EDF_TIMERS == 1 )
+        TickType_t xDummy27;
+    #endif
+    #if ( configUSE_EDF_DEFERRED_INTERRUPTS == 1 )
+        TickType_t xDummy28[ 2 ];
+    #endif
+    #if ( configUSE_EDF_JOB_STATISTICS == 1 )
+        Histogram_t xDummy29[ 2 ];
+        int32_t lDummy30[ 2 ];
+        int64_t llDummy31;
+    #endif
+    #if ( configUSE_EDF_SNAPSHOT == 1 )
+        uint32_t ulDummy32;
+    #endif
+} StaticPeriodicTask_t;
+
+/*-----------------------------------------------------------
+* TASK CREATION API
+*----------------------------------------------------------*/
+
+/**
+ * edf. h
+ * <pre>
+ * BaseType_t xTaskPeriodicCreateFromParameters( const PeriodicTaskParameters_t * const pxTaskDefinition, TaskHandle_t * const pxCreatedTask );
+ * </pre>
+ *
+ * Create a periodic task using the timing parameters held in
+ * pxTaskDefinition.  Unlike xTaskPeriodicCreate() the worst case execution
+ * time of the task is known, so when configUSE_EDF_ADMISSION_CONTROL is 1 the
+ * task is only created if the resulting task set, including any blocking
+ * introduced by non-preemptive execution, remains schedulable.  The task set
+ * is checked with eEDFAnalysisQPATest(), the test Tools/edf_analyze.c runs
+ * offline.
+ *
+ * @return pdPASS if the task was created, errTASK_SET_NOT_SCHEDULABLE if the
+ * task was rejected by admission control, or
+ * errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY.
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    BaseType_t xTaskPeriodicCreateFromParameters( const PeriodicTaskParameters_t * const pxTaskDefinition,
+                                                  TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * edf. h
+ * <pre>
+ * BaseType_t xTaskPeriodicCreateStatic( const PeriodicTaskParameters_t * const pxTaskDefinition,
+ *                                       StackType_t * const puxStackBuffer,
+ *                                       StaticPeriodicTask_t * const pxTaskBuffer,
+ *                                       TaskHandle_t * const pxCreatedTask );
+ * </pre>
+ *
+ * Create a periodic task as xTaskPeriodicCreateFromParameters() does, but
+ * using memory provided by the application instead of the FreeRTOS heap.
+ * puxStackBuffer must hold pxTaskDefinition->usStackDepth words and can be
+ * NULL for a run-to-completion task, which uses the shared stack.
+ * pxTaskBuffer holds the TCB.
+ *
+ * @return pdPASS if the task was created, errTASK_SET_NOT_SCHEDULABLE if the
+ * task was rejected by admission control, or
+ * errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY if a buffer is NULL.
+ *
+ * Example usage:
+ * <pre>
+ * static StackType_t uxStack[ 120 ];
+ * static StaticPeriodicTask_t xTCB;
+ *
+ * void vCreateTask( void )
+ * {
+ * PeriodicTaskParameters_t xDefinition = { 0 };
+ *
+ *  xDefinition.pvTaskCode = vTaskCode;
+ *  xDefinition.pcName = "Task";
+ *  xDefinition.usStackDepth = 120;
+ *  xDefinition.uxPriority = 1;
+ *  xDefinition.xPeriod = 50;
+ *  xDefinition.xWcet = 2;
+ *  xTaskPeriodicCreateStatic( &xDefinition, uxStack, &xTCB, NULL );
+ * }
+ * </pre>
+ */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    BaseType_t xTaskPeriodicCreateStatic( const PeriodicTaskParameters_t * const pxTaskDefinition,
+                                          StackType_t * const puxStackBuffer,
+                                          StaticPeriodicTask_t * const pxTaskBuffer,
+                                          TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * edf. h
+ * <pre>
+ * void vApplicationGetPeriodicIdleTaskMemory( StaticPeriodicTask_t ** ppxIdleTaskTCBBuffer,
+ *                                             StackType_t ** ppxIdleTaskStackBuffer,
+ *                                             uint32_t * pulIdleTaskStackSize );
+ * </pre>
+ *
+ * Must be provided by the application when configSUPPORT_STATIC_ALLOCATION is
+ * 1.  It takes the place of vApplicationGetIdleTaskMemory(), as the idle task
+ * is a periodic task whose TCB does not fit in a StaticTask_t.
+ */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    void vApplicationGetPeriodicIdleTaskMemory( StaticPeriodicTask_t ** ppxIdleTaskTCBBuffer,
+                                                StackType_t ** ppxIdleTaskStackBuffer,
+                                                uint32_t * pulIdleTaskStackSize );
+#endif
+
+/*-----------------------------------------------------------
+* LIMITED PREEMPTION API
+*----------------------------------------------------------*/
+
+/**
+ * edf. h
+ * <pre>
+ * void vTaskEnterNonPreemptiveRegion( void );
+ * void vTaskExitNonPreemptiveRegion( void );
+ * </pre>
+ *
+ * Mark the start and end of a region in which the calling task cannot be
+ * preempted by a task with an earlier deadline.  Unlike a critical section
+ * interrupts remain enabled, so the tick keeps running and releases jobs - a
+ * preemption that becomes due inside the region is deferred until the
+ * outermost vTaskExitNonPreemptiveRegion() call.  Regions can be nested.
+ *
+ * The length of the longest region must be declared in the xMaxNonPreemptive
+ * member of the task's PeriodicTaskParameters_t for admission control to
+ * account for the blocking it causes.
+ */
+#if ( configUSE_EDF_LIMITED_PREEMPTION == 1 )
+    void vTaskEnterNonPreemptiveRegion( void ) PRIVILEGED_FUNCTION;
+    void vTaskExitNonPreemptiveRegion( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * edf. h
+ * <pre>
+ * void vTaskPreemptionPoint( void );
+ * </pre>
+ *
+ * Explicit preemption point.  A task created with xUsePreemptionPoints set to
+ * pdTRUE runs non-preemptively between calls to vTaskPreemptionPoint().  If a
+ * task with an earlier deadline was released since the last preemption point
+ * the calling task yields to it here, otherwise the call returns immediately.
+ */
+#if ( configUSE_EDF_LIMITED_PREEMPTION == 1 )
+    void vTaskPreemptionPoint( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/*-----------------------------------------------------------
+* PREEMPTION THRESHOLDS
+*----------------------------------------------------------*/
+
+/*
+ * When configUSE_EDF_PREEMPTION_THRESHOLD is 1 the preemption level of a task
+ * is given by its period - the shorter the period the higher the level.  A
+ * released job preempts the running job only if its absolute deadline is
+ * earlier and its period is below the xPreemptionThreshold of every job that
+ * has started but not yet completed.  A job is considered complete when the
+ * task leaves the Ready state, so tasks using thresholds should only block at
+ * the end of a job.
+ *
+ * Raising a task's threshold (setting it to a smaller value) reduces the number
+ * of preemptions, and so context switches, at the cost of extra blocking that
+ * admission control accounts for.  Tasks whose thresholds prevent them from
+ * preempting each other are never started at the same time, so at most one of
+ * them needs a stack at any time.
+ */
+
+/*-----------------------------------------------------------
+* RUN-TO-COMPLETION TASKS
+*----------------------------------------------------------*/
+
+/*
+ * When configUSE_EDF_SHARED_STACK is 1 a periodic task can be created with
+ * xRunToCompletion set to pdTRUE.  No stack is allocated for such a task.
+ * Instead its pvTaskCode is called once per period, executes one job on the
+ * stack shared by all run-to-completion tasks, and returns.  A job must not
+ * block, and the task must not be suspended or deleted while its job is
+ * preempted.  Preemption thresholds guarantee a job that is preempted only
+ * resumes once every job that preempted it has completed, so the jobs use
+ * the shared stack in strict last in first out order.
+ *
+ * Run-to-completion tasks must be created before the scheduler is started.
+ *
+ * Example usage:
+ * <pre>
+ * void vSampleJob( void * pvParameters )
+ * {
+ *  // Executes one job then returns.  Called again at the next release.
+ *  vSampleInputs();
+ * }
+ *
+ * void vCreate( void )
+ * {
+ * PeriodicTaskParameters_t xDefinition = { 0 };
+ *
+ *  xDefinition.pvTaskCode = vSampleJob;
+ *  xDefinition.pcName = "Sample";
+ *  xDefinition.xPeriod = 20;
+ *  xDefinition.xWcet = 1;
+ *  xDefinition.xRunToCompletion = pdTRUE;
+ *  xTaskPeriodicCreateFromParameters( &xDefinition, NULL );
+ * }
+ * </pre>
+ */
+
+/*-----------------------------------------------------------
+* MIXED CRITICALITY API
+*----------------------------------------------------------*/
+
+/**
+ * edf. h
+ * <pre>
+ * BaseType_t xTaskCheckVirtualDeadlineScaling( const PeriodicTaskParameters_t * const pxTaskDefinitions, UBaseType_t uxNumberOfTasks, uint32_t * const pulScale );
+ * </pre>
+ *
+ * Offline EDF-VD schedulability test of the uxNumberOfTasks tasks described by
+ * the array pxTaskDefinitions.  The task set is schedulable if
+ * U_LO(LO) + min( U_HI(HI), U_HI(LO) / ( 1 - U_HI(HI) ) ) <= 1, where U_X(Y) is
+ * the utilisation of the X criticality tasks at their Y mode WCET.  A task
+ * with a deadline shorter than its period is accounted for at its density,
+ * WCET / deadline, instead.  The kernel applies the same test when admission
+ * control is enabled.  The function does
+ * not access kernel state so can be called before the scheduler is started.
+ *
+ * @param pulScale If not NULL, set to the factor x, in units of 1 / 10000, by
+ * which the relative deadlines of HI criticality tasks are scaled in LO mode.
+ *
+ * @return pdPASS if the task set is schedulable, otherwise pdFAIL.
+ */
+#if ( configUSE_EDF_MIXED_CRITICALITY == 1 )
+    BaseType_t xTaskCheckVirtualDeadlineScaling( const PeriodicTaskParameters_t * const pxTaskDefinitions,
+                                                 UBaseType_t uxNumberOfTasks,
+                                                 uint32_t * const pulScale ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * edf. h
+ * <pre>
+ * eTaskCriticality eTaskGetCriticalityMode( void );
+ * </pre>
+ *
+ * The system starts in LO criticality mode.  It switches to HI mode when a HI
+ * criticality job executes for longer than its LO mode WCET, as measured with
+ * the run time stats counter.  In HI mode HI criticality tasks use their real
+ * deadlines, and LO criticality tasks only run when no HI criticality job is
+ * ready.  The system returns to LO mode when the idle task is next selected.
+ *
+ * @return The current criticality mode.
+ */
+#if ( configUSE_EDF_MIXED_CRITICALITY == 1 )
+    eTaskCriticality eTaskGetCriticalityMode( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/*-----------------------------------------------------------
+* SERVER API
+*----------------------------------------------------------*/
+
+/*
+ * When configUSE_EDF_SERVERS is 1 tasks can be grouped into servers.  The
+ * scheduler runs EDF over the tasks that are not attached to a server and the
+ * servers themselves, using the end of the current server period as the
+ * deadline of a server.  When a server is selected it runs one of its Ready
+ * tasks in the order given by its policy.  Every tick in which a task attached
+ * to a server runs is charged to the server's budget.  Once the budget is
+ * exhausted none of the server's tasks run until the budget is replenished at
+ * the end of the server period, so a misbehaving subsystem cannot steal
+ * processor time from the rest of the system.
+ *
+ * Servers follow the rules of the constant bandwidth server (CBS).  Budget that
+ * is not used while the server has no Ready task is kept, but when a task of
+ * an idle server becomes ready and the remaining budget could not be consumed
+ * at the rate xBudget / xPeriod by the end of the current period, the budget
+ * is replenished and a new period starts.  A server therefore never demands
+ * more processor time than a periodic task with a WCET of xBudget and a period
+ * of xPeriod.
+ */
+
+/**
+ * edf. h
+ * <pre>
+ * ServerHandle_t xTaskCreateServer( const char * const pcName, TickType_t xBudget, TickType_t xPeriod, eServerPolicy ePolicy );
+ * </pre>
+ *
+ * Create a server that reserves xBudget ticks of processor time every xPeriod
+ * ticks.  When configUSE_EDF_ADMISSION_CONTROL is 1 the server is only created
+ * if a task with its budget and period is schedulable next to the periodic
+ * tasks that are not attached to a server and the existing servers.  Servers
+ * cannot be deleted.
+ *
+ * @return A handle to the server, or NULL if the server could not be
+ * allocated or was rejected by admission control.
+ */
+#if ( configUSE_EDF_SERVERS == 1 )
+    ServerHandle_t xTaskCreateServer( const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                      TickType_t xBudget,
+                                      TickType_t xPeriod,
+                                      eServerPolicy ePolicy ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * edf. h
+ * <pre>
+ * BaseType_t xTaskAttachToServer( TaskHandle_t xTask, ServerHandle_t xServer );
+ * </pre>
+ *
+ * Attach the task xTask to the server xServer, or detach it from its server if
+ * xServer is NULL.  A task attached to a server is scheduled inside the
+ * server's reservation.  Its WCET is not accounted for by admission control
+ * individually - the server budget must cover the tasks attached to it.
+ *
+ * @return pdPASS.
+ */
+#if ( configUSE_EDF_SERVERS == 1 )
+    BaseType_t xTaskAttachToServer( TaskHandle_t xTask,
+                                    ServerHandle_t xServer ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * edf. h
+ * <pre>
+ * UBaseType_t uxTaskGetServerState( ServerStatus_t * const pxServerStatusArray, const UBaseType_t uxArraySize );
+ * </pre>
+ *
+ * Populate a ServerStatus_t structure for each server in the system, up to
+ * uxArraySize servers.
+ *
+ * @return The number of ServerStatus_t structures that were populated.
+ */
+#if ( configUSE_EDF_SERVERS == 1 ) && ( configUSE_TRACE_FACILITY == 1 )
+    UBaseType_t uxTaskGetServerState( ServerStatus_t * const pxServerStatusArray,
+                                      const UBaseType_t uxArraySize ) PRIVILEGED_FUNCTION;
+#endif
+
+/*-----------------------------------------------------------
+* BANDWIDTH RECLAIMING
+*----------------------------------------------------------*/
+
+/*
+ * When configUSE_EDF_RECLAIMING is 1 servers reclaim the bandwidth that
+ * periodic tasks reserve but do not use, following the GRUB algorithm.  A
+ * periodic task that is not attached to a server is active from the release of
+ * a job until the job's 0-lag time - the time the job would have completed had
+ * it executed at exactly its reserved rate of WCET / period.  A server is
+ * active while it has a ready task, and after that until the 0-lag time of
+ * its unused budget, from which the CBS wake-up rule gives it a new deadline
+ * and budget should one of its tasks become ready.  The budget of the running
+ * server is depleted at the rate of the active utilisation, the sum of the
+ * utilisations of the active tasks and servers, rather than one tick per
+ * tick.  Soft tasks attached to servers therefore run on the bandwidth
+ * released by jobs that complete early, while every active task keeps its
+ * reserved bandwidth so no hard deadline is missed.
+ *
+ * Tasks whose xWcet is 0 reserve no bandwidth and are ignored.  A job is
+ * considered complete when its task blocks.
+ */
+
+/**
+ * edf. h
+ * <pre>
+ * uint32_t ulTaskGetActiveUtilisation( void );
+ * </pre>
+ *
+ * @return The active utilisation, in units of 1 / 10000, at the rate of which
+ * the budget of the running server is depleted.
+ */
+#if ( configUSE_EDF_RECLAIMING == 1 )
+    uint32_t ulTaskGetActiveUtilisation( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/*-----------------------------------------------------------
+* SLACK STEALING
+*----------------------------------------------------------*/
+
+/*
+ * When configUSE_EDF_SLACK_STEALING is 1 aperiodic tasks, created with
+ * xTaskAperiodicCreate(), do not have to wait for the processor to become idle.
+ * Whenever a periodic job is released or completes the scheduler computes the
+ * slack - how long every ready and future periodic job can be postponed without
+ * any of them missing its deadline - and runs aperiodic jobs first until the
+ * slack is used up.  The slack is a lower bound obtained from the processor
+ * demand of the periodic tasks at the next two deadlines of each task, so the
+ * computation takes a bounded time proportional to the square of the number of
+ * periodic tasks.  Between recomputations the tick interrupt charges every tick
+ * not spent on a periodic job to the slack.
+ *
+ * An aperiodic job is released when its task becomes ready and completes when
+ * the task blocks.  Aperiodic jobs run in the order they were released.  Only
+ * tasks with a known WCET are protected, and a periodic job is considered
+ * complete when its task blocks, so periodic tasks must only block at the end
+ * of each job.
+ */
+
+/**
+ * edf. h
+ * <pre>
+ * BaseType_t xTaskAperiodicCreate( TaskFunction_t pxTaskCode,
+ *                                  const char * const pcName,
+ *                                  const configSTACK_DEPTH_TYPE usStackDepth,
+ *                                  void * const pvParameters,
+ *                                  UBaseType_t uxPriority,
+ *                                  TaskHandle_t * const pxCreatedTask );
+ * </pre>
+ *
+ * Create an aperiodic task.  Each time the task is unblocked, for example by a
+ * task notification, it executes one job in the slack of the periodic tasks.
+ *
+ * @return pdPASS if the task was successfully created and added to a ready
+ * list, otherwise an error code defined in the file projdefs.h
+ */
+#if ( configUSE_EDF_SLACK_STEALING == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    BaseType_t xTaskAperiodicCreate( TaskFunction_t pxTaskCode,
+                                     const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                     const configSTACK_DEPTH_TYPE usStackDepth,
+                                     void * const pvParameters,
+                                     UBaseType_t uxPriority,
+                                     TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * edf. h
+ * <pre>
+ * void vTaskSetSlackStealing( BaseType_t xEnable );
+ * </pre>
+ *
+ * Enable or disable slack stealing.  While disabled aperiodic jobs only run
+ * when no periodic job is ready.  Slack stealing is enabled when the scheduler
+ * starts.
+ */
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+    void vTaskSetSlackStealing( BaseType_t xEnable ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * edf. h
+ * <pre>
+ * void vTaskGetAperiodicStats( AperiodicStats_t * const pxStats, BaseType_t xReset );
+ * </pre>
+ *
+ * Copy the response time statistics of the aperiodic jobs into pxStats, and
+ * clear them if xReset is pdTRUE.
+ */
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+    void vTaskGetAperiodicStats( AperiodicStats_t * const pxStats,
+                                 BaseType_t xReset ) PRIVILEGED_FUNCTION;
+#endif
+
+/*-----------------------------------------------------------
+* (M,K)-FIRM DEADLINES
+*----------------------------------------------------------*/
+
+/*
+ * When configUSE_EDF_FIRM_DEADLINES is 1 a task can be given an (m,k)-firm
+ * constraint with the uxFirmMandatory and uxFirmWindow members of
+ * PeriodicTaskParameters_t - at least m of any k consecutive jobs must meet
+ * their deadline, so k - m of them can be lost.  A job is mandatory if losing
+ * it would leave fewer than m jobs that met their deadline among the last k,
+ * and optional otherwise.
+ *
+ * When an optional job is released by xTaskDelayUntil() and adding it to the
+ * ready jobs would make any of them miss its deadline, the job is skipped
+ * before it runs: the task stays blocked until its next release and the wake
+ * time passed to xTaskDelayUntil() is advanced by one period.  Mandatory jobs
+ * and jobs of tasks without a constraint are never skipped.  Tasks without a
+ * constraint gain from the skips of the others, which is what stops a
+ * transient overload from spreading to every task.
+ *
+ * A job completes when its task calls xTaskDelayUntil(), and met its deadline
+ * if that is no later than the release of the next job.  The outcome of every
+ * job of every task is recorded, whether or not the task has a constraint.
+ */
+
+/**
+ * edf. h
+ * <pre>
+ * BaseType_t xTaskGetFirmStatus( TaskHandle_t xTask, FirmStatus_t * const pxFirmStatus );
+ * </pre>
+ *
+ * Populate a FirmStatus_t structure with the deadline history of xTask.
+ * Passing a NULL handle returns the history of the calling task.
+ *
+ * @return pdPASS.
+ */
+#if ( configUSE_EDF_FIRM_DEADLINES == 1 )
+    BaseType_t xTaskGetFirmStatus( TaskHandle_t xTask,
+                                   FirmStatus_t * const pxFirmStatus ) PRIVILEGED_FUNCTION;
+#endif
+
+/*-----------------------------------------------------------
+* PRECEDENCE CONSTRAINTS
+*----------------------------------------------------------*/
+
+/*
+ * When configUSE_EDF_PRECEDENCE is 1 a task can be declared the successor of
+ * one or more predecessor tasks, for example a consumer that processes the
+ * data its producers send through a queue.  Each edge carries an end-to-end
+ * deadline, measured from the release of the job of the predecessor, within
+ * which the successor must have completed the resulting job.
+ *
+ * The deadlines are adjusted as described by Chetto, Silly and Bouchentouf:
+ * the relative deadline of a predecessor becomes the smaller of its own
+ * relative deadline and the end-to-end deadline less the WCET of its
+ * successor, repeated along the
+ * whole chain, so a predecessor always completes early enough for every task
+ * after it to complete in time.  A successor unblocked by a queue or a task
+ * notification while its predecessor runs inherits the release time of the
+ * predecessor job and is given the end-to-end deadline, which makes it run
+ * after the predecessor and before any job with a later deadline.  A successor
+ * released in any other way keeps its own relative deadline.
+ *
+ * Each task has at most one successor, so the tasks form chains that can merge
+ * but never split.  With configUSE_EDF_ADMISSION_CONTROL set to 1 the task set
+ * is accepted if it passes the processor demand analysis with the shortened
+ * relative deadlines.  The period of a successor still bounds how often it can
+ * be released.
+ */
+
+/**
+ * edf. h
+ * <pre>
+ * BaseType_t xTaskAddPrecedence( TaskHandle_t xPredecessor,
+ *                                TaskHandle_t xSuccessor,
+ *                                TickType_t xEndToEndDeadline );
+ * </pre>
+ *
+ * Make xSuccessor the successor of xPredecessor, which must both be periodic
+ * tasks, and recompute the relative deadlines of every chain.
+ *
+ * @param xEndToEndDeadline Number of ticks after the release of a job of
+ * xPredecessor by which the job of xSuccessor it releases must complete.
+ *
+ * @return pdPASS if the edge was added.  pdFAIL if xPredecessor already has a
+ * successor or the edge would close a cycle.  errTASK_SET_NOT_SCHEDULABLE if a
+ * relative deadline would fall below the WCET of its task or, with admission
+ * control, the task set would no longer be schedulable.  The deadlines are not
+ * changed unless pdPASS is returned.
+ */
+#if ( configUSE_EDF_PRECEDENCE == 1 )
+    BaseType_t xTaskAddPrecedence( TaskHandle_t xPredecessor,
+                                   TaskHandle_t xSuccessor,
+                                   TickType_t xEndToEndDeadline ) PRIVILEGED_FUNCTION;
+#endif
+
+/*-----------------------------------------------------------
+* DEADLINE CONTROL
+*----------------------------------------------------------*/
+
+/*
+ * When configUSE_EDF_TIMERS is 1 a task that serves work of varying urgency,
+ * such as the EDF timer service, can set the deadline of its jobs itself
+ * instead of deriving it from its relative deadline.  The deadline only
+ * affects the order in which the ready jobs run - admission control still
+ * assumes the xDeadline the task was created with, so that must be the
+ * shortest deadline the task gives its jobs.
+ */
+
+/**
+ * edf. h
+ * <pre>
+ * void vTaskSetDeadline( TickType_t xDeadline );
+ * </pre>
+ *
+ * Give the job of the calling task the absolute deadline xDeadline, in ticks.
+ * The calling task yields if another ready job now has an earlier deadline.
+ */
+#if ( configUSE_EDF_TIMERS == 1 )
+    void vTaskSetDeadline( TickType_t xDeadline ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * edf. h
+ * <pre>
+ * void vTaskSetWakeDeadline( TickType_t xDeadline );
+ * </pre>
+ *
+ * Give every job the calling task releases when it is unblocked, by a timeout
+ * or by a queue, semaphore or task notification, the absolute deadline
+ * xDeadline if it is less than one period after the release, and the release
+ * time plus the relative deadline of the task otherwise.  Passing portMAX_DELAY
+ * restores the default deadlines.  A task normally calls this just before it blocks.
+ */
+#if ( configUSE_EDF_TIMERS == 1 )
+    void vTaskSetWakeDeadline( TickType_t xDeadline ) PRIVILEGED_FUNCTION;
+#endif
+
+/*-----------------------------------------------------------
+* DEFERRED INTERRUPTS
+*----------------------------------------------------------*/
+
+/*
+ * When configUSE_EDF_DEFERRED_INTERRUPTS is 1 an interrupt can hand the bulk
+ * of its processing to a handler task that blocks on its task notification,
+ * instead of the task polling for the work.  The job the interrupt releases
+ * gets a deadline relative to the arrival of the interrupt, so the handler is
+ * scheduled by the urgency of the event rather than by its period.  Nothing is
+ * copied - the interrupt leaves the data in its driver buffer and only the
+ * event bits travel with the notification.
+ */
+
+/**
+ * edf. h
+ * <pre>
+ * BaseType_t xTaskDeferFromISR( TaskHandle_t xHandler,
+ *                               uint32_t ulEventBits,
+ *                               TickType_t xRelativeDeadline,
+ *                               BaseType_t * pxHigherPriorityTaskWoken );
+ * </pre>
+ *
+ * Set ulEventBits in the notification value of the task xHandler, as
+ * xTaskNotifyFromISR() with eSetBits does, and give the job that handles the
+ * event the absolute deadline xRelativeDeadline ticks after the call.  If the
+ * handler is blocked on its notification it is readied with that deadline.  If
+ * it is already ready its deadline is only ever brought forward, and an event
+ * that arrives while it is blocked on something else is left to the job it is
+ * already running.
+ *
+ * *pxHigherPriorityTaskWoken is set to pdTRUE, and a context switch should be
+ * requested before the interrupt exits, only if the handler's deadline is now
+ * earlier than the deadline of the running job.  A handler must not be
+ * attached to a server or be an aperiodic slack stealing task.
+ *
+ * @return pdPASS.
+ *
+ * Example usage:
+ * <pre>
+ * void vUartRxISR( void )
+ * {
+ * BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+ *
+ *     // The received bytes stay in the driver's buffer.
+ *     xTaskDeferFromISR( xUartHandler, 0x01, 5, &xHigherPriorityTaskWoken );
+ *     portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+ * }
+ *
+ * void vUartHandler( void * pvParameters )
+ * {
+ *     for( ;; )
+ *     {
+ *         // Each interrupt releases a job due 5 ticks after it arrived.
+ *         xTaskNotifyWait( 0, 0xffffffff, NULL, portMAX_DELAY );
+ *         prvDrainRxBuffer();
+ *     }
+ * }
+ * </pre>
+ */
+#if ( configUSE_EDF_DEFERRED_INTERRUPTS == 1 )
+    BaseType_t xTaskDeferFromISR( TaskHandle_t xHandler,
+                                  uint32_t ulEventBits,
+                                  TickType_t xRelativeDeadline,
+                                  BaseType_t * pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+#endif
+
+/*-----------------------------------------------------------
+* STATISTICS
+*----------------------------------------------------------*/
+
+/**
+ * edf. h
+ * <pre>
+ * BaseType_t xTaskGetJobStatistics( TaskHandle_t xTask, JobStatistics_t * const pxJobStatistics );
+ * </pre>
+ *
+ * Populate a JobStatistics_t structure with the distribution of the response
+ * times and lateness of the jobs of xTask.  Passing a NULL handle returns the
+ * statistics of the calling task.
+ *
+ * A job is released at the wake time passed to xTaskDelayUntil() and
+ * completes at the next call to xTaskDelayUntil(), so only tasks that run one
+ * job per call are measured.  The completion time is the tick count at the
+ * call, refined by the run time counter increments since that tick, which
+ * makes the times accurate to a fraction of a tick.  Recording a job adds a
+ * value to two histograms of the task, each of which takes
+ * sizeof( Histogram_t ) bytes of the TCB as set by configHISTOGRAM_VALUE_BITS
+ * and configHISTOGRAM_SUB_BUCKET_BITS.
+ *
+ * The percentiles of the response time are the upper bounds of histogram
+ * buckets.  Lateness is kept as a histogram of tardiness, so the percentiles
+ * of xTardiness tell how late the latest jobs were, while the minimum, maximum
+ * and mean lateness are exact.  Nothing is formatted, so the function can be
+ * called from any task, for example to log the statistics in binary.
+ *
+ * @return pdPASS.
+ */
+#if ( configUSE_EDF_JOB_STATISTICS == 1 )
+    BaseType_t xTaskGetJobStatistics( TaskHandle_t xTask,
+                                      JobStatistics_t * const pxJobStatistics ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * edf. h
+ * <pre>
+ * void vTaskResetJobStatistics( TaskHandle_t xTask );
+ * </pre>
+ *
+ * Forget the jobs of xTask recorded so far, for example once the system has
+ * reached a steady state.  Passing a NULL handle resets the statistics of the
+ * calling task.
+ */
+#if ( configUSE_EDF_JOB_STATISTICS == 1 )
+    void vTaskResetJobStatistics( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * edf. h
+ * <pre>
+ * UBaseType_t uxTaskGetSnapshot( SystemSnapshot_t * const pxSnapshot, TaskSnapshot_t * const pxTaskSnapshots, const UBaseType_t uxArraySize );
+ * </pre>
+ *
+ * Take a binary snapshot of the timing state of every task.  Unlike
+ * uxTaskGetSystemState() the kernel lists are not walked and stack high water
+ * marks are not computed - the periodic task list is visited once, so the cost
+ * is a few dozen instructions per task.  Nothing is formatted and no memory is
+ * allocated.  Tools/edf_snapshot_dump.c prints snapshots dumped from the
+ * memory of the target.
+ *
+ * Both structures are kept by the caller between snapshots.  Each record is
+ * compared with the one the array held at the same position, and marked
+ * taskSNAPSHOT_CHANGED if they differ, so sending only the changed records
+ * keeps the full table up to date on a host.  The run time of a task that
+ * ran since the last snapshot always changes.
+ *
+ * @param pxSnapshot Receives the time of the snapshot and the number of
+ * records filled in and changed.
+ *
+ * @param pxTaskSnapshots Array of records, one per task.  It must be zero
+ * initialised, or hold the records of the previous snapshot.
+ *
+ * @param uxArraySize The number of records pxTaskSnapshots can hold.  If
+ * there are more tasks, nothing is filled in.
+ *
+ * @return The number of records filled in, 0 if the array is too small.
+ *
+ * Example usage:
+ * <pre>
+ * static SystemSnapshot_t xSnapshot;
+ * static TaskSnapshot_t xTasks[ 16 ];
+ *
+ * void vReportTasks( void )
+ * {
+ *     UBaseType_t uxTask, uxTasks;
+ *
+ *     uxTasks = uxTaskGetSnapshot( &xSnapshot, xTasks, 16 );
+ *     vSendToHost( &xSnapshot, sizeof( xSnapshot ) );
+ *
+ *     for( uxTask = 0; uxTask < uxTasks; uxTask++ )
+ *     {
+ *         if( ( xTasks[ uxTask ].ulState & taskSNAPSHOT_CHANGED ) != 0 )
+ *         {
+ *             vSendToHost( &( xTasks[ uxTask ] ), sizeof( TaskSnapshot_t ) );
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+#if ( configUSE_EDF_SNAPSHOT == 1 )
+    UBaseType_t uxTaskGetSnapshot( SystemSnapshot_t * const pxSnapshot,
+                                   TaskSnapshot_t * const pxTaskSnapshots,
+                                   const UBaseType_t uxArraySize ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * edf. h
+ * <pre>
+ * uint32_t ulTaskGetContextSwitchCount( void );
+ * </pre>
+ *
+ * @return The number of times the scheduler switched from one task to a
+ * different task since the scheduler was started.
+ */
+#if ( configUSE_TRACE_FACILITY == 1 )
+    uint32_t ulTaskGetContextSwitchCount( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * edf. h
+ * <pre>
+ * uint32_t ulTaskGetSystemLoad( void );
+ * </pre>
+ *
+ * The kernel charges the run time counter time between two context switches
+ * to the task that was running, so the time spent running by each task is
+ * returned in the ulRunTimeCounter member of the TaskStatus_t structures
+ * filled in by uxTaskGetSystemState().  This function derives the load of the
+ * processor from the same counters when it is called, rather than on every
+ * context switch.
+ *
+ * @return The percentage of the run time counter value spent outside the idle
+ * task since the scheduler was started, multiplied by 100 - so 10000 means the
+ * processor was never idle.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) )
+    uint32_t ulTaskGetSystemLoad( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* INC_EDF_H */
@@ -0,0 +1,366 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - C++ periodic task API
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Header only C++17 layer over the periodic task API of edf.h.
+ *
+ * edf::PeriodicTask holds the stack and the TCB of one periodic task together
+ * with the job it runs, so a task declared with static storage duration needs
+ * no heap.  The job is any callable taking no arguments.  Its type is a
+ * template parameter of the task, so the task loop calls it directly - there
+ * is no virtual dispatch and no void * cast in application code.
+ *
+ * edf::TaskSet checks at compile time that a set of task types is schedulable
+ * by EDF, with the utilisation test when every deadline equals its period and
+ * with the processor demand test otherwise, and creates the tasks.
+ *
+ * Example usage:
+ * <pre>
+ * static auto xSensor = edf::makePeriodicTask< 10, 5, 2, 128 >( "Sensor", 1, [] { vReadSensor(); } );
+ * static auto xLogger = edf::makePeriodicTask< 100, 100, 10, 256 >( "Logger", 1, [] { vLog(); } );
+ *
+ * int main( void )
+ * {
+ *     edf::TaskSet< decltype( xSensor ), decltype( xLogger ) >::create( xSensor, xLogger );
+ *     vTaskStartScheduler();
+ * }
+ * </pre>
+ */
+
+#ifndef INC_EDF_HPP
+#define INC_EDF_HPP
+
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "edf.h"
+
+#if ( configUSE_EDF_SCHEDULER != 1 )
+    #error edf.hpp requires configUSE_EDF_SCHEDULER to be set to 1
+#endif
+
+#if ( configSUPPORT_STATIC_ALLOCATION != 1 )
+    #error edf.hpp requires configSUPPORT_STATIC_ALLOCATION to be set to 1
+#endif
+
+#if ( INCLUDE_xTaskDelayUntil != 1 )
+    #error edf.hpp requires INCLUDE_xTaskDelayUntil to be set to 1
+#endif
+
+namespace edf
+{
+    /*
+     * A periodic task with period Period, relative deadline Deadline and worst
+     * case execution time Wcet, all in ticks, and a stack of StackWords words.
+     * Every period the task calls its job once.
+     *
+     * The deadline is passed to the kernel as the xDeadline of the task, so
+     * admission control accounts for it as well as TaskSet.
+     *
+     * The task must not be copied or moved once created, as the kernel refers
+     * to its members, so it is declared with makePeriodicTask().
+     */
+    template< TickType_t Period, TickType_t Deadline, TickType_t Wcet, configSTACK_DEPTH_TYPE StackWords, typename Job >
+    class PeriodicTask
+    {
+        static_assert( Period > 0U, "the period must be at least one tick" );
+        static_assert( Deadline <= Period, "only deadlines up to the period are supported" );
+        static_assert( Wcet <= Deadline, "a job cannot complete before its deadline" );
+        static_assert( StackWords > 0U, "the task needs a stack" );
+        static_assert( std::is_invocable_v< Job & >, "the job must be callable without arguments" );
+
+        public:
+            static constexpr TickType_t period = Period;
+            static constexpr TickType_t deadline = Deadline;
+            static constexpr TickType_t wcet = Wcet;
+
+            PeriodicTask( const char * pcName,
+                          UBaseType_t uxPriority,
+                          Job xJob ) :
+                pcName( pcName ),
+                uxPriority( uxPriority ),
+                xJob( std::move( xJob ) )
+            {
+            }
+
+            PeriodicTask( const PeriodicTask & ) = delete;
+            PeriodicTask & operator=( const PeriodicTask & ) = delete;
+
+            /*
+             * Create the task in the memory of this object.  Returns the result
+             * of xTaskPeriodicCreateStatic().
+             */
+            BaseType_t create()
+            {
+                PeriodicTaskParameters_t xDefinition = {};
+
+                xDefinition.pvTaskCode = &PeriodicTask::prvTaskLoop;
+                xDefinition.pcName = pcName;
+                xDefinition.usStackDepth = StackWords;
+                xDefinition.pvParameters = this;
+                xDefinition.uxPriority = uxPriority;
+                xDefinition.xPeriod = Period;
+                xDefinition.xWcet = Wcet;
+                xDefinition.xDeadline = Deadline;
+
+                return xTaskPeriodicCreateStatic( &xDefinition, uxStack, &xTCB, &xHandle );
+            }
+
+            TaskHandle_t handle() const
+            {
+                return xHandle;
+            }
+
+        private:
+            static void prvTaskLoop( void * pvParameters )
+            {
+                PeriodicTask * const pxTask = static_cast< PeriodicTask * >( pvParameters );
+                TickType_t xLastWakeTime = xTaskGetTickCount();
+
+                for( ; ; )
+                {
+                    pxTask->xJob();
+
+                    ( void ) xTaskDelayUntil( &xLastWakeTime, Period );
+                }
+            }
+
+            const char * const pcName;
+            const UBaseType_t uxPriority;
+            Job xJob;
+            TaskHandle_t xHandle = nullptr;
+            StaticPeriodicTask_t xTCB;
+            StackType_t uxStack[ StackWords ];
+    };
+
+    /*
+     * Declare a periodic task running xJob.  The task is returned by value but
+     * never copied, as C++17 constructs it directly in the declared variable.
+     */
+    template< TickType_t Period, TickType_t Deadline, TickType_t Wcet, configSTACK_DEPTH_TYPE StackWords, typename Job >
+    PeriodicTask< Period, Deadline, Wcet, StackWords, std::decay_t< Job > > makePeriodicTask( const char * pcName,
+                                                                                            UBaseType_t uxPriority,
+                                                                                            Job && xJob )
+    {
+        return PeriodicTask< Period, Deadline, Wcet, StackWords, std::decay_t< Job > >( pcName, uxPriority, std::forward< Job >( xJob ) );
+    }
+
+    namespace detail
+    {
+        struct Timing
+        {
+            uint64_t ullPeriod;
+            uint64_t ullDeadline;
+            uint64_t ullWcet;
+        };
+
+        /* Exact non negative fraction, kept reduced. */
+        struct Fraction
+        {
+            uint64_t ullNumerator;
+            uint64_t ullDenominator;
+        };
+
+        constexpr uint64_t gcd( uint64_t ullA,
+                                uint64_t ullB )
+        {
+            while( ullB != 0U )
+            {
+                const uint64_t ullRemainder = ullA % ullB;
+                ullA = ullB;
+                ullB = ullRemainder;
+            }
+
+            return ullA;
+        }
+
+        constexpr Fraction add( Fraction xA,
+                                uint64_t ullNumerator,
+                                uint64_t ullDenominator )
+        {
+            const uint64_t ullCommon = gcd( xA.ullDenominator, ullDenominator );
+            const uint64_t ullScaleA = ullDenominator / ullCommon;
+            const uint64_t ullScaleB = xA.ullDenominator / ullCommon;
+            Fraction xSum = { ( xA.ullNumerator * ullScaleA ) + ( ullNumerator * ullScaleB ), xA.ullDenominator * ullScaleA };
+            const uint64_t ullReduce = gcd( xSum.ullNumerator, xSum.ullDenominator );
+
+            if( ullReduce > 1U )
+            {
+                xSum.ullNumerator /= ullReduce;
+                xSum.ullDenominator /= ullReduce;
+            }
+
+            return xSum;
+        }
+
+        template< size_t N >
+        constexpr Fraction utilisation( const Timing ( &xTasks )[ N ] )
+        {
+            Fraction xUtilisation = { 0U, 1U };
+
+            for( size_t x = 0; x < N; x++ )
+            {
+                xUtilisation = add( xUtilisation, xTasks[ x ].ullWcet, xTasks[ x ].ullPeriod );
+            }
+
+            return xUtilisation;
+        }
+
+        /* Processor demand of the jobs released and due within [ 0, t ]. */
+        template< size_t N >
+        constexpr uint64_t demand( const Timing ( &xTasks )[ N ],
+                                   uint64_t ullTime )
+        {
+            uint64_t ullDemand = 0U;
+
+            for( size_t x = 0; x < N; x++ )
+            {
+                if( ullTime >= xTasks[ x ].ullDeadline )
+                {
+                    ullDemand += ( ( ( ullTime - xTasks[ x ].ullDeadline ) / xTasks[ x ].ullPeriod ) + 1U ) * xTasks[ x ].ullWcet;
+                }
+            }
+
+            return ullDemand;
+        }
+
+        /*
+         * Length of the interval the demand has to be checked over.  With
+         * U < 1 it is the bound of Baruah et al., max( D_i, sum( ( T_i - D_i ) *
+         * U_i ) / ( 1 - U ) ), capped by the hyperperiod plus the longest
+         * deadline, which is valid for any U <= 1.
+         */
+        template< size_t N >
+        constexpr uint64_t demandInterval( const Timing ( &xTasks )[ N ] )
+        {
+            const Fraction xUtilisation = utilisation( xTasks );
+            Fraction xSlack = { 0U, 1U };
+            uint64_t ullHyperperiod = 1U;
+            uint64_t ullLongestDeadline = 0U;
+            uint64_t ullInterval = 0U;
+
+            for( size_t x = 0; x < N; x++ )
+            {
+                xSlack = add( xSlack, ( xTasks[ x ].ullPeriod - xTasks[ x ].ullDeadline ) * xTasks[ x ].ullWcet, xTasks[ x ].ullPeriod );
+                ullHyperperiod = ( ullHyperperiod / gcd( ullHyperperiod, xTasks[ x ].ullPeriod ) ) * xTasks[ x ].ullPeriod;
+
+                if( xTasks[ x ].ullDeadline > ullLongestDeadline )
+                {
+                    ullLongestDeadline = xTasks[ x ].ullDeadline;
+                }
+            }
+
+            ullInterval = ullHyperperiod + ullLongestDeadline;
+
+            if( xUtilisation.ullNumerator < xUtilisation.ullDenominator )
+            {
+                /* sum / ( 1 - U ), rounded up. */
+                const uint64_t ullNumerator = xSlack.ullNumerator * xUtilisation.ullDenominator;
+                const uint64_t ullDenominator = xSlack.ullDenominator * ( xUtilisation.ullDenominator - xUtilisation.ullNumerator );
+                uint64_t ullBound = ( ullNumerator + ullDenominator - 1U ) / ullDenominator;
+
+                if( ullBound < ullLongestDeadline )
+                {
+                    ullBound = ullLongestDeadline;
+                }
+
+                if( ullBound < ullInterval )
+                {
+                    ullInterval = ullBound;
+                }
+            }
+
+            return ullInterval;
+        }
+
+        /* The demand only changes at absolute deadlines, so only those are
+         * checked. */
+        template< size_t N >
+        constexpr bool demandWithinSupply( const Timing ( &xTasks )[ N ] )
+        {
+            const uint64_t ullInterval = demandInterval( xTasks );
+
+            for( size_t x = 0; x < N; x++ )
+            {
+                for( uint64_t ullTime = xTasks[ x ].ullDeadline; ullTime <= ullInterval; ullTime += xTasks[ x ].ullPeriod )
+                {
+                    if( demand( xTasks, ullTime ) > ullTime )
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+    }
+
+    /*
+     * A set of periodic task types, PeriodicTask or any type with the same
+     * period, deadline and wcet constants.  Naming a set that EDF cannot
+     * schedule fails to compile.
+     */
+    template< typename ... Tasks >
+    class TaskSet
+    {
+        static_assert( sizeof...( Tasks ) > 0U, "a task set holds at least one task" );
+
+        static constexpr detail::Timing xTimings[] = { { Tasks::period, Tasks::deadline, Tasks::wcet } ... };
+
+        public:
+            /* Utilisation of the task set. */
+            static constexpr detail::Fraction utilisation = detail::utilisation( xTimings );
+
+            /* True if every deadline equals its period. */
+            static constexpr bool implicitDeadlines = ( ( Tasks::deadline == Tasks::period ) && ... );
+
+            /* True if no job of the set misses its deadline under EDF. */
+            static constexpr bool schedulable = ( utilisation.ullNumerator <= utilisation.ullDenominator ) &&
+                                                ( implicitDeadlines || detail::demandWithinSupply( xTimings ) );
+
+            static_assert( schedulable, "the task set is not schedulable by EDF" );
+
+            /*
+             * Create the tasks in the order given.  Returns pdPASS if every task
+             * was created, otherwise the result of the first task that was not.
+             */
+            static BaseType_t create( Tasks & ... xTasks )
+            {
+                BaseType_t xReturn = pdPASS;
+
+                ( void ) ( ( ( xReturn = xTasks.create() ) == pdPASS ) && ... );
+
+                return xReturn;
+            }
+    };
+}
+
+#endif /* INC_EDF_HPP */
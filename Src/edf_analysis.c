@@ -0,0 +1,903 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - EDF schedulability analysis
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "edf_analysis.h"
+
+/* Largest scaling factor eEDFAnalysisScalingFactor() reports. */
+#define edfanalysisMAX_SCALING         ( ( uint32_t ) 1000U * edfanalysisSCALING_ONE )
+
+/* Utilisations are summed in units of 2 ^ -32. */
+#define edfanalysisUTILISATION_ONE     ( ( uint64_t ) 1U << 32 )
+
+/* State of one test of a task set. */
+typedef struct xEDF_ANALYSIS
+{
+    const EDFAnalysisTaskSet_t * pxTaskSet;
+    uint32_t ulScaling; /*< Factor applied to every WCET and non-preemptive time, in units of 1 / edfanalysisSCALING_ONE. */
+    uint32_t ulSteps;   /*< Number of times the demand was evaluated. */
+} EDFAnalysis_t;
+
+/*
+ * Reads the task with index uxIndex into *pxTask, with the deadline replaced
+ * by the period if it is 0.  Returns 0 if there is no such task.
+ */
+static int32_t prvReadTask( const EDFAnalysisTaskSet_t * pxTaskSet,
+                            size_t uxIndex,
+                            EDFAnalysisTask_t * pxTask );
+
+/*
+ * Returns ullA * ullB / ullDivisor, rounded up if lRoundUp is not 0, computed
+ * without overflowing the product.  Saturates at UINT64_MAX.
+ */
+static uint64_t prvMulDiv( uint64_t ullA,
+                           uint64_t ullB,
+                           uint64_t ullDivisor,
+                           int32_t lRoundUp );
+
+/*
+ * Returns the scaled value of the execution time ullTime, rounded up.
+ */
+static uint64_t prvScale( const EDFAnalysis_t * pxAnalysis,
+                          uint64_t ullTime );
+
+/*
+ * Returns the longest unscaled execution time that fits in ullTime once
+ * scaled.
+ */
+static uint64_t prvUnscale( const EDFAnalysis_t * pxAnalysis,
+                            uint64_t ullTime );
+
+/*
+ * Counts an evaluation of the demand.  Returns 0 if the test has already used
+ * the steps it is allowed.
+ */
+static int32_t prvStep( EDFAnalysis_t * pxAnalysis );
+
+/*
+ * Returns the unscaled execution time of the jobs released and due within
+ * [ 0, ullTime ] after the synchronous release of every task.
+ */
+static uint64_t prvDemand( const EDFAnalysisTaskSet_t * pxTaskSet,
+                           uint64_t ullTime );
+
+/*
+ * Returns the unscaled longest blocking of the jobs due within [ 0, ullTime ]
+ * by a job due after ullTime.
+ */
+static uint64_t prvBlocking( const EDFAnalysisTaskSet_t * pxTaskSet,
+                             uint64_t ullTime );
+
+/*
+ * Returns the latest absolute deadline before ullTime, or 0 if there is none.
+ * Only tasks with a WCET are considered, as only their deadlines change the
+ * demand.
+ */
+static uint64_t prvDeadlineBefore( const EDFAnalysisTaskSet_t * pxTaskSet,
+                                   uint64_t ullTime );
+
+/*
+ * Returns the earliest absolute deadline after ullTime, or UINT64_MAX if
+ * there is none.
+ */
+static uint64_t prvDeadlineAfter( const EDFAnalysisTaskSet_t * pxTaskSet,
+                                  uint64_t ullTime );
+
+/*
+ * Returns the latest time before ullTime at which the blocking changes, or 0
+ * if there is none.  Between two such times the blocking is constant.
+ */
+static uint64_t prvBlockingChangeBefore( const EDFAnalysisTaskSet_t * pxTaskSet,
+                                         uint64_t ullTime );
+
+/*
+ * Sets *pullLow and *pullHigh to the utilisation of the task set in units of
+ * 1 / edfanalysisUTILISATION_ONE, rounded down and up, so whether it exceeds 1
+ * is known exactly unless it is very close.  Returns 0 if a task with a WCET
+ * has a period of 0.
+ */
+static int32_t prvUtilisation( const EDFAnalysisTaskSet_t * pxTaskSet,
+                               uint64_t * pullLow,
+                               uint64_t * pullHigh );
+
+/*
+ * Sets *pullBound to the length of the longest interval that has to be
+ * checked.  Returns eEDFAnalysisInfeasible if the utilisation exceeds 1.
+ */
+static eEDFAnalysisResult prvBound( EDFAnalysis_t * pxAnalysis,
+                                    uint64_t * pullBound );
+
+/*
+ * Checks the deadlines within [ ullFrom, ullTo ) with QPA, given that the
+ * blocking is ullBlocking throughout.
+ */
+static eEDFAnalysisResult prvQPAInterval( EDFAnalysis_t * pxAnalysis,
+                                          uint64_t ullFrom,
+                                          uint64_t ullTo,
+                                          uint64_t ullBlocking,
+                                          EDFAnalysisReport_t * pxReport );
+
+/*
+ * Runs QPA on the task set scaled as set in pxAnalysis.
+ */
+static eEDFAnalysisResult prvQPA( EDFAnalysis_t * pxAnalysis,
+                                  EDFAnalysisReport_t * pxReport );
+
+/*-----------------------------------------------------------*/
+
+static int32_t prvReadTask( const EDFAnalysisTaskSet_t * pxTaskSet,
+                            size_t uxIndex,
+                            EDFAnalysisTask_t * pxTask )
+{
+    if( pxTaskSet->pxTasks != NULL )
+    {
+        if( uxIndex >= pxTaskSet->uxTaskCount )
+        {
+            return 0;
+        }
+
+        *pxTask = pxTaskSet->pxTasks[ uxIndex ];
+    }
+    else if( pxTaskSet->pxReadTask( pxTaskSet->pvContext, uxIndex, pxTask ) == 0 )
+    {
+        return 0;
+    }
+
+    if( pxTask->ulDeadline == 0UL )
+    {
+        pxTask->ulDeadline = pxTask->ulPeriod;
+    }
+
+    return 1;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvMulDiv( uint64_t ullA,
+                           uint64_t ullB,
+                           uint64_t ullDivisor,
+                           int32_t lRoundUp )
+{
+    const uint64_t ullMask = 0xFFFFFFFFU;
+    uint64_t ullHigh, ullLow, ullMiddle, ullRemainder, ullQuotient = 0U, ullCarry;
+    int32_t lBit;
+
+    if( ( ullB == 0U ) || ( ullA <= ( UINT64_MAX / ullB ) ) )
+    {
+        ullLow = ullA * ullB;
+        ullQuotient = ullLow / ullDivisor;
+
+        if( ( lRoundUp != 0 ) && ( ( ullLow % ullDivisor ) != 0U ) )
+        {
+            ullQuotient++;
+        }
+
+        return ullQuotient;
+    }
+
+    /* Form the 128-bit product from 32-bit halves, then divide it one bit at
+     * a time. */
+    ullLow = ( ullA & ullMask ) * ( ullB & ullMask );
+    ullMiddle = ( ullLow >> 32 ) + ( ( ullA & ullMask ) * ( ullB >> 32 ) & ullMask ) + ( ( ullA >> 32 ) * ( ullB & ullMask ) & ullMask );
+    ullHigh = ( ( ullA >> 32 ) * ( ullB >> 32 ) ) + ( ( ( ullA & ullMask ) * ( ullB >> 32 ) ) >> 32 ) + ( ( ( ullA >> 32 ) * ( ullB & ullMask ) ) >> 32 ) + ( ullMiddle >> 32 );
+    ullLow = ( ullLow & ullMask ) | ( ullMiddle << 32 );
+
+    if( ullHigh >= ullDivisor )
+    {
+        return UINT64_MAX;
+    }
+
+    ullRemainder = ullHigh;
+
+    for( lBit = 63; lBit >= 0; lBit-- )
+    {
+        ullCarry = ullRemainder >> 63;
+        ullRemainder = ( ullRemainder << 1 ) | ( ( ullLow >> lBit ) & 1U );
+        ullQuotient <<= 1;
+
+        if( ( ullCarry != 0U ) || ( ullRemainder >= ullDivisor ) )
+        {
+            ullRemainder -= ullDivisor;
+            ullQuotient |= 1U;
+        }
+    }
+
+    if( ( lRoundUp != 0 ) && ( ullRemainder != 0U ) && ( ullQuotient != UINT64_MAX ) )
+    {
+        ullQuotient++;
+    }
+
+    return ullQuotient;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvScale( const EDFAnalysis_t * pxAnalysis,
+                          uint64_t ullTime )
+{
+    return prvMulDiv( ullTime, pxAnalysis->ulScaling, edfanalysisSCALING_ONE, 1 );
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvUnscale( const EDFAnalysis_t * pxAnalysis,
+                            uint64_t ullTime )
+{
+    return prvMulDiv( ullTime, edfanalysisSCALING_ONE, pxAnalysis->ulScaling, 0 );
+}
+/*-----------------------------------------------------------*/
+
+static int32_t prvStep( EDFAnalysis_t * pxAnalysis )
+{
+    if( ( pxAnalysis->pxTaskSet->ulMaxSteps != 0UL ) && ( pxAnalysis->ulSteps >= pxAnalysis->pxTaskSet->ulMaxSteps ) )
+    {
+        return 0;
+    }
+
+    pxAnalysis->ulSteps++;
+
+    return 1;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvDemand( const EDFAnalysisTaskSet_t * pxTaskSet,
+                           uint64_t ullTime )
+{
+    EDFAnalysisTask_t xTask;
+    uint64_t ullDemand = 0U;
+    size_t uxIndex;
+
+    /* Intervals are at most edfanalysisMAX_HORIZON long and only checked if
+     * the scaled utilisation does not exceed 1, so the sum cannot overflow. */
+    for( uxIndex = 0; prvReadTask( pxTaskSet, uxIndex, &xTask ) != 0; uxIndex++ )
+    {
+        if( ( xTask.ulWcet != 0UL ) && ( xTask.ulPeriod != 0UL ) && ( ullTime >= xTask.ulDeadline ) )
+        {
+            ullDemand += ( ( ( ullTime - xTask.ulDeadline ) / xTask.ulPeriod ) + 1U ) * xTask.ulWcet;
+        }
+    }
+
+    return ullDemand;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvBlocking( const EDFAnalysisTaskSet_t * pxTaskSet,
+                             uint64_t ullTime )
+{
+    EDFAnalysisTask_t xTask;
+    uint64_t ullBlocking = 0U;
+    uint32_t ulTaskBlocking;
+    size_t uxIndex;
+
+    for( uxIndex = 0; prvReadTask( pxTaskSet, uxIndex, &xTask ) != 0; uxIndex++ )
+    {
+        /* Only a job due after the interval can have started before it
+         * without being preempted by the jobs in the interval. */
+        if( ( xTask.ulPeriod != 0UL ) && ( xTask.ulDeadline > ullTime ) )
+        {
+            ulTaskBlocking = xTask.ulNonPreemptive;
+
+            if( ( xTask.ulPreemptionThreshold != 0UL ) && ( xTask.ulPreemptionThreshold <= ullTime ) && ( xTask.ulWcet > ulTaskBlocking ) )
+            {
+                ulTaskBlocking = xTask.ulWcet;
+            }
+
+            if( ulTaskBlocking > ullBlocking )
+            {
+                ullBlocking = ulTaskBlocking;
+            }
+        }
+    }
+
+    return ullBlocking;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvDeadlineBefore( const EDFAnalysisTaskSet_t * pxTaskSet,
+                                   uint64_t ullTime )
+{
+    EDFAnalysisTask_t xTask;
+    uint64_t ullLatest = 0U, ullDeadline;
+    size_t uxIndex;
+
+    for( uxIndex = 0; prvReadTask( pxTaskSet, uxIndex, &xTask ) != 0; uxIndex++ )
+    {
+        if( ( xTask.ulWcet != 0UL ) && ( xTask.ulPeriod != 0UL ) && ( ullTime > xTask.ulDeadline ) )
+        {
+            ullDeadline = ( ( ( ullTime - 1U - xTask.ulDeadline ) / xTask.ulPeriod ) * xTask.ulPeriod ) + xTask.ulDeadline;
+
+            if( ullDeadline > ullLatest )
+            {
+                ullLatest = ullDeadline;
+            }
+        }
+    }
+
+    return ullLatest;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvDeadlineAfter( const EDFAnalysisTaskSet_t * pxTaskSet,
+                                  uint64_t ullTime )
+{
+    EDFAnalysisTask_t xTask;
+    uint64_t ullEarliest = UINT64_MAX, ullDeadline;
+    size_t uxIndex;
+
+    for( uxIndex = 0; prvReadTask( pxTaskSet, uxIndex, &xTask ) != 0; uxIndex++ )
+    {
+        if( ( xTask.ulWcet != 0UL ) && ( xTask.ulPeriod != 0UL ) )
+        {
+            if( ullTime < xTask.ulDeadline )
+            {
+                ullDeadline = xTask.ulDeadline;
+            }
+            else
+            {
+                ullDeadline = ( ( ( ( ullTime - xTask.ulDeadline ) / xTask.ulPeriod ) + 1U ) * xTask.ulPeriod ) + xTask.ulDeadline;
+            }
+
+            if( ullDeadline < ullEarliest )
+            {
+                ullEarliest = ullDeadline;
+            }
+        }
+    }
+
+    return ullEarliest;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvBlockingChangeBefore( const EDFAnalysisTaskSet_t * pxTaskSet,
+                                         uint64_t ullTime )
+{
+    EDFAnalysisTask_t xTask;
+    uint64_t ullLatest = 0U;
+    size_t uxIndex;
+
+    for( uxIndex = 0; prvReadTask( pxTaskSet, uxIndex, &xTask ) != 0; uxIndex++ )
+    {
+        if( ( xTask.ulPeriod != 0UL ) && ( ( xTask.ulNonPreemptive != 0UL ) || ( xTask.ulPreemptionThreshold != 0UL ) ) )
+        {
+            /* A task stops blocking at its relative deadline, and blocks for
+             * its whole WCET from its preemption threshold. */
+            if( ( xTask.ulDeadline < ullTime ) && ( xTask.ulDeadline > ullLatest ) )
+            {
+                ullLatest = xTask.ulDeadline;
+            }
+
+            if( ( xTask.ulPreemptionThreshold < ullTime ) && ( xTask.ulPreemptionThreshold > ullLatest ) )
+            {
+                ullLatest = xTask.ulPreemptionThreshold;
+            }
+        }
+    }
+
+    return ullLatest;
+}
+/*-----------------------------------------------------------*/
+
+static int32_t prvUtilisation( const EDFAnalysisTaskSet_t * pxTaskSet,
+                               uint64_t * pullLow,
+                               uint64_t * pullHigh )
+{
+    EDFAnalysisTask_t xTask;
+    uint64_t ullTerm;
+    size_t uxIndex;
+
+    *pullLow = 0U;
+    *pullHigh = 0U;
+
+    for( uxIndex = 0; prvReadTask( pxTaskSet, uxIndex, &xTask ) != 0; uxIndex++ )
+    {
+        if( xTask.ulPeriod == 0UL )
+        {
+            if( xTask.ulWcet != 0UL )
+            {
+                return 0;
+            }
+        }
+        else
+        {
+            ullTerm = ( ( uint64_t ) xTask.ulWcet << 32 ) / xTask.ulPeriod;
+            *pullLow = ( *pullLow <= ( UINT64_MAX - ullTerm ) ) ? ( *pullLow + ullTerm ) : UINT64_MAX;
+            ullTerm += ( ( ( ( uint64_t ) xTask.ulWcet << 32 ) % xTask.ulPeriod ) != 0U ) ? 1U : 0U;
+            *pullHigh = ( *pullHigh <= ( UINT64_MAX - ullTerm ) ) ? ( *pullHigh + ullTerm ) : UINT64_MAX;
+        }
+    }
+
+    return 1;
+}
+/*-----------------------------------------------------------*/
+
+static eEDFAnalysisResult prvBound( EDFAnalysis_t * pxAnalysis,
+                                    uint64_t * pullBound )
+{
+    const EDFAnalysisTaskSet_t * const pxTaskSet = pxAnalysis->pxTaskSet;
+    EDFAnalysisTask_t xTask;
+    uint64_t ullUtilisationLow, ullUtilisationHigh;
+    uint64_t ullLaxity = 0U, ullLateness = 0U, ullWcet = 0U, ullBlockingDeadline = 0U;
+    uint64_t ullInverseLow, ullInverseHigh, ullBound = UINT64_MAX, ullLimit, ullBusyPeriod, ullNext;
+    size_t uxIndex;
+
+    if( prvUtilisation( pxTaskSet, &ullUtilisationLow, &ullUtilisationHigh ) == 0 )
+    {
+        return eEDFAnalysisInfeasible;
+    }
+
+    for( uxIndex = 0; prvReadTask( pxTaskSet, uxIndex, &xTask ) != 0; uxIndex++ )
+    {
+        if( xTask.ulPeriod == 0UL )
+        {
+            continue;
+        }
+
+        /* Sum of ( T - D ) * C / T over the tasks with a deadline shorter
+         * than their period, rounded up, and the longest D - T of the
+         * others. */
+        if( xTask.ulDeadline < xTask.ulPeriod )
+        {
+            ullLaxity += prvMulDiv( ( uint64_t ) xTask.ulPeriod - xTask.ulDeadline, xTask.ulWcet, xTask.ulPeriod, 1 );
+        }
+        else if( ( ( uint64_t ) xTask.ulDeadline - xTask.ulPeriod ) > ullLateness )
+        {
+            ullLateness = ( uint64_t ) xTask.ulDeadline - xTask.ulPeriod;
+        }
+
+        if( ( ( xTask.ulNonPreemptive != 0UL ) || ( ( xTask.ulPreemptionThreshold != 0UL ) && ( xTask.ulWcet != 0UL ) ) ) && ( xTask.ulDeadline > ullBlockingDeadline ) )
+        {
+            ullBlockingDeadline = xTask.ulDeadline;
+        }
+
+        ullWcet += xTask.ulWcet;
+    }
+
+    /* The scaled utilisation is compared with 1 as the unscaled utilisation
+     * with the inverse of the scaling factor. */
+    ullInverseLow = prvMulDiv( edfanalysisUTILISATION_ONE, edfanalysisSCALING_ONE, pxAnalysis->ulScaling, 0 );
+    ullInverseHigh = prvMulDiv( edfanalysisUTILISATION_ONE, edfanalysisSCALING_ONE, pxAnalysis->ulScaling, 1 );
+
+    if( ullUtilisationLow > ullInverseHigh )
+    {
+        return eEDFAnalysisInfeasible;
+    }
+
+    /* With a utilisation below 1 the demand cannot exceed the time available
+     * after max( D - T, sum( ( T - D ) * U ) / ( 1 - U ) ), the bound of
+     * Zhang and Burns. */
+    if( ullUtilisationHigh < ullInverseLow )
+    {
+        ullBound = prvMulDiv( ullLaxity, edfanalysisUTILISATION_ONE, ullInverseLow - ullUtilisationHigh, 1 );
+
+        if( ullLateness > ullBound )
+        {
+            ullBound = ullLateness;
+        }
+    }
+
+    /* Nor can it after the synchronous busy period, which is found by
+     * iterating until the work released within it all completes.  This is
+     * the only bound if the utilisation may be 1, and it is only computed up
+     * to the other bound. */
+    ullLimit = ( ullBound < edfanalysisMAX_HORIZON ) ? ullBound : edfanalysisMAX_HORIZON;
+    ullBusyPeriod = prvScale( pxAnalysis, ullWcet );
+
+    while( ullBusyPeriod <= ullLimit )
+    {
+        if( prvStep( pxAnalysis ) == 0 )
+        {
+            return eEDFAnalysisUndecided;
+        }
+
+        ullWcet = 0U;
+
+        for( uxIndex = 0; prvReadTask( pxTaskSet, uxIndex, &xTask ) != 0; uxIndex++ )
+        {
+            if( xTask.ulPeriod != 0UL )
+            {
+                ullWcet += ( ( ullBusyPeriod + xTask.ulPeriod - 1U ) / xTask.ulPeriod ) * xTask.ulWcet;
+            }
+        }
+
+        ullNext = prvScale( pxAnalysis, ullWcet );
+
+        if( ullNext == ullBusyPeriod )
+        {
+            ullBound = ullBusyPeriod;
+            break;
+        }
+
+        ullBusyPeriod = ullNext;
+    }
+
+    if( ullBound > edfanalysisMAX_HORIZON )
+    {
+        return eEDFAnalysisUndecided;
+    }
+
+    /* Jobs can be blocked in shorter intervals whatever the utilisation. */
+    *pullBound = ( ullBlockingDeadline > ullBound ) ? ullBlockingDeadline : ullBound;
+
+    return eEDFAnalysisFeasible;
+}
+/*-----------------------------------------------------------*/
+
+static eEDFAnalysisResult prvQPAInterval( EDFAnalysis_t * pxAnalysis,
+                                          uint64_t ullFrom,
+                                          uint64_t ullTo,
+                                          uint64_t ullBlocking,
+                                          EDFAnalysisReport_t * pxReport )
+{
+    uint64_t ullTime, ullDemand;
+
+    /* The demand never decreases as the interval grows.  So once the demand
+     * in an interval of length t is known to fit, it also fits in every
+     * interval whose length is between the demand and t, and only deadlines
+     * before the demand remain to be checked. */
+    ullTime = prvDeadlineBefore( pxAnalysis->pxTaskSet, ullTo );
+
+    while( ( ullTime >= ullFrom ) && ( ullTime != 0U ) )
+    {
+        if( prvStep( pxAnalysis ) == 0 )
+        {
+            return eEDFAnalysisUndecided;
+        }
+
+        ullDemand = prvDemand( pxAnalysis->pxTaskSet, ullTime ) + ullBlocking;
+
+        if( ullDemand > prvUnscale( pxAnalysis, ullTime ) )
+        {
+            if( pxReport != NULL )
+            {
+                pxReport->ullMissTime = ullTime;
+                pxReport->ullDemand = ullDemand;
+            }
+
+            return eEDFAnalysisInfeasible;
+        }
+
+        ullTime = prvDeadlineBefore( pxAnalysis->pxTaskSet, prvScale( pxAnalysis, ullDemand ) );
+    }
+
+    return eEDFAnalysisFeasible;
+}
+/*-----------------------------------------------------------*/
+
+static eEDFAnalysisResult prvQPA( EDFAnalysis_t * pxAnalysis,
+                                  EDFAnalysisReport_t * pxReport )
+{
+    eEDFAnalysisResult eResult;
+    uint64_t ullBound = 0U, ullFrom, ullTo;
+
+    eResult = prvBound( pxAnalysis, &ullBound );
+
+    if( pxReport != NULL )
+    {
+        pxReport->ullBound = ullBound;
+    }
+
+    /* The blocking makes the demand decrease at the deadlines of the tasks
+     * that block, so QPA is run separately over each interval in which the
+     * blocking is constant, from the last. */
+    ullTo = ullBound;
+
+    while( ( eResult == eEDFAnalysisFeasible ) && ( ullTo != 0U ) )
+    {
+        ullFrom = prvBlockingChangeBefore( pxAnalysis->pxTaskSet, ullTo );
+        eResult = prvQPAInterval( pxAnalysis, ullFrom, ullTo, prvBlocking( pxAnalysis->pxTaskSet, ullFrom ), pxReport );
+        ullTo = ullFrom;
+    }
+
+    return eResult;
+}
+/*-----------------------------------------------------------*/
+
+eEDFAnalysisResult eEDFAnalysisDemandTest( const EDFAnalysisTaskSet_t * const pxTaskSet,
+                                           EDFAnalysisReport_t * const pxReport )
+{
+    EDFAnalysis_t xAnalysis = { pxTaskSet, edfanalysisSCALING_ONE, 0UL };
+    eEDFAnalysisResult eResult;
+    uint64_t ullBound = 0U, ullTime, ullDemand;
+
+    if( pxReport != NULL )
+    {
+        pxReport->ullMissTime = 0U;
+        pxReport->ullDemand = 0U;
+    }
+
+    eResult = prvBound( &xAnalysis, &ullBound );
+    ullTime = prvDeadlineAfter( pxTaskSet, 0U );
+
+    while( ( eResult == eEDFAnalysisFeasible ) && ( ullTime < ullBound ) )
+    {
+        if( prvStep( &xAnalysis ) == 0 )
+        {
+            eResult = eEDFAnalysisUndecided;
+        }
+        else
+        {
+            ullDemand = prvDemand( pxTaskSet, ullTime ) + prvBlocking( pxTaskSet, ullTime );
+
+            if( ullDemand > ullTime )
+            {
+                if( pxReport != NULL )
+                {
+                    pxReport->ullMissTime = ullTime;
+                    pxReport->ullDemand = ullDemand;
+                }
+
+                eResult = eEDFAnalysisInfeasible;
+            }
+
+            ullTime = prvDeadlineAfter( pxTaskSet, ullTime );
+        }
+    }
+
+    if( pxReport != NULL )
+    {
+        pxReport->ullBound = ullBound;
+        pxReport->ulSteps = xAnalysis.ulSteps;
+    }
+
+    return eResult;
+}
+/*-----------------------------------------------------------*/
+
+eEDFAnalysisResult eEDFAnalysisQPATest( const EDFAnalysisTaskSet_t * const pxTaskSet,
+                                        EDFAnalysisReport_t * const pxReport )
+{
+    EDFAnalysis_t xAnalysis = { pxTaskSet, edfanalysisSCALING_ONE, 0UL };
+    eEDFAnalysisResult eResult;
+
+    if( pxReport != NULL )
+    {
+        pxReport->ullMissTime = 0U;
+        pxReport->ullDemand = 0U;
+    }
+
+    eResult = prvQPA( &xAnalysis, pxReport );
+
+    if( pxReport != NULL )
+    {
+        pxReport->ulSteps = xAnalysis.ulSteps;
+    }
+
+    return eResult;
+}
+/*-----------------------------------------------------------*/
+
+eEDFAnalysisResult eEDFAnalysisScalingFactor( const EDFAnalysisTaskSet_t * const pxTaskSet,
+                                              uint32_t * const pulScaling )
+{
+    EDFAnalysis_t xAnalysis = { pxTaskSet, edfanalysisSCALING_ONE, 0UL };
+    EDFAnalysisReport_t xReport;
+    eEDFAnalysisResult eReturn = eEDFAnalysisFeasible;
+    uint64_t ullUtilisation, ullUtilisationHigh, ullLimit;
+    uint32_t ulFeasible = 0UL, ulInfeasible;
+
+    /* No factor from the inverse of the utilisation up can be feasible. */
+    if( prvUtilisation( pxTaskSet, &ullUtilisation, &ullUtilisationHigh ) == 0 )
+    {
+        *pulScaling = 0UL;
+
+        return eEDFAnalysisFeasible;
+    }
+
+    ullLimit = ( ullUtilisation != 0U ) ? ( prvMulDiv( edfanalysisSCALING_ONE, edfanalysisUTILISATION_ONE, ullUtilisation, 0 ) + 1U ) : UINT64_MAX;
+    ulInfeasible = ( ullLimit <= edfanalysisMAX_SCALING ) ? ( uint32_t ) ullLimit : ( edfanalysisMAX_SCALING + 1UL );
+    xAnalysis.ulScaling = ( ulInfeasible > edfanalysisSCALING_ONE ) ? edfanalysisSCALING_ONE : ( ulInfeasible - 1UL );
+
+    /* Feasibility can only be lost as the factor grows, so the factor lies
+     * between the largest factor known to be feasible and the smallest known
+     * not to be.  A factor found infeasible by an interval of length t with a
+     * demand h also rules out every factor above t / h, which is tried next
+     * and is usually the answer.  Otherwise the interval is bisected.  Close
+     * to the inverse of the utilisation the intervals to check grow long, so
+     * the first factor tried is 1. */
+    while( ( ulInfeasible - ulFeasible ) > 1UL )
+    {
+        xAnalysis.ulSteps = 0UL;
+        xReport.ullMissTime = 0U;
+
+        switch( prvQPA( &xAnalysis, &xReport ) )
+        {
+            case eEDFAnalysisFeasible:
+                ulFeasible = xAnalysis.ulScaling;
+                xAnalysis.ulScaling = ulFeasible + ( ( ulInfeasible - ulFeasible ) / 2UL );
+                break;
+
+            case eEDFAnalysisInfeasible:
+                ulInfeasible = xAnalysis.ulScaling;
+
+                if( xReport.ullMissTime != 0U )
+                {
+                    /* Not below ulFeasible, as the interval fits the demand
+                     * scaled by it. */
+                    ulInfeasible = ( uint32_t ) prvMulDiv( xReport.ullMissTime, edfanalysisSCALING_ONE, xReport.ullDemand, 0 ) + 1UL;
+                    xAnalysis.ulScaling = ulInfeasible - 1UL;
+                }
+                else
+                {
+                    xAnalysis.ulScaling = ulFeasible + ( ( ulInfeasible - ulFeasible ) / 2UL );
+                }
+
+                break;
+
+            default:
+                eReturn = eEDFAnalysisUndecided;
+                ulInfeasible = xAnalysis.ulScaling;
+                xAnalysis.ulScaling = ulFeasible + ( ( ulInfeasible - ulFeasible ) / 2UL );
+                break;
+        }
+    }
+
+    *pulScaling = ulFeasible;
+
+    return eReturn;
+}
+/*-----------------------------------------------------------*/
+
+eEDFAnalysisResult eEDFAnalysisResponseTime( const EDFAnalysisTaskSet_t * const pxTaskSet,
+                                             size_t uxTask,
+                                             uint64_t * const pullResponseTime )
+{
+    EDFAnalysis_t xAnalysis = { pxTaskSet, edfanalysisSCALING_ONE, 0UL };
+    EDFAnalysisTask_t xTarget, xTask;
+    uint64_t ullUtilisationLow, ullUtilisationHigh, ullBlocking = 0U, ullBusyPeriod = 0U, ullNext, ullRelease, ullDeadline, ullCompletion, ullWork;
+    uint32_t ulTaskBlocking;
+    size_t uxIndex;
+
+    *pullResponseTime = 0U;
+
+    /* The task set is read in order, even for a single task. */
+    for( uxIndex = 0; uxIndex <= uxTask; uxIndex++ )
+    {
+        if( prvReadTask( pxTaskSet, uxIndex, &xTarget ) == 0 )
+        {
+            return eEDFAnalysisUndecided;
+        }
+    }
+
+    if( xTarget.ulWcet == 0UL )
+    {
+        return eEDFAnalysisFeasible;
+    }
+
+    if( xTarget.ulPeriod == 0UL )
+    {
+        return eEDFAnalysisUndecided;
+    }
+
+    /* Length of the longest busy period, which can start with the longest
+     * blocking by any task. */
+    for( uxIndex = 0; prvReadTask( pxTaskSet, uxIndex, &xTask ) != 0; uxIndex++ )
+    {
+        ulTaskBlocking = xTask.ulNonPreemptive;
+
+        if( ( xTask.ulPreemptionThreshold != 0UL ) && ( xTask.ulPreemptionThreshold < xTask.ulDeadline ) && ( xTask.ulWcet > ulTaskBlocking ) )
+        {
+            ulTaskBlocking = xTask.ulWcet;
+        }
+
+        if( ulTaskBlocking > ullBlocking )
+        {
+            ullBlocking = ulTaskBlocking;
+        }
+
+        ullBusyPeriod += xTask.ulWcet;
+    }
+
+    ullBusyPeriod += ullBlocking;
+
+    /* The busy period does not end if the utilisation exceeds 1, or may be
+     * 1 and it starts with blocking. */
+    if( ( prvUtilisation( pxTaskSet, &ullUtilisationLow, &ullUtilisationHigh ) == 0 ) ||
+        ( ullUtilisationLow > edfanalysisUTILISATION_ONE ) ||
+        ( ( ullUtilisationHigh >= edfanalysisUTILISATION_ONE ) && ( ullBlocking != 0U ) ) )
+    {
+        return eEDFAnalysisUndecided;
+    }
+
+    for( ; ; )
+    {
+        if( ( ullBusyPeriod > edfanalysisMAX_HORIZON ) || ( prvStep( &xAnalysis ) == 0 ) )
+        {
+            return eEDFAnalysisUndecided;
+        }
+
+        ullNext = ullBlocking;
+
+        for( uxIndex = 0; prvReadTask( pxTaskSet, uxIndex, &xTask ) != 0; uxIndex++ )
+        {
+            if( xTask.ulPeriod != 0UL )
+            {
+                ullNext += ( ( ullBusyPeriod + xTask.ulPeriod - 1U ) / xTask.ulPeriod ) * xTask.ulWcet;
+            }
+        }
+
+        if( ullNext == ullBusyPeriod )
+        {
+            break;
+        }
+
+        ullBusyPeriod = ullNext;
+    }
+
+    /* The job released at offset a in the busy period, due at a + D, can be
+     * the last to complete only if some job is due exactly then.  Its
+     * completion time is found by iterating until the work released before
+     * it, and due no later than it, all completes.  It completes within the
+     * busy period, so once the busy period ends less than the longest
+     * response time found after the release no later job can take longer. */
+    *pullResponseTime = xTarget.ulWcet;
+
+    for( ullRelease = 0U; ( ullRelease + *pullResponseTime ) < ullBusyPeriod; ullRelease = prvDeadlineAfter( pxTaskSet, ullDeadline ) - xTarget.ulDeadline )
+    {
+        ullDeadline = ullRelease + xTarget.ulDeadline;
+        ullWork = prvBlocking( pxTaskSet, ullDeadline ) + ( ( ( ullRelease / xTarget.ulPeriod ) + 1U ) * xTarget.ulWcet );
+        ullCompletion = ullWork;
+
+        for( ; ; )
+        {
+            if( prvStep( &xAnalysis ) == 0 )
+            {
+                return eEDFAnalysisUndecided;
+            }
+
+            ullNext = ullWork;
+
+            for( uxIndex = 0; prvReadTask( pxTaskSet, uxIndex, &xTask ) != 0; uxIndex++ )
+            {
+                if( ( uxIndex != uxTask ) && ( xTask.ulWcet != 0UL ) && ( xTask.ulPeriod != 0UL ) && ( xTask.ulDeadline <= ullDeadline ) )
+                {
+                    const uint64_t ullReleased = ( ullCompletion + xTask.ulPeriod - 1U ) / xTask.ulPeriod;
+                    const uint64_t ullDue = ( ( ullDeadline - xTask.ulDeadline ) / xTask.ulPeriod ) + 1U;
+
+                    ullNext += ( ( ullReleased < ullDue ) ? ullReleased : ullDue ) * xTask.ulWcet;
+                }
+            }
+
+            if( ullNext == ullCompletion )
+            {
+                break;
+            }
+
+            ullCompletion = ullNext;
+        }
+
+        /* The jobs due no later than it may all complete before it is even
+         * released, in which case it runs alone and takes its WCET. */
+        if( ( ullCompletion > ullRelease ) && ( ( ullCompletion - ullRelease ) > *pullResponseTime ) )
+        {
+            *pullResponseTime = ullCompletion - ullRelease;
+        }
+    }
+
+    return ( *pullResponseTime <= xTarget.ulDeadline ) ? eEDFAnalysisFeasible : eEDFAnalysisInfeasible;
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,204 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - EDF schedulability analysis
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Schedulability analysis of a set of sporadic tasks under preemptive EDF on
+ * one processor.  Every task releases jobs at least its period apart, each
+ * executing for at most its WCET and due its relative deadline after its
+ * release.  A task can also run for part of its job without being
+ * preemptable, which blocks jobs with earlier deadlines.
+ *
+ * The task set is feasible if, for every interval starting with the
+ * synchronous release of every task, the execution time of the jobs released
+ * and due within the interval plus the longest blocking by a job due after it
+ * never exceeds the length of the interval.  Only intervals ending at an
+ * absolute deadline, and no longer than the busy period or the bound of
+ * Zhang and Burns, are checked.  eEDFAnalysisDemandTest() checks every one of
+ * them in turn.  eEDFAnalysisQPATest() runs Quick Processor-demand Analysis,
+ * which walks backwards from the bound and skips the deadlines at which the
+ * demand is known to fit, so its cost barely depends on the hyperperiod.  Both
+ * tests give the same answer.
+ *
+ * The analysis only uses integer arithmetic and depends on nothing but the C
+ * library headers, so the same code decides admission in the kernel, when
+ * configUSE_EDF_ADMISSION_CONTROL is 1, and runs on the host in
+ * Tools/edf_analyze.c.  Times are in ticks.  The intervals checked are
+ * limited to edfanalysisMAX_HORIZON ticks, which keeps every intermediate
+ * result within 64 bits.
+ */
+
+#ifndef INC_EDF_ANALYSIS_H
+#define INC_EDF_ANALYSIS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/* Longest interval, in ticks, the analysis checks.  A task set whose bound is
+ * longer can only be decided if its busy period is shorter. */
+#define edfanalysisMAX_HORIZON    ( ( uint64_t ) 1U << 40 )
+
+/* Scaling factor of 1, in the units of eEDFAnalysisScalingFactor(). */
+#define edfanalysisSCALING_ONE    ( ( uint32_t ) 1000000UL )
+
+/* Result of an analysis. */
+typedef enum
+{
+    eEDFAnalysisFeasible = 0, /* Every job meets its deadline. */
+    eEDFAnalysisInfeasible,   /* A job can miss its deadline. */
+    eEDFAnalysisUndecided     /* The analysis needed more steps than allowed, or an interval longer than edfanalysisMAX_HORIZON. */
+} eEDFAnalysisResult;
+
+/* Timing parameters of one task. */
+typedef struct xEDF_ANALYSIS_TASK
+{
+    uint32_t ulPeriod;              /*< Shortest time between the releases of two jobs.  A task with a period of 0 is infeasible unless its WCET is 0, in which case it is ignored. */
+    uint32_t ulDeadline;            /*< Relative deadline, or 0 if it is the period.  Can be longer than the period. */
+    uint32_t ulWcet;                /*< Worst case execution time of a job. */
+    uint32_t ulNonPreemptive;       /*< Longest time a job runs without being preemptable, which blocks jobs with shorter relative deadlines. */
+    uint32_t ulPreemptionThreshold; /*< Shortest relative deadline of the tasks that cannot preempt a started job of the task, which are then blocked for its whole WCET.  0 if every task with a shorter relative deadline can preempt it. */
+} EDFAnalysisTask_t;
+
+/* Reads the task with index uxIndex into *pxTask and returns 1, or returns 0
+ * if the task set has fewer tasks.  The analysis reads the task set many
+ * times, always with uxIndex counting up from 0 by one, so a task set kept in
+ * a linked list can be walked with a cursor held in pvContext. */
+typedef int32_t ( * EDFAnalysisReadTask_t )( void * pvContext,
+                                             size_t uxIndex,
+                                             EDFAnalysisTask_t * pxTask );
+
+/* The task set to analyse, given either as an array or through a function
+ * that reads one task at a time. */
+typedef struct xEDF_ANALYSIS_TASK_SET
+{
+    const EDFAnalysisTask_t * pxTasks; /*< Array of uxTaskCount tasks, or NULL to read the tasks with pxReadTask. */
+    size_t uxTaskCount;                /*< Number of tasks in pxTasks. */
+    EDFAnalysisReadTask_t pxReadTask;  /*< Function reading the tasks when pxTasks is NULL. */
+    void * pvContext;                  /*< Passed to pxReadTask. */
+    uint32_t ulMaxSteps;               /*< Largest number of times one test evaluates the demand of the task set, each of which reads every task, before giving up.  0 for no limit. */
+} EDFAnalysisTaskSet_t;
+
+/* Used with the feasibility tests to return the details of the analysis. */
+typedef struct xEDF_ANALYSIS_REPORT
+{
+    uint64_t ullBound;    /*< Length of the longest interval checked. */
+    uint64_t ullMissTime; /*< If the task set is infeasible, the length of an interval in which the demand exceeds the time available.  0 if the utilisation exceeds 1, in which case the demand exceeds the time available in every long enough interval. */
+    uint64_t ullDemand;   /*< Demand, including blocking, in the interval of length ullMissTime. */
+    uint32_t ulSteps;     /*< Number of times the demand of the task set was evaluated. */
+} EDFAnalysisReport_t;
+
+/**
+ * edf_analysis. h
+ * <pre>
+ * eEDFAnalysisResult eEDFAnalysisDemandTest( const EDFAnalysisTaskSet_t * const pxTaskSet, EDFAnalysisReport_t * const pxReport );
+ * </pre>
+ *
+ * Decide whether pxTaskSet is feasible by comparing the demand with the time
+ * available at every absolute deadline up to the bound, in increasing order.
+ * If the task set is infeasible, the shortest interval in which the demand
+ * exceeds the time available is reported.
+ *
+ * @param pxReport Populated with the details of the analysis unless NULL.
+ */
+eEDFAnalysisResult eEDFAnalysisDemandTest( const EDFAnalysisTaskSet_t * const pxTaskSet,
+                                           EDFAnalysisReport_t * const pxReport );
+
+/**
+ * edf_analysis. h
+ * <pre>
+ * eEDFAnalysisResult eEDFAnalysisQPATest( const EDFAnalysisTaskSet_t * const pxTaskSet, EDFAnalysisReport_t * const pxReport );
+ * </pre>
+ *
+ * Decide whether pxTaskSet is feasible with Quick Processor-demand Analysis.
+ * Gives the same result as eEDFAnalysisDemandTest() in far fewer steps, but
+ * the interval reported for an infeasible task set is not necessarily the
+ * shortest in which the demand exceeds the time available.
+ *
+ * @param pxReport Populated with the details of the analysis unless NULL.
+ */
+eEDFAnalysisResult eEDFAnalysisQPATest( const EDFAnalysisTaskSet_t * const pxTaskSet,
+                                        EDFAnalysisReport_t * const pxReport );
+
+/**
+ * edf_analysis. h
+ * <pre>
+ * eEDFAnalysisResult eEDFAnalysisScalingFactor( const EDFAnalysisTaskSet_t * const pxTaskSet, uint32_t * const pulScaling );
+ * </pre>
+ *
+ * Find the critical scaling factor of pxTaskSet: the largest factor by which
+ * the WCET and non-preemptive time of every task can be multiplied with the
+ * task set remaining feasible.  A factor below 1 means the task set is
+ * infeasible, and its reciprocal is the processor speed the task set needs.
+ *
+ * @param pulScaling Set to the factor in units of 1 / edfanalysisSCALING_ONE,
+ * rounded down and at most 1000 * edfanalysisSCALING_ONE.
+ *
+ * @return eEDFAnalysisFeasible if the factor was found, or
+ * eEDFAnalysisUndecided if a factor could not be decided, in which case
+ * *pulScaling is only a lower bound.
+ */
+eEDFAnalysisResult eEDFAnalysisScalingFactor( const EDFAnalysisTaskSet_t * const pxTaskSet,
+                                              uint32_t * const pulScaling );
+
+/**
+ * edf_analysis. h
+ * <pre>
+ * eEDFAnalysisResult eEDFAnalysisResponseTime( const EDFAnalysisTaskSet_t * const pxTaskSet, size_t uxTask, uint64_t * const pullResponseTime );
+ * </pre>
+ *
+ * Compute the worst case response time of the task with index uxTask with the
+ * analysis of Spuri, which examines the job of the task released at every
+ * offset within the busy period at which it can be the last job to complete.
+ * The response time is valid whether or not the task set is feasible, but the
+ * cost of the analysis grows with the length of the busy period.
+ *
+ * @param pullResponseTime Set to the worst case time between the release of a
+ * job of the task and its completion.
+ *
+ * @return eEDFAnalysisFeasible if the response time does not exceed the
+ * relative deadline of the task, eEDFAnalysisInfeasible if it does, or
+ * eEDFAnalysisUndecided if the busy period does not end, which needs a
+ * utilisation above 1 or of 1 with blocking, or the analysis needed too many
+ * steps.
+ */
+eEDFAnalysisResult eEDFAnalysisResponseTime( const EDFAnalysisTaskSet_t * const pxTaskSet,
+                                             size_t uxTask,
+                                             uint64_t * const pullResponseTime );
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* INC_EDF_ANALYSIS_H */
@@ -0,0 +1,652 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - EDF timer service
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "edf.h"
+#include "edf_timers.h"
+
+#if ( configUSE_EDF_TIMERS == 1 )
+
+/* Commands sent to the timer service task. */
+#define edftimersCOMMAND_START     ( ( BaseType_t ) 0 )
+#define edftimersCOMMAND_STOP      ( ( BaseType_t ) 1 )
+#define edftimersCOMMAND_DELETE    ( ( BaseType_t ) 2 )
+
+/* Relative deadline the timer service task is admitted with. */
+#if ( configEDF_TIMER_TASK_DEADLINE != 0 )
+    #define edftimersTASK_DEADLINE    ( ( TickType_t ) configEDF_TIMER_TASK_DEADLINE )
+#else
+    #define edftimersTASK_DEADLINE    ( ( TickType_t ) configEDF_TIMER_TASK_PERIOD )
+#endif
+
+/* The definition of the timers themselves. */
+typedef struct xEDF_TIMER
+{
+    const char * pcTimerName;                      /*< Text name.  This is not used by the kernel, it is included simply to make debugging easier. */ /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+    ListItem_t xTimerListItem;                     /*< Holds the expiry time in the active timer lists, or the deadline of the callback in the pending list. */
+    TickType_t xPeriod;                            /*< How quickly and often the timer expires. */
+    TickType_t xRelativeDeadline;                  /*< Ticks after each expiry by which the callback must complete. */
+    TickType_t xCallbackWcet;                      /*< Worst case execution time of the callback in ticks. */
+    TickType_t xExpiryTime;                        /*< The next expiry of an active timer, or the expiry that made its callback pending. */
+    void * pvTimerID;                              /*< An ID to identify the timer. */
+    EDFTimerCallbackFunction_t pxCallbackFunction; /*< The function that will be called when the timer expires. */
+    BaseType_t xAutoReload;                        /*< pdTRUE if the timer restarts itself each time it expires. */
+} EDFTimer_t;
+
+/* The messages sent to the timer service task through its command queue. */
+typedef struct xEDF_TIMER_COMMAND
+{
+    BaseType_t xCommandID;   /*< One of the edftimersCOMMAND_ values. */
+    TickType_t xTimeIssued;  /*< Tick count at which the command was sent. */
+    EDFTimer_t * pxTimer;    /*< The timer the command applies to. */
+} EDFTimerCommand_t;
+
+/* The active timers sorted by expiry time.  Timers expiring after the tick
+ * count overflows are kept in the overflow list, as with the delayed tasks. */
+PRIVILEGED_DATA static List_t xActiveTimerList1;
+PRIVILEGED_DATA static List_t xActiveTimerList2;
+PRIVILEGED_DATA static List_t * pxCurrentTimerList;
+PRIVILEGED_DATA static List_t * pxOverflowTimerList;
+
+/* Expired timers whose callback has not run yet, sorted by deadline. */
+PRIVILEGED_DATA static List_t xPendingTimerList;
+
+PRIVILEGED_DATA static QueueHandle_t xTimerCommandQueue = NULL;
+PRIVILEGED_DATA static TaskHandle_t xTimerTaskHandle = NULL;
+
+/* The timer whose callback is running, NULL if none is. */
+PRIVILEGED_DATA static EDFTimer_t * volatile pxRunningTimer = NULL;
+
+/* The sum of the WCET of the callbacks of the timers that exist, which is at
+ * most configEDF_TIMER_TASK_WCET when that is not 0. */
+PRIVILEGED_DATA static TickType_t xCallbackDemand = ( TickType_t ) 0U;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The timer service task.  Runs the pending callbacks in deadline order and
+ * processes the commands sent to it.
+ */
+static portTASK_FUNCTION_PROTO( prvEDFTimerTask, pvParameters ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the current tick count.  If the tick count overflowed since the
+ * last call every timer in the current list has expired, so they are made
+ * pending before the current and overflow lists are swapped.
+ */
+static TickType_t prvEDFTimerSampleTime( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Adds pxTimer, started or reloaded at xCommandTime, to the active timer list
+ * it expires in, or makes its callback pending if it has already expired.
+ */
+static void prvEDFTimerInsertActive( EDFTimer_t * const pxTimer,
+                                     TickType_t xTimeNow,
+                                     TickType_t xCommandTime ) PRIVILEGED_FUNCTION;
+
+/*
+ * Makes the callback of the expired timer pxTimer pending.
+ */
+static void prvEDFTimerMakePending( EDFTimer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Makes the callbacks of every timer of the current list that expired by
+ * xTimeNow pending.
+ */
+static void prvEDFTimerMoveExpired( TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+/*
+ * Processes every command waiting in the command queue.
+ */
+static void prvEDFTimerProcessCommands( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Runs the pending callback with the earliest deadline and reloads its timer.
+ */
+static void prvEDFTimerRunCallback( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Blocks the timer service task until the next timer expires or a command is
+ * sent, releasing the next job with the deadline of the callbacks that become
+ * pending then.
+ */
+static void prvEDFTimerWait( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Sends a command for pxTimer to the timer service task.
+ */
+static BaseType_t prvEDFTimerSendCommand( EDFTimer_t * const pxTimer,
+                                          BaseType_t xCommandID,
+                                          TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+BaseType_t xEDFTimerServiceStart( void )
+{
+    PeriodicTaskParameters_t xTaskDefinition;
+    BaseType_t xReturn = pdFAIL;
+
+    configASSERT( xTimerCommandQueue == NULL );
+
+    vListInitialise( &xActiveTimerList1 );
+    vListInitialise( &xActiveTimerList2 );
+    vListInitialise( &xPendingTimerList );
+    pxCurrentTimerList = &xActiveTimerList1;
+    pxOverflowTimerList = &xActiveTimerList2;
+
+    xTimerCommandQueue = xQueueCreate( ( UBaseType_t ) configEDF_TIMER_QUEUE_LENGTH, ( UBaseType_t ) sizeof( EDFTimerCommand_t ) );
+
+    if( xTimerCommandQueue != NULL )
+    {
+        ( void ) memset( &xTaskDefinition, 0x00, sizeof( xTaskDefinition ) );
+        xTaskDefinition.pvTaskCode = prvEDFTimerTask;
+        xTaskDefinition.pcName = "EDFTmr Svc";
+        xTaskDefinition.usStackDepth = ( configSTACK_DEPTH_TYPE ) configEDF_TIMER_TASK_STACK_DEPTH;
+        xTaskDefinition.pvParameters = NULL;
+        xTaskDefinition.uxPriority = ( UBaseType_t ) ( configMAX_PRIORITIES - 1 );
+        xTaskDefinition.xPeriod = ( TickType_t ) configEDF_TIMER_TASK_PERIOD;
+        xTaskDefinition.xWcet = ( TickType_t ) configEDF_TIMER_TASK_WCET;
+        xTaskDefinition.xDeadline = ( TickType_t ) configEDF_TIMER_TASK_DEADLINE;
+
+        xReturn = xTaskPeriodicCreateFromParameters( &xTaskDefinition, &xTimerTaskHandle );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    configASSERT( xReturn == pdPASS );
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+EDFTimerHandle_t xEDFTimerCreate( const char * const pcTimerName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                  TickType_t xPeriod,
+                                  TickType_t xRelativeDeadline,
+                                  TickType_t xCallbackWcet,
+                                  BaseType_t xAutoReload,
+                                  void * const pvTimerID,
+                                  EDFTimerCallbackFunction_t pxCallbackFunction )
+{
+    EDFTimer_t * pxNewTimer = NULL;
+    BaseType_t xAdmitted = pdTRUE;
+
+    /* 0 is not a valid value for xPeriod. */
+    configASSERT( ( xPeriod > 0 ) );
+
+    #if ( configEDF_TIMER_TASK_WCET != 0 )
+        {
+            taskENTER_CRITICAL();
+            {
+                /* Admission control only guarantees the timer service task
+                 * its own relative deadline, and its WCET once per period.
+                 * A timer expiring more often than that, or with a callback
+                 * due any earlier or longer than what is left of the WCET,
+                 * could miss its deadlines. */
+                if( ( xRelativeDeadline < edftimersTASK_DEADLINE ) ||
+                    ( xPeriod < ( TickType_t ) configEDF_TIMER_TASK_PERIOD ) ||
+                    ( xCallbackWcet > ( ( TickType_t ) configEDF_TIMER_TASK_WCET - xCallbackDemand ) ) )
+                {
+                    xAdmitted = pdFALSE;
+                }
+                else
+                {
+                    xCallbackDemand += xCallbackWcet;
+                }
+            }
+            taskEXIT_CRITICAL();
+        }
+    #endif /* configEDF_TIMER_TASK_WCET */
+
+    if( xAdmitted != pdFALSE )
+    {
+        pxNewTimer = ( EDFTimer_t * ) pvPortMalloc( sizeof( EDFTimer_t ) ); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack, and the first member of EDFTimer_t is always a pointer to the timer's name. */
+
+        #if ( configEDF_TIMER_TASK_WCET != 0 )
+            if( pxNewTimer == NULL )
+            {
+                taskENTER_CRITICAL();
+                {
+                    xCallbackDemand -= xCallbackWcet;
+                }
+                taskEXIT_CRITICAL();
+            }
+        #endif
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    if( pxNewTimer != NULL )
+    {
+        pxNewTimer->pcTimerName = pcTimerName;
+        pxNewTimer->xPeriod = xPeriod;
+        pxNewTimer->xRelativeDeadline = xRelativeDeadline;
+        pxNewTimer->xCallbackWcet = xCallbackWcet;
+        pxNewTimer->xExpiryTime = ( TickType_t ) 0U;
+        pxNewTimer->pvTimerID = pvTimerID;
+        pxNewTimer->pxCallbackFunction = pxCallbackFunction;
+        pxNewTimer->xAutoReload = xAutoReload;
+        vListInitialiseItem( &( pxNewTimer->xTimerListItem ) );
+        listSET_LIST_ITEM_OWNER( &( pxNewTimer->xTimerListItem ), pxNewTimer );
+    }
+
+    return pxNewTimer;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xEDFTimerStart( EDFTimerHandle_t xTimer,
+                           TickType_t xTicksToWait )
+{
+    return prvEDFTimerSendCommand( xTimer, edftimersCOMMAND_START, xTicksToWait );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xEDFTimerStartFromISR( EDFTimerHandle_t xTimer,
+                                  BaseType_t * pxHigherPriorityTaskWoken )
+{
+    EDFTimerCommand_t xCommand;
+
+    configASSERT( xTimer );
+    configASSERT( xTimerCommandQueue );
+
+    xCommand.xCommandID = edftimersCOMMAND_START;
+    xCommand.xTimeIssued = xTaskGetTickCountFromISR();
+    xCommand.pxTimer = xTimer;
+
+    return xQueueSendToBackFromISR( xTimerCommandQueue, &xCommand, pxHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xEDFTimerStop( EDFTimerHandle_t xTimer,
+                          TickType_t xTicksToWait )
+{
+    return prvEDFTimerSendCommand( xTimer, edftimersCOMMAND_STOP, xTicksToWait );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xEDFTimerDelete( EDFTimerHandle_t xTimer,
+                            TickType_t xTicksToWait )
+{
+    return prvEDFTimerSendCommand( xTimer, edftimersCOMMAND_DELETE, xTicksToWait );
+}
+/*-----------------------------------------------------------*/
+
+void * pvEDFTimerGetTimerID( EDFTimerHandle_t xTimer )
+{
+    configASSERT( xTimer );
+
+    return xTimer->pvTimerID;
+}
+/*-----------------------------------------------------------*/
+
+TickType_t xEDFTimerGetExpiryTime( EDFTimerHandle_t xTimer )
+{
+    configASSERT( xTimer );
+
+    return xTimer->xExpiryTime;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xEDFTimerIsTimerActive( EDFTimerHandle_t xTimer )
+{
+    BaseType_t xReturn;
+
+    configASSERT( xTimer );
+
+    taskENTER_CRITICAL();
+    {
+        /* A timer whose callback is running is only active if it reloads. */
+        if( listLIST_ITEM_CONTAINER( &( xTimer->xTimerListItem ) ) != NULL )
+        {
+            xReturn = pdTRUE;
+        }
+        else if( ( xTimer == pxRunningTimer ) && ( xTimer->xAutoReload != pdFALSE ) )
+        {
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvEDFTimerSendCommand( EDFTimer_t * const pxTimer,
+                                          BaseType_t xCommandID,
+                                          TickType_t xTicksToWait )
+{
+    EDFTimerCommand_t xCommand;
+
+    configASSERT( pxTimer );
+    configASSERT( xTimerCommandQueue );
+
+    xCommand.xCommandID = xCommandID;
+    xCommand.xTimeIssued = xTaskGetTickCount();
+    xCommand.pxTimer = pxTimer;
+
+    /* The caller cannot block before the scheduler is started. */
+    if( xTaskGetSchedulerState() != taskSCHEDULER_RUNNING )
+    {
+        xTicksToWait = ( TickType_t ) 0U;
+    }
+
+    return xQueueSendToBack( xTimerCommandQueue, &xCommand, xTicksToWait );
+}
+/*-----------------------------------------------------------*/
+
+static portTASK_FUNCTION( prvEDFTimerTask, pvParameters )
+{
+    TickType_t xTimeNow, xDeadline;
+    BaseType_t xCommandsWaiting;
+
+    /* Just to avoid compiler warnings. */
+    ( void ) pvParameters;
+
+    for( ; ; )
+    {
+        xTimeNow = prvEDFTimerSampleTime();
+        prvEDFTimerMoveExpired( xTimeNow );
+
+        xCommandsWaiting = ( uxQueueMessagesWaiting( xTimerCommandQueue ) != ( UBaseType_t ) 0 ) ? pdTRUE : pdFALSE;
+
+        if( ( xCommandsWaiting != pdFALSE ) || ( listLIST_IS_EMPTY( &xPendingTimerList ) == pdFALSE ) )
+        {
+            /* The job runs by the earliest deadline of the work it has to do.
+             * Commands are due one period after the task notices them. */
+            xDeadline = portMAX_DELAY;
+
+            if( listLIST_IS_EMPTY( &xPendingTimerList ) == pdFALSE )
+            {
+                xDeadline = listGET_ITEM_VALUE_OF_HEAD_ENTRY( &xPendingTimerList );
+            }
+
+            if( ( xCommandsWaiting != pdFALSE ) && ( ( xTimeNow + ( TickType_t ) configEDF_TIMER_TASK_PERIOD ) < xDeadline ) )
+            {
+                xDeadline = xTimeNow + ( TickType_t ) configEDF_TIMER_TASK_PERIOD;
+            }
+
+            vTaskSetDeadline( xDeadline );
+
+            /* Commands go first, as they can stop a pending callback. */
+            if( xCommandsWaiting != pdFALSE )
+            {
+                prvEDFTimerProcessCommands();
+            }
+            else
+            {
+                prvEDFTimerRunCallback();
+            }
+        }
+        else
+        {
+            prvEDFTimerWait();
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t prvEDFTimerSampleTime( void )
+{
+    TickType_t xTimeNow;
+    List_t * pxTemp;
+    PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U; /*lint !e956 Variable is only accessible to one task. */
+
+    xTimeNow = xTaskGetTickCount();
+
+    if( xTimeNow < xLastTime )
+    {
+        /* The tick count overflowed, so every timer left in the current list
+         * expired before the overflow. */
+        while( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
+        {
+            EDFTimer_t * const pxTimer = ( EDFTimer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+            ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+            prvEDFTimerMakePending( pxTimer );
+        }
+
+        pxTemp = pxCurrentTimerList;
+        pxCurrentTimerList = pxOverflowTimerList;
+        pxOverflowTimerList = pxTemp;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    xLastTime = xTimeNow;
+
+    return xTimeNow;
+}
+/*-----------------------------------------------------------*/
+
+static void prvEDFTimerInsertActive( EDFTimer_t * const pxTimer,
+                                     TickType_t xTimeNow,
+                                     TickType_t xCommandTime )
+{
+    const TickType_t xExpiryTime = pxTimer->xExpiryTime;
+
+    listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xExpiryTime );
+
+    if( xExpiryTime <= xTimeNow )
+    {
+        /* Has the expiry time elapsed between the command to start/reset the
+         * timer being issued, and the time the command was processed? */
+        if( ( ( TickType_t ) ( xTimeNow - xCommandTime ) ) >= pxTimer->xPeriod ) /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+        {
+            prvEDFTimerMakePending( pxTimer );
+        }
+        else
+        {
+            /* The expiry time overflowed the tick count. */
+            vListInsert( pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+        }
+    }
+    else
+    {
+        if( ( xTimeNow < xCommandTime ) && ( xExpiryTime >= xCommandTime ) )
+        {
+            /* The tick count overflowed since the command was issued, but the
+             * expiry time did not, so the timer must have already expired. */
+            prvEDFTimerMakePending( pxTimer );
+        }
+        else
+        {
+            vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvEDFTimerMakePending( EDFTimer_t * const pxTimer )
+{
+    /* The callbacks are ordered by the deadline of the expiry. */
+    listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), pxTimer->xExpiryTime + pxTimer->xRelativeDeadline );
+    vListInsert( &xPendingTimerList, &( pxTimer->xTimerListItem ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEDFTimerMoveExpired( TickType_t xTimeNow )
+{
+    EDFTimer_t * pxTimer;
+
+    while( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
+    {
+        if( listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList ) > xTimeNow )
+        {
+            break;
+        }
+
+        pxTimer = ( EDFTimer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+        ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+        prvEDFTimerMakePending( pxTimer );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvEDFTimerProcessCommands( void )
+{
+    EDFTimerCommand_t xCommand;
+    EDFTimer_t * pxTimer;
+    TickType_t xTimeNow;
+
+    while( xQueueReceive( xTimerCommandQueue, &xCommand, ( TickType_t ) 0U ) != pdFAIL )
+    {
+        pxTimer = xCommand.pxTimer;
+
+        /* Every command takes the timer out of the list it is in. */
+        if( listLIST_ITEM_CONTAINER( &( pxTimer->xTimerListItem ) ) != NULL )
+        {
+            ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        switch( xCommand.xCommandID )
+        {
+            case edftimersCOMMAND_START:
+                /* Sampled per command as a command can make lists switch. */
+                xTimeNow = prvEDFTimerSampleTime();
+                pxTimer->xExpiryTime = xCommand.xTimeIssued + pxTimer->xPeriod;
+                prvEDFTimerInsertActive( pxTimer, xTimeNow, xCommand.xTimeIssued );
+                break;
+
+            case edftimersCOMMAND_STOP:
+                /* The timer has already been removed from the lists. */
+                break;
+
+            case edftimersCOMMAND_DELETE:
+                taskENTER_CRITICAL();
+                {
+                    xCallbackDemand -= pxTimer->xCallbackWcet;
+                }
+                taskEXIT_CRITICAL();
+
+                vPortFree( pxTimer );
+                break;
+
+            default:
+                /* Don't expect to get here. */
+                break;
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvEDFTimerRunCallback( void )
+{
+    EDFTimer_t * const pxTimer = ( EDFTimer_t * ) listGET_OWNER_OF_HEAD_ENTRY( &xPendingTimerList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+    ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+
+    pxRunningTimer = pxTimer;
+    pxTimer->pxCallbackFunction( ( EDFTimerHandle_t ) pxTimer );
+    pxRunningTimer = NULL;
+
+    if( pxTimer->xAutoReload != pdFALSE )
+    {
+        /* Reload relative to the expiry, so the timer does not drift however
+         * late the callback ran. */
+        pxTimer->xExpiryTime += pxTimer->xPeriod;
+        prvEDFTimerInsertActive( pxTimer, prvEDFTimerSampleTime(), pxTimer->xExpiryTime - pxTimer->xPeriod );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvEDFTimerWait( void )
+{
+    EDFTimerCommand_t xCommand;
+    const ListItem_t * pxItem;
+    TickType_t xTimeNow, xNextExpiryTime, xDeadline;
+    TickType_t xTicksToWait = portMAX_DELAY;
+    TickType_t xWakeDeadline = portMAX_DELAY;
+
+    xTimeNow = xTaskGetTickCount();
+
+    if( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
+    {
+        /* Every timer expiring together becomes pending together, so the
+         * next job is due by the earliest of their deadlines. */
+        xNextExpiryTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+
+        for( pxItem = listGET_HEAD_ENTRY( pxCurrentTimerList );
+             ( pxItem != listGET_END_MARKER( pxCurrentTimerList ) ) && ( listGET_LIST_ITEM_VALUE( pxItem ) == xNextExpiryTime );
+             pxItem = listGET_NEXT( pxItem ) )
+        {
+            xDeadline = xNextExpiryTime + ( ( EDFTimer_t * ) listGET_LIST_ITEM_OWNER( pxItem ) )->xRelativeDeadline; /*lint !e9087 !e9079 The owner of every item in the timer lists is a timer. */
+
+            if( xDeadline < xWakeDeadline )
+            {
+                xWakeDeadline = xDeadline;
+            }
+        }
+
+        xTicksToWait = ( xNextExpiryTime > xTimeNow ) ? ( xNextExpiryTime - xTimeNow ) : ( TickType_t ) 0U;
+    }
+    else if( listLIST_IS_EMPTY( pxOverflowTimerList ) == pdFALSE )
+    {
+        /* Wake when the tick count overflows, so the lists are switched. */
+        xTicksToWait = ( TickType_t ) 0U - xTimeNow;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    if( xWakeDeadline == portMAX_DELAY )
+    {
+        /* Woken by a command, or to switch lists, so the job is due one
+         * period after its release. */
+        xWakeDeadline = xTimeNow;
+    }
+
+    vTaskSetWakeDeadline( xWakeDeadline );
+
+    /* The command stays in the queue to be processed once the task runs. */
+    ( void ) xQueuePeek( xTimerCommandQueue, &xCommand, xTicksToWait );
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_EDF_TIMERS */
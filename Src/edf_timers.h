@@ -0,0 +1,231 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - EDF timer service
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Software timers whose callbacks are scheduled by deadline.  Every timer has
+ * a relative deadline besides its period: the callback of a timer that
+ * expires at time t must complete by t plus its relative deadline.  The
+ * callbacks run in the timer service task, which always takes the deadline of
+ * the earliest pending callback, so a short deadline timer no longer waits
+ * behind unrelated jobs with earlier deadlines than the period of the task.
+ * Pending callbacks run in deadline order.
+ *
+ * Active timers are kept in a pair of lists sorted by expiry time, one for
+ * the current tick count period and one for after the tick count overflows,
+ * in the same way the kernel keeps its delayed tasks.
+ *
+ * Timers are controlled through commands sent to the timer service task, as
+ * with the standard FreeRTOS timers.  Callbacks run on the stack of the timer
+ * service task and must not block.
+ */
+
+#ifndef INC_EDF_TIMERS_H
+#define INC_EDF_TIMERS_H
+
+#ifndef INC_EDF_H
+    #error "include FreeRTOS.h, task.h and edf.h must appear in source files before include edf_timers.h"
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/* Stack size of the timer service task in words. */
+#ifndef configEDF_TIMER_TASK_STACK_DEPTH
+    #define configEDF_TIMER_TASK_STACK_DEPTH    configMINIMAL_STACK_SIZE
+#endif
+
+/* Period of the timer service task in ticks.  It is the relative deadline of
+ * the commands the task processes while no callback is pending, and the
+ * shortest period of any timer when configEDF_TIMER_TASK_WCET is not 0. */
+#ifndef configEDF_TIMER_TASK_PERIOD
+    #define configEDF_TIMER_TASK_PERIOD    100
+#endif
+
+/* WCET of the timer service task in ticks, covering every callback that can
+ * become pending within one period.  xEDFTimerCreate() rejects a timer whose
+ * callback does not fit in what the other timers leave of it.  0 if not
+ * accounted for by admission control. */
+#ifndef configEDF_TIMER_TASK_WCET
+    #define configEDF_TIMER_TASK_WCET    0
+#endif
+
+/* Relative deadline in ticks the timer service task is admitted with, at most
+ * its period.  A callback can be due as soon as this after its expiry, so it
+ * must be the shortest relative deadline of any timer.  0 for the period. */
+#ifndef configEDF_TIMER_TASK_DEADLINE
+    #define configEDF_TIMER_TASK_DEADLINE    0
+#endif
+
+/* Number of commands that can be waiting for the timer service task. */
+#ifndef configEDF_TIMER_QUEUE_LENGTH
+    #define configEDF_TIMER_QUEUE_LENGTH    5
+#endif
+
+#if ( configUSE_EDF_TIMERS == 1 )
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION != 1 )
+        #error configUSE_EDF_TIMERS requires configSUPPORT_DYNAMIC_ALLOCATION to be set to 1
+    #endif
+
+    /* Commands sent before the scheduler starts must not block. */
+    #if ( INCLUDE_xTaskGetSchedulerState != 1 )
+        #error configUSE_EDF_TIMERS requires INCLUDE_xTaskGetSchedulerState to be set to 1
+    #endif
+#endif
+
+struct xEDF_TIMER; /* The old naming convention is used to prevent breaking kernel aware debuggers. */
+typedef struct xEDF_TIMER * EDFTimerHandle_t;
+
+/* Defines the prototype to which timer callback functions must conform. */
+typedef void (* EDFTimerCallbackFunction_t)( EDFTimerHandle_t xTimer );
+
+/**
+ * edf_timers. h
+ * <pre>
+ * BaseType_t xEDFTimerServiceStart( void );
+ * </pre>
+ *
+ * Create the timer service task and its command queue.  Must be called once,
+ * before the scheduler is started.
+ *
+ * @return pdPASS if the timer service task was created, otherwise an error
+ * code defined in the file projdefs.h or edf.h.
+ */
+#if ( configUSE_EDF_TIMERS == 1 )
+    BaseType_t xEDFTimerServiceStart( void );
+#endif
+
+/**
+ * edf_timers. h
+ * <pre>
+ * EDFTimerHandle_t xEDFTimerCreate( const char * const pcTimerName,
+ *                                   TickType_t xPeriod,
+ *                                   TickType_t xRelativeDeadline,
+ *                                   TickType_t xCallbackWcet,
+ *                                   BaseType_t xAutoReload,
+ *                                   void * const pvTimerID,
+ *                                   EDFTimerCallbackFunction_t pxCallbackFunction );
+ * </pre>
+ *
+ * Create a dormant timer.
+ *
+ * @param xPeriod Number of ticks between the start of the timer and its
+ * expiry, and between two expiries of an auto reload timer.  When
+ * configEDF_TIMER_TASK_WCET is not 0 it cannot be shorter than
+ * configEDF_TIMER_TASK_PERIOD, so the callback is pending at most once per
+ * period of the timer service task.
+ *
+ * @param xRelativeDeadline Number of ticks after each expiry by which the
+ * callback must complete.  When configEDF_TIMER_TASK_WCET is not 0 it cannot
+ * be shorter than the deadline admission control guarantees the timer service
+ * task, see configEDF_TIMER_TASK_DEADLINE.
+ *
+ * @param xCallbackWcet Worst case execution time of the callback in ticks.
+ * When configEDF_TIMER_TASK_WCET is not 0 the callbacks of all the timers that
+ * exist must fit in it together.
+ *
+ * @param xAutoReload pdTRUE to expire every xPeriod ticks until stopped,
+ * pdFALSE to expire once per start.
+ *
+ * @return The handle of the timer, or NULL if it could not be allocated or it
+ * does not fit in the period, deadline or WCET the timer service task was
+ * admitted with.
+ */
+#if ( configUSE_EDF_TIMERS == 1 )
+    EDFTimerHandle_t xEDFTimerCreate( const char * const pcTimerName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                      TickType_t xPeriod,
+                                      TickType_t xRelativeDeadline,
+                                      TickType_t xCallbackWcet,
+                                      BaseType_t xAutoReload,
+                                      void * const pvTimerID,
+                                      EDFTimerCallbackFunction_t pxCallbackFunction );
+#endif
+
+/**
+ * edf_timers. h
+ * <pre>
+ * BaseType_t xEDFTimerStart( EDFTimerHandle_t xTimer, TickType_t xTicksToWait );
+ * BaseType_t xEDFTimerStartFromISR( EDFTimerHandle_t xTimer, BaseType_t * pxHigherPriorityTaskWoken );
+ * BaseType_t xEDFTimerStop( EDFTimerHandle_t xTimer, TickType_t xTicksToWait );
+ * BaseType_t xEDFTimerDelete( EDFTimerHandle_t xTimer, TickType_t xTicksToWait );
+ * </pre>
+ *
+ * Send a command to the timer service task.  Starting a timer that is already
+ * active restarts it, so it expires xPeriod ticks after the command was sent.
+ * A stopped timer does not run a callback that is pending, and a deleted timer
+ * is freed by the timer service task.
+ *
+ * @param xTicksToWait Maximum number of ticks to wait for space in the command
+ * queue.
+ *
+ * @return pdPASS if the command was sent, pdFAIL if the queue stayed full.
+ */
+#if ( configUSE_EDF_TIMERS == 1 )
+    BaseType_t xEDFTimerStart( EDFTimerHandle_t xTimer,
+                               TickType_t xTicksToWait );
+
+    BaseType_t xEDFTimerStartFromISR( EDFTimerHandle_t xTimer,
+                                      BaseType_t * pxHigherPriorityTaskWoken );
+
+    BaseType_t xEDFTimerStop( EDFTimerHandle_t xTimer,
+                              TickType_t xTicksToWait );
+
+    BaseType_t xEDFTimerDelete( EDFTimerHandle_t xTimer,
+                                TickType_t xTicksToWait );
+#endif
+
+/**
+ * edf_timers. h
+ * <pre>
+ * void * pvEDFTimerGetTimerID( EDFTimerHandle_t xTimer );
+ * TickType_t xEDFTimerGetExpiryTime( EDFTimerHandle_t xTimer );
+ * BaseType_t xEDFTimerIsTimerActive( EDFTimerHandle_t xTimer );
+ * </pre>
+ *
+ * Return the ID given to xTimer when it was created, the tick count at which
+ * xTimer expires next or last expired, and whether xTimer is active.  Called
+ * from a callback, xEDFTimerGetExpiryTime() returns the expiry that made the
+ * callback pending, so the callback can measure how late it runs.
+ */
+#if ( configUSE_EDF_TIMERS == 1 )
+    void * pvEDFTimerGetTimerID( EDFTimerHandle_t xTimer );
+
+    TickType_t xEDFTimerGetExpiryTime( EDFTimerHandle_t xTimer );
+
+    BaseType_t xEDFTimerIsTimerActive( EDFTimerHandle_t xTimer );
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* INC_EDF_TIMERS_H */
@@ -0,0 +1,345 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - EDF scheduler event trace
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+#include "FreeRTOS.h"
+#include "edf_trace.h"
+
+#if ( configUSE_EDF_TRACE == 1 )
+
+/* Orders the writes to a record before the index that publishes it, and the
+ * reads of a record before the index that releases it. */
+#ifndef portMEMORY_BARRIER
+    #define portMEMORY_BARRIER()
+#endif
+
+#define edftraceMAX_DELTA    ( ( configRUN_TIME_COUNTER_TYPE ) 0xffffU )
+#define edftraceINDEX_MASK   ( ( uint32_t ) configEDF_TRACE_BUFFER_LENGTH - 1UL )
+
+EDFTraceRing_t xEDFTraceRing;
+
+#if ( configUSE_EDF_TRACE_STREAM == 1 )
+
+/* Longest frame, with its COBS code byte and 0 delimiter. */
+    #define edftraceMAX_FRAME_LENGTH    ( 1 + 15 + ( 6 * configEDF_TRACE_FRAME_RECORDS ) + 1 + 1 )
+
+/* The frame being sent by xEDFTraceStreamGetByte(). */
+    typedef struct xEDF_TRACE_STREAM
+    {
+        uint8_t ucFrame[ edftraceMAX_FRAME_LENGTH ]; /*< The encoded frame. */
+        UBaseType_t uxLength;                        /*< Number of bytes in ucFrame. */
+        UBaseType_t uxSent;                          /*< Number of bytes of ucFrame already returned. */
+        uint32_t ulSequence;                         /*< Sequence number of the next frame. */
+        configRUN_TIME_COUNTER_TYPE ulTimeHigh;      /*< Delta held by an eEDFTraceTimeHigh record at the end of the previous frame. */
+    } EDFTraceStream_t;
+
+    static EDFTraceStream_t xEDFTraceStream;
+#endif
+
+/*
+ * Append a record of ucEvent for object uxIndex, preceded by an
+ * eEDFTraceTimeHigh record if the delta does not fit in 16 bits.
+ */
+static void prvEDFTraceWrite( uint8_t ucEvent,
+                              UBaseType_t uxIndex );
+
+#if ( configUSE_EDF_TRACE_STREAM == 1 )
+
+/*
+ * Append ullValue to pucFrame as a varint and return the next free position.
+ */
+    static uint8_t * prvEDFTraceVarint( uint8_t * pucFrame,
+                                        uint64_t ullValue );
+
+/*
+ * Drain up to configEDF_TRACE_FRAME_RECORDS records into the next frame.
+ * Returns pdFALSE if there were none.
+ */
+    static BaseType_t prvEDFTraceEncodeFrame( void );
+
+#endif /* configUSE_EDF_TRACE_STREAM */
+
+/*-----------------------------------------------------------*/
+
+static void prvEDFTraceWrite( uint8_t ucEvent,
+                              UBaseType_t uxIndex )
+{
+    configRUN_TIME_COUNTER_TYPE ulNow, ulDelta;
+    uint32_t ulHead;
+    uint32_t ulNeeded;
+    EDFTraceRecord_t * pxRecord;
+    UBaseType_t uxSavedInterruptStatus;
+
+    /* A hook called from a task with only the scheduler suspended can be
+     * interrupted by another hook, so the head is claimed and the time taken
+     * with interrupts masked. */
+    uxSavedInterruptStatus = ( UBaseType_t ) configEDF_TRACE_MASK_INTERRUPTS();
+
+    ulHead = xEDFTraceRing.ulHead;
+
+    #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+        portALT_GET_RUN_TIME_COUNTER_VALUE( ulNow );
+    #else
+        ulNow = portGET_RUN_TIME_COUNTER_VALUE();
+    #endif
+
+    ulDelta = ulNow - xEDFTraceRing.ulLastTime;
+    ulNeeded = ( ulDelta > edftraceMAX_DELTA ) ? 2UL : 1UL;
+
+    if( ( ( uint32_t ) configEDF_TRACE_BUFFER_LENGTH - ( ulHead - xEDFTraceRing.ulTail ) ) >= ulNeeded )
+    {
+        if( ulNeeded > 1UL )
+        {
+            pxRecord = &( xEDFTraceRing.xRecords[ ulHead & edftraceINDEX_MASK ] );
+            pxRecord->usDelta = ( uint16_t ) ( ulDelta >> 16 );
+            pxRecord->ucEvent = ( uint8_t ) eEDFTraceTimeHigh;
+            pxRecord->ucIndex = 0U;
+            ulHead++;
+        }
+
+        pxRecord = &( xEDFTraceRing.xRecords[ ulHead & edftraceINDEX_MASK ] );
+        pxRecord->usDelta = ( uint16_t ) ulDelta;
+        pxRecord->ucEvent = ucEvent;
+        pxRecord->ucIndex = ( uint8_t ) uxIndex;
+
+        /* The time of a dropped event is carried into the next record. */
+        xEDFTraceRing.ulLastTime = ulNow;
+
+        portMEMORY_BARRIER();
+        xEDFTraceRing.ulHead = ulHead + 1UL;
+    }
+    else
+    {
+        xEDFTraceRing.ulDropped++;
+    }
+
+    configEDF_TRACE_UNMASK_INTERRUPTS( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+/* The trace hooks take unsigned long rather than UBaseType_t as they are
+ * declared in FreeRTOSConfig.h, before the port types. */
+void vEDFTraceTaskSwitchedIn( unsigned long uxTaskNumber )
+{
+    prvEDFTraceWrite( ( uint8_t ) eEDFTraceSwitchedIn, uxTaskNumber );
+}
+/*-----------------------------------------------------------*/
+
+void vEDFTraceMovedToReady( unsigned long uxTaskNumber )
+{
+    prvEDFTraceWrite( ( uint8_t ) eEDFTraceMovedToReady, uxTaskNumber );
+}
+/*-----------------------------------------------------------*/
+
+void vEDFTraceLeftReady( unsigned long uxTaskNumber )
+{
+    prvEDFTraceWrite( ( uint8_t ) eEDFTraceLeftReady, uxTaskNumber );
+}
+/*-----------------------------------------------------------*/
+
+void vEDFTraceTick( void )
+{
+    prvEDFTraceWrite( ( uint8_t ) eEDFTraceTick, 0U );
+}
+/*-----------------------------------------------------------*/
+
+void vEDFTraceQueueSend( unsigned long uxQueueNumber )
+{
+    prvEDFTraceWrite( ( uint8_t ) eEDFTraceQueueSend, uxQueueNumber );
+}
+/*-----------------------------------------------------------*/
+
+void vEDFTraceQueueReceive( unsigned long uxQueueNumber )
+{
+    prvEDFTraceWrite( ( uint8_t ) eEDFTraceQueueReceive, uxQueueNumber );
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxEDFTraceDrain( EDFTraceRecord_t * const pxRecords,
+                             UBaseType_t uxMaxRecords )
+{
+    uint32_t ulTail = xEDFTraceRing.ulTail;
+    uint32_t ulAvailable = xEDFTraceRing.ulHead - ulTail;
+    UBaseType_t uxCount;
+
+    configASSERT( pxRecords );
+
+    /* Read the head before the records it publishes. */
+    portMEMORY_BARRIER();
+
+    if( ulAvailable > ( uint32_t ) uxMaxRecords )
+    {
+        ulAvailable = ( uint32_t ) uxMaxRecords;
+    }
+
+    for( uxCount = 0; uxCount < ( UBaseType_t ) ulAvailable; uxCount++ )
+    {
+        pxRecords[ uxCount ] = xEDFTraceRing.xRecords[ ulTail & edftraceINDEX_MASK ];
+        ulTail++;
+
+        /* Keep the absolute time of the records read, for readers that
+         * start part way through the stream. */
+        if( pxRecords[ uxCount ].ucEvent == ( uint8_t ) eEDFTraceTimeHigh )
+        {
+            xEDFTraceRing.ulTailTimeHigh = ( configRUN_TIME_COUNTER_TYPE ) pxRecords[ uxCount ].usDelta << 16;
+        }
+        else
+        {
+            xEDFTraceRing.ulTailTime += xEDFTraceRing.ulTailTimeHigh + ( configRUN_TIME_COUNTER_TYPE ) pxRecords[ uxCount ].usDelta;
+            xEDFTraceRing.ulTailTimeHigh = 0;
+        }
+    }
+
+    /* Only release the slots once the records are copied out. */
+    portMEMORY_BARRIER();
+    xEDFTraceRing.ulTail = ulTail;
+
+    return uxCount;
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulEDFTraceGetDropped( void )
+{
+    return xEDFTraceRing.ulDropped;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_TRACE_STREAM == 1 )
+
+    static uint8_t * prvEDFTraceVarint( uint8_t * pucFrame,
+                                        uint64_t ullValue )
+    {
+        while( ullValue >= 0x80U )
+        {
+            *pucFrame = ( uint8_t ) ( ullValue | 0x80U );
+            pucFrame++;
+            ullValue >>= 7;
+        }
+
+        *pucFrame = ( uint8_t ) ullValue;
+
+        return pucFrame + 1;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvEDFTraceEncodeFrame( void )
+    {
+        EDFTraceRecord_t xRecords[ configEDF_TRACE_FRAME_RECORDS ];
+        configRUN_TIME_COUNTER_TYPE ulTimeBase = xEDFTraceRing.ulTailTime;
+        uint8_t * const pucPayload = &( xEDFTraceStream.ucFrame[ 1 ] );
+        uint8_t * pucNext = pucPayload;
+        UBaseType_t uxCount, uxRecord, uxLength, uxLastZero, x;
+        uint8_t ucSum = 0U;
+
+        uxCount = uxEDFTraceDrain( xRecords, configEDF_TRACE_FRAME_RECORDS );
+
+        if( uxCount == 0 )
+        {
+            return pdFALSE;
+        }
+
+        pucNext = prvEDFTraceVarint( pucNext, xEDFTraceStream.ulSequence );
+        pucNext = prvEDFTraceVarint( pucNext, xEDFTraceRing.ulDropped );
+        pucNext = prvEDFTraceVarint( pucNext, ulTimeBase );
+        xEDFTraceStream.ulSequence++;
+
+        for( uxRecord = 0; uxRecord < uxCount; uxRecord++ )
+        {
+            const EDFTraceRecord_t * const pxRecord = &( xRecords[ uxRecord ] );
+
+            if( pxRecord->ucEvent == ( uint8_t ) eEDFTraceTimeHigh )
+            {
+                xEDFTraceStream.ulTimeHigh = ( configRUN_TIME_COUNTER_TYPE ) pxRecord->usDelta << 16;
+            }
+            else
+            {
+                pucNext = prvEDFTraceVarint( pucNext, ( ( uint64_t ) ( xEDFTraceStream.ulTimeHigh + pxRecord->usDelta ) << 3 ) | pxRecord->ucEvent );
+                xEDFTraceStream.ulTimeHigh = 0;
+
+                if( pxRecord->ucEvent != ( uint8_t ) eEDFTraceTick )
+                {
+                    *pucNext = pxRecord->ucIndex;
+                    pucNext++;
+                }
+            }
+        }
+
+        for( x = 0; pucPayload + x < pucNext; x++ )
+        {
+            ucSum += pucPayload[ x ];
+        }
+
+        *pucNext = ( uint8_t ) ( 0U - ucSum );
+        pucNext++;
+        uxLength = ( UBaseType_t ) ( pucNext - pucPayload );
+
+        /* COBS encode in place - the code byte before the payload and every 0
+         * byte of the payload are replaced by the distance to the next 0 byte,
+         * or to the delimiter after the payload. */
+        uxLastZero = 0;
+
+        for( x = 1; x <= uxLength; x++ )
+        {
+            if( xEDFTraceStream.ucFrame[ x ] == 0U )
+            {
+                xEDFTraceStream.ucFrame[ uxLastZero ] = ( uint8_t ) ( x - uxLastZero );
+                uxLastZero = x;
+            }
+        }
+
+        xEDFTraceStream.ucFrame[ uxLastZero ] = ( uint8_t ) ( ( uxLength + 1 ) - uxLastZero );
+        xEDFTraceStream.ucFrame[ uxLength + 1 ] = 0U;
+        xEDFTraceStream.uxLength = uxLength + 2;
+        xEDFTraceStream.uxSent = 0;
+
+        return pdTRUE;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xEDFTraceStreamGetByte( uint8_t * const pucByte )
+    {
+        BaseType_t xReturn = pdTRUE;
+
+        configASSERT( pucByte );
+
+        if( xEDFTraceStream.uxSent >= xEDFTraceStream.uxLength )
+        {
+            xReturn = prvEDFTraceEncodeFrame();
+        }
+
+        if( xReturn != pdFALSE )
+        {
+            *pucByte = xEDFTraceStream.ucFrame[ xEDFTraceStream.uxSent ];
+            xEDFTraceStream.uxSent++;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_EDF_TRACE_STREAM */
+
+#endif /* configUSE_EDF_TRACE */
@@ -0,0 +1,245 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - EDF scheduler event trace
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Always-on binary recorder of scheduler events.  When configUSE_EDF_TRACE is
+ * set to 1 the trace hooks defined in FreeRTOSConfig.h append a four byte
+ * EDFTraceRecord_t for every context switch, task made ready or leaving the
+ * ready state, tick and queue send or receive to a ring buffer in RAM, from which a low priority task or
+ * a debugger drains them.  No logic analyser is needed to follow the
+ * schedule.
+ *
+ * The ring has a single reader, which neither takes a lock nor masks
+ * interrupts.  The kernel calls the trace hooks from interrupts, from tasks
+ * with interrupts masked, and from tasks with only the scheduler suspended -
+ * traceMOVED_TASK_TO_READY_STATE() when xTaskDelayUntil() releases a late job,
+ * when xTaskAbortDelay() runs, and when an event group is set - during which
+ * the tick and queue hooks can still run from interrupts.  Each record is
+ * therefore written with interrupts masked by
+ * configEDF_TRACE_MASK_INTERRUPTS(), which keeps the slot it claims and the
+ * time it is stamped with consistent.  Claiming the slot without masking would
+ * need an atomic fetch-and-add, which ARMv4T does not have.  When the ring is
+ * full new records are dropped and counted rather than overwriting records the
+ * reader may be copying.
+ *
+ * Timestamps are run time counter values.  Each record holds the time since
+ * the previous record written.  A gap of 0x10000 counts or more is preceded by
+ * an eEDFTraceTimeHigh record holding its upper 16 bits, so absolute times can
+ * always be rebuilt by summing the deltas.
+ *
+ * When configUSE_EDF_TRACE_STREAM is set to 1 the records are also encoded
+ * into a byte stream for a host to capture over a serial port, one byte at a
+ * time with xEDFTraceStreamGetByte().  Records are gathered into frames of up
+ * to configEDF_TRACE_FRAME_RECORDS records:
+ *
+ *     varint   sequence number of the frame
+ *     varint   ulDropped when the frame was encoded
+ *     varint   run time counter value of the record before the frame
+ *     records  varint( delta << 3 | event ), followed by the task or queue
+ *              number byte for events that have one
+ *     byte     checksum, making the sum of the frame bytes 0 modulo 256
+ *
+ * Varints hold 7 bits per byte, least significant first, with the top bit
+ * set on all but the last byte.  eEDFTraceTimeHigh records are folded into
+ * the delta of the record they precede.  Every frame is COBS encoded and
+ * followed by a 0 byte, the only 0 byte in the stream, so a host that starts
+ * listening or loses bytes resynchronises at the next frame.
+ * Tools/edf_trace_decode.c turns a captured stream into a JSON trace for
+ * Perfetto or chrome://tracing.
+ */
+
+#ifndef INC_EDF_TRACE_H
+#define INC_EDF_TRACE_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include edf_trace.h"
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/* Set to 1 to record scheduler events.  The trace hooks must then be defined
+ * in FreeRTOSConfig.h as shown there. */
+#ifndef configUSE_EDF_TRACE
+    #define configUSE_EDF_TRACE    0
+#endif
+
+/* Number of records the ring holds, a power of two. */
+#ifndef configEDF_TRACE_BUFFER_LENGTH
+    #define configEDF_TRACE_BUFFER_LENGTH    256
+#endif
+
+/* Set to 1 to encode the records into a stream with
+ * xEDFTraceStreamGetByte(). */
+#ifndef configUSE_EDF_TRACE_STREAM
+    #define configUSE_EDF_TRACE_STREAM    0
+#endif
+
+/* Most records carried by one frame of the stream. */
+#ifndef configEDF_TRACE_FRAME_RECORDS
+    #define configEDF_TRACE_FRAME_RECORDS    16
+#endif
+
+/* Masks the interrupts that call trace hooks, from a task or an interrupt, and
+ * returns the previous mask for configEDF_TRACE_UNMASK_INTERRUPTS().  Ports
+ * without nested interrupts leave portSET_INTERRUPT_MASK_FROM_ISR() empty, in
+ * which case FreeRTOSConfig.h must define both. */
+#ifndef configEDF_TRACE_MASK_INTERRUPTS
+    #define configEDF_TRACE_MASK_INTERRUPTS()    portSET_INTERRUPT_MASK_FROM_ISR()
+#endif
+
+#ifndef configEDF_TRACE_UNMASK_INTERRUPTS
+    #define configEDF_TRACE_UNMASK_INTERRUPTS( uxSavedInterruptStatus )    portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus )
+#endif
+
+#if ( configUSE_EDF_TRACE == 1 )
+    #if ( configGENERATE_RUN_TIME_STATS != 1 )
+        #error configUSE_EDF_TRACE requires configGENERATE_RUN_TIME_STATS to be set to 1
+    #endif
+
+    #if ( configUSE_TRACE_FACILITY != 1 )
+        #error configUSE_EDF_TRACE requires configUSE_TRACE_FACILITY to be set to 1
+    #endif
+
+    #if ( ( configEDF_TRACE_BUFFER_LENGTH < 2 ) || ( ( configEDF_TRACE_BUFFER_LENGTH & ( configEDF_TRACE_BUFFER_LENGTH - 1 ) ) != 0 ) )
+        #error configEDF_TRACE_BUFFER_LENGTH must be a power of two
+    #endif
+#endif
+
+#if ( configUSE_EDF_TRACE_STREAM == 1 )
+    #if ( configUSE_EDF_TRACE != 1 )
+        #error configUSE_EDF_TRACE_STREAM requires configUSE_EDF_TRACE to be set to 1
+    #endif
+
+    /* A COBS frame only needs a single code byte up to 254 bytes, which
+     * bounds the frame to 15 bytes of header, 6 bytes per record and the
+     * checksum. */
+    #if ( ( configEDF_TRACE_FRAME_RECORDS < 1 ) || ( configEDF_TRACE_FRAME_RECORDS > 39 ) )
+        #error configEDF_TRACE_FRAME_RECORDS must be between 1 and 39
+    #endif
+#endif
+
+/* Events held in the ucEvent member of an EDFTraceRecord_t. */
+typedef enum
+{
+    eEDFTraceTimeHigh = 0,   /* Upper 16 bits of the delta of the next record, held in usDelta.  ucIndex is 0. */
+    eEDFTraceSwitchedIn,     /* Task ucIndex started running. */
+    eEDFTraceMovedToReady,   /* Task ucIndex was added to the ready list. */
+    eEDFTraceTick,           /* The tick count was incremented.  ucIndex is 0. */
+    eEDFTraceQueueSend,      /* An item was sent to queue ucIndex. */
+    eEDFTraceQueueReceive,   /* An item was received from queue ucIndex. */
+    eEDFTraceLeftReady       /* Task ucIndex was switched out blocked, suspended or deleted, so its job completed or is waiting. */
+} eEDFTraceEvent;
+
+/* One recorded event.  Tasks are identified by the number the kernel gives
+ * them in creation order, as reported in the xTaskNumber member of
+ * TaskStatus_t, and queues by the number set with vQueueSetQueueNumber(), 0
+ * by default.  Both are truncated to 8 bits. */
+typedef struct xEDF_TRACE_RECORD
+{
+    uint16_t usDelta; /*< Run time counter increments since the previous record, modulo 0x10000. */
+    uint8_t ucEvent;  /*< One of eEDFTraceEvent. */
+    uint8_t ucIndex;  /*< The task or queue the event applies to. */
+} EDFTraceRecord_t;
+
+/* The ring.  It is not static so a debugger can read the records between
+ * ulTail and ulHead directly.  Both indexes run freely and are reduced modulo
+ * configEDF_TRACE_BUFFER_LENGTH when used - ulHead is only written by the
+ * trace hooks and ulTail only by the reader. */
+typedef struct xEDF_TRACE_RING
+{
+    volatile uint32_t ulHead;                                  /*< Number of records written since the recorder started. */
+    volatile uint32_t ulTail;                                  /*< Number of records read since the recorder started. */
+    volatile uint32_t ulDropped;                               /*< Number of events not recorded because the ring was full. */
+    configRUN_TIME_COUNTER_TYPE ulLastTime;                    /*< Run time counter value of the last record written. */
+    configRUN_TIME_COUNTER_TYPE ulTailTime;                    /*< Run time counter value of the last record read, other than eEDFTraceTimeHigh. */
+    configRUN_TIME_COUNTER_TYPE ulTailTimeHigh;                /*< Delta held by an eEDFTraceTimeHigh record read before the record it precedes. */
+    EDFTraceRecord_t xRecords[ configEDF_TRACE_BUFFER_LENGTH ];
+} EDFTraceRing_t;
+
+#if ( configUSE_EDF_TRACE == 1 )
+    extern EDFTraceRing_t xEDFTraceRing;
+#endif
+
+/**
+ * edf_trace. h
+ * <pre>
+ * UBaseType_t uxEDFTraceDrain( EDFTraceRecord_t * const pxRecords, UBaseType_t uxMaxRecords );
+ * </pre>
+ *
+ * Move up to uxMaxRecords of the oldest records out of the ring into
+ * pxRecords.  Only one task, or the debugger, may drain the ring.
+ *
+ * @return The number of records copied into pxRecords.
+ */
+#if ( configUSE_EDF_TRACE == 1 )
+    UBaseType_t uxEDFTraceDrain( EDFTraceRecord_t * const pxRecords,
+                                 UBaseType_t uxMaxRecords );
+#endif
+
+/**
+ * edf_trace. h
+ * <pre>
+ * uint32_t ulEDFTraceGetDropped( void );
+ * </pre>
+ *
+ * @return The number of events lost because the ring was full since the
+ * recorder started.  The deltas of the records around the gap remain valid.
+ */
+#if ( configUSE_EDF_TRACE == 1 )
+    uint32_t ulEDFTraceGetDropped( void );
+#endif
+
+/**
+ * edf_trace. h
+ * <pre>
+ * BaseType_t xEDFTraceStreamGetByte( uint8_t * const pucByte );
+ * </pre>
+ *
+ * Get the next byte of the encoded stream, draining the next frame of records
+ * out of the ring once the previous frame has been sent.  Never blocks, so it
+ * can be called from the idle hook or from the transmit interrupt of a UART.
+ * The stream is the only reader of the ring, so uxEDFTraceDrain() must not be
+ * called once streaming starts.
+ *
+ * @return pdTRUE if *pucByte was set, or pdFALSE if no record is waiting.
+ */
+#if ( configUSE_EDF_TRACE_STREAM == 1 )
+    BaseType_t xEDFTraceStreamGetByte( uint8_t * const pucByte );
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* INC_EDF_TRACE_H */
@@ -0,0 +1,192 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - latency histograms
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "histogram.h"
+
+#define histogramSUB_BUCKETS    ( ( uint32_t ) 1UL << configHISTOGRAM_SUB_BUCKET_BITS )
+
+/* The largest value that is not counted in the last bucket. */
+#if ( configHISTOGRAM_VALUE_BITS == 32 )
+    #define histogramMAX_VALUE    ( ( uint32_t ) 0xFFFFFFFFUL )
+#else
+    #define histogramMAX_VALUE    ( ( ( uint32_t ) 1UL << configHISTOGRAM_VALUE_BITS ) - 1UL )
+#endif
+
+/*
+ * Returns the index of the bucket counting ulValue.
+ */
+static uint32_t prvHistogramBucket( uint32_t ulValue );
+
+/*-----------------------------------------------------------*/
+
+static uint32_t prvHistogramBucket( uint32_t ulValue )
+{
+    uint32_t ulShift = 0UL, ulStep;
+
+    if( ulValue > histogramMAX_VALUE )
+    {
+        ulValue = histogramMAX_VALUE;
+    }
+
+    if( ulValue < histogramSUB_BUCKETS )
+    {
+        return ulValue;
+    }
+
+    /* Find how far the value has to be shifted to leave its most significant
+     * bit followed by the sub-bucket bits.  A binary search takes the same
+     * five steps whatever the value. */
+    if( ulValue >= ( histogramSUB_BUCKETS << 1 ) )
+    {
+        for( ulStep = 16UL; ulStep > 0UL; ulStep >>= 1 )
+        {
+            if( ( ulValue >> ( ulShift + ulStep ) ) >= ( histogramSUB_BUCKETS << 1 ) )
+            {
+                ulShift += ulStep;
+            }
+        }
+
+        ulShift++;
+    }
+
+    /* The shifted value keeps its most significant bit, which moves it past
+     * the buckets of every smaller power of two range. */
+    return ( ( ulShift + 1UL ) << configHISTOGRAM_SUB_BUCKET_BITS ) + ( ( ulValue >> ulShift ) - histogramSUB_BUCKETS );
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulHistogramBucketUpperBound( uint32_t ulBucket )
+{
+    uint32_t ulShift;
+
+    configASSERT( ulBucket < ( uint32_t ) histogramNUM_BUCKETS );
+
+    if( ulBucket < histogramSUB_BUCKETS )
+    {
+        return ulBucket;
+    }
+
+    ulShift = ( ulBucket >> configHISTOGRAM_SUB_BUCKET_BITS ) - 1UL;
+
+    return ( ( ( ulBucket & ( histogramSUB_BUCKETS - 1UL ) ) + histogramSUB_BUCKETS + 1UL ) << ulShift ) - 1UL;
+}
+/*-----------------------------------------------------------*/
+
+void vHistogramReset( Histogram_t * const pxHistogram )
+{
+    configASSERT( pxHistogram );
+
+    ( void ) memset( pxHistogram, 0x00, sizeof( Histogram_t ) );
+}
+/*-----------------------------------------------------------*/
+
+void vHistogramRecord( Histogram_t * const pxHistogram,
+                       uint32_t ulValue )
+{
+    configASSERT( pxHistogram );
+
+    if( ( pxHistogram->ulCount == 0UL ) || ( ulValue < pxHistogram->ulMin ) )
+    {
+        pxHistogram->ulMin = ulValue;
+    }
+
+    if( ulValue > pxHistogram->ulMax )
+    {
+        pxHistogram->ulMax = ulValue;
+    }
+
+    ( pxHistogram->aulBuckets[ prvHistogramBucket( ulValue ) ] )++;
+    ( pxHistogram->ulCount )++;
+    pxHistogram->ullTotal += ulValue;
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulHistogramPercentile( const Histogram_t * const pxHistogram,
+                                uint32_t ulPercentile )
+{
+    uint32_t ulBucket, ulRank, ulUpperBound;
+    uint32_t ulSeen = 0UL;
+
+    configASSERT( pxHistogram );
+    configASSERT( ulPercentile <= 100UL );
+
+    if( pxHistogram->ulCount == 0UL )
+    {
+        return 0UL;
+    }
+
+    /* The rank of the value, counting from 1, computed so that the product
+     * cannot overflow. */
+    ulRank = ( ( pxHistogram->ulCount / 100UL ) * ulPercentile ) + ( ( ( pxHistogram->ulCount % 100UL ) * ulPercentile ) + 99UL ) / 100UL;
+
+    if( ulRank == 0UL )
+    {
+        ulRank = 1UL;
+    }
+
+    for( ulBucket = 0UL; ulBucket < ( uint32_t ) histogramNUM_BUCKETS; ulBucket++ )
+    {
+        ulSeen += pxHistogram->aulBuckets[ ulBucket ];
+
+        if( ulSeen >= ulRank )
+        {
+            break;
+        }
+    }
+
+    /* The last bucket also counts every larger value. */
+    if( ulBucket >= ( uint32_t ) ( histogramNUM_BUCKETS - 1 ) )
+    {
+        return pxHistogram->ulMax;
+    }
+
+    ulUpperBound = ulHistogramBucketUpperBound( ulBucket );
+
+    return ( ulUpperBound < pxHistogram->ulMax ) ? ulUpperBound : pxHistogram->ulMax;
+}
+/*-----------------------------------------------------------*/
+
+void vHistogramGetSummary( const Histogram_t * const pxHistogram,
+                           HistogramSummary_t * const pxSummary )
+{
+    configASSERT( pxHistogram );
+    configASSERT( pxSummary );
+
+    pxSummary->ulCount = pxHistogram->ulCount;
+    pxSummary->ulMin = pxHistogram->ulMin;
+    pxSummary->ulMax = pxHistogram->ulMax;
+    pxSummary->ulMean = ( pxHistogram->ulCount == 0UL ) ? 0UL : ( uint32_t ) ( pxHistogram->ullTotal / pxHistogram->ulCount );
+    pxSummary->ulP50 = ulHistogramPercentile( pxHistogram, 50UL );
+    pxSummary->ulP90 = ulHistogramPercentile( pxHistogram, 90UL );
+    pxSummary->ulP99 = ulHistogramPercentile( pxHistogram, 99UL );
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,165 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - latency histograms
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Fixed size histograms of latencies or other unsigned 32-bit values with a
+ * bounded relative error.  Values below 2 ^ configHISTOGRAM_SUB_BUCKET_BITS
+ * each have their own bucket.  Every higher power of two range is split into
+ * 2 ^ configHISTOGRAM_SUB_BUCKET_BITS buckets of equal width, so a value is
+ * never reported more than 1 / 2 ^ configHISTOGRAM_SUB_BUCKET_BITS above its
+ * real value.  Values of 2 ^ configHISTOGRAM_VALUE_BITS and above are counted
+ * in the last bucket, though the minimum, maximum and mean are always
+ * recorded exactly.
+ *
+ * The histogram functions do not protect the histogram from concurrent
+ * access - the caller must do so where needed.
+ */
+
+#ifndef INC_HISTOGRAM_H
+#define INC_HISTOGRAM_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include histogram.h"
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/* Number of bits of a value, after its most significant bit, that select its
+ * bucket within its power of two range. */
+#ifndef configHISTOGRAM_SUB_BUCKET_BITS
+    #define configHISTOGRAM_SUB_BUCKET_BITS    2
+#endif
+
+/* Number of bits of the largest value recorded without saturation.  The
+ * default covers about 1 second of the run time counter of the demo. */
+#ifndef configHISTOGRAM_VALUE_BITS
+    #define configHISTOGRAM_VALUE_BITS    16
+#endif
+
+#if ( configHISTOGRAM_SUB_BUCKET_BITS < 0 ) || ( configHISTOGRAM_VALUE_BITS > 32 ) || ( configHISTOGRAM_VALUE_BITS <= configHISTOGRAM_SUB_BUCKET_BITS )
+    #error configHISTOGRAM_VALUE_BITS must be above configHISTOGRAM_SUB_BUCKET_BITS and at most 32
+#endif
+
+#define histogramNUM_BUCKETS    ( ( configHISTOGRAM_VALUE_BITS - configHISTOGRAM_SUB_BUCKET_BITS + 1 ) << configHISTOGRAM_SUB_BUCKET_BITS )
+
+typedef struct xHISTOGRAM
+{
+    uint32_t ulCount;                            /*< Number of values recorded. */
+    uint32_t ulMin;                              /*< Smallest value recorded. */
+    uint32_t ulMax;                              /*< Largest value recorded. */
+    uint64_t ullTotal;                           /*< Sum of the values recorded. */
+    uint32_t aulBuckets[ histogramNUM_BUCKETS ]; /*< Number of values recorded in each bucket. */
+} Histogram_t;
+
+/* Used with the vHistogramGetSummary() function to return the distribution of
+ * the recorded values. */
+typedef struct xHISTOGRAM_SUMMARY
+{
+    uint32_t ulCount; /*< Number of values recorded. */
+    uint32_t ulMin;   /*< Smallest value recorded. */
+    uint32_t ulMax;   /*< Largest value recorded. */
+    uint32_t ulMean;  /*< Mean of the values recorded, rounded down. */
+    uint32_t ulP50;   /*< Median, rounded up to the upper bound of its bucket. */
+    uint32_t ulP90;   /*< 90th percentile, rounded up to the upper bound of its bucket. */
+    uint32_t ulP99;   /*< 99th percentile, rounded up to the upper bound of its bucket. */
+} HistogramSummary_t;
+
+/**
+ * histogram. h
+ * <pre>
+ * void vHistogramReset( Histogram_t * const pxHistogram );
+ * </pre>
+ *
+ * Remove every value from pxHistogram.  A histogram must be reset before its
+ * first use unless it is zero initialised.
+ */
+void vHistogramReset( Histogram_t * const pxHistogram );
+
+/**
+ * histogram. h
+ * <pre>
+ * void vHistogramRecord( Histogram_t * const pxHistogram, uint32_t ulValue );
+ * </pre>
+ *
+ * Add ulValue to pxHistogram.  Takes a short constant time, so it can be
+ * called from interrupts and critical sections.
+ */
+void vHistogramRecord( Histogram_t * const pxHistogram,
+                       uint32_t ulValue );
+
+/**
+ * histogram. h
+ * <pre>
+ * uint32_t ulHistogramPercentile( const Histogram_t * const pxHistogram, uint32_t ulPercentile );
+ * </pre>
+ *
+ * @param ulPercentile Percentile to return, from 0 to 100.
+ *
+ * @return The upper bound of the bucket holding the smallest value that is not
+ * below ulPercentile percent of the recorded values, limited to the largest
+ * value recorded.  0 if no value has been recorded.
+ */
+uint32_t ulHistogramPercentile( const Histogram_t * const pxHistogram,
+                                uint32_t ulPercentile );
+
+/**
+ * histogram. h
+ * <pre>
+ * uint32_t ulHistogramBucketUpperBound( uint32_t ulBucket );
+ * </pre>
+ *
+ * @return The largest value counted in aulBuckets[ ulBucket ], so that the
+ * buckets of a histogram can be printed.  The last bucket also counts every
+ * larger value.
+ */
+uint32_t ulHistogramBucketUpperBound( uint32_t ulBucket );
+
+/**
+ * histogram. h
+ * <pre>
+ * void vHistogramGetSummary( const Histogram_t * const pxHistogram, HistogramSummary_t * const pxSummary );
+ * </pre>
+ *
+ * Populate a HistogramSummary_t structure with the count, minimum, maximum,
+ * mean and the 50th, 90th and 99th percentiles of the values in pxHistogram.
+ * All zero if no value has been recorded.
+ */
+void vHistogramGetSummary( const Histogram_t * const pxHistogram,
+                           HistogramSummary_t * const pxSummary );
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* INC_HISTOGRAM_H */
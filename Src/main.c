@@ -60,8 +60,16 @@
 /* Scheduler includes. */
 #include "FreeRTOS.h"
 #include "task.h"
+#include "edf.h"
 #include "lpc21xx.h"
 #include "semphr.h"
+#include "queue_latency.h"
+#include "edf_timers.h"
+#include "edf_trace.h"
+
+#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+	#include "edf_analysis.h"
+#endif
 
 /* Peripheral includes. */
 #include "serial.h"
@@ -76,6 +84,11 @@
 /* Constants for the ComTest demo application tasks. */
 #define mainCOM_TEST_BAUD_RATE	( ( unsigned long ) 115200 )
 
+/* UART1 settings for the scheduler event stream. */
+#define mainTRACE_BAUD_RATE		( ( unsigned long ) 115200 )
+#define mainTRACE_FIFO_LENGTH	16
+#define mainUART_LSR_THRE		( ( unsigned char ) 0x20 )
+
 /* Read the Buttons States */
 #define BUTTON_1_STATE		GPIO_read(PORT_0, PIN0)
 #define BUTTON_2_STATE		GPIO_read(PORT_0, PIN1)
@@ -87,50 +100,187 @@
  * file.
  */
 static void prvSetupHardware( void );
+
+#if ( configUSE_EDF_TRACE_STREAM == 1 )
+/*
+ * Configure UART1 for the trace stream, and send the next bytes of the stream
+ * if the UART can take them.
+ */
+static void prvSetupTraceUart( void );
+static void prvTraceStreamPoll( void );
+#endif
 /*-----------------------------------------------------------*/
 
-TaskHandle_t xButton_1Handle = NULL;
-TaskHandle_t xButton_2Handle = NULL;
-TaskHandle_t xPeriodic_TransmitterHandle = NULL;
-TaskHandle_t xUart_ReceiverTaskHandle = NULL;
-TaskHandle_t xLoad_1_SimulationHandle = NULL;
-TaskHandle_t xLoad_2_SimulationHandle = NULL;
+TaskHandle_t xAperiodic_LoggerHandle = NULL;
 
 QueueHandle_t xUARTQueue = NULL;
 
-const TickType_t xButton_1Period = 50;
-const TickType_t xButton_2Period = 50;
-const TickType_t xPeriodic_TransmitterPeriod = 100;
-const TickType_t xUart_ReceiverTaskPeriod = 20;
-const TickType_t xLoad_1_SimulationPeriod = 10;
-const TickType_t xLoad_2_SimulationPeriod = 100;
-
-uint32_t xButton_1TimeIn;
-uint32_t xButton_1TimeOut;
-uint32_t xButton_1TotalTime;
-
-uint32_t xButton_2TimeIn;
-uint32_t xButton_2TimeOut;
-uint32_t xButton_2TotalTime;
-
-uint32_t xPeriodic_TransTimeIn;
-uint32_t xPeriodic_TransTimeOut;
-uint32_t xPeriodic_TransTotalTime;
-
-uint32_t xUart_ReceiverTimeIn;
-uint32_t xUart_ReceiverTimeOut;
-uint32_t xUart_ReceiverTotalTime;
-
-uint32_t xLoad_1_SimTimeIn;
-uint32_t xLoad_1_SimTimeOut;
-uint32_t xLoad_1_SimTotalTime;
-
-uint32_t xLoad_2_SimTimeIn;
-uint32_t xLoad_2_SimTimeOut;
-uint32_t xLoad_2_SimTotalTime;
+/* Load_2 runs non-preemptively between preemption points, so Load_1 is only
+ * delayed by one chunk of its work instead of being preempted mid-chunk. */
+#define mainLOAD_2_CHUNKS				6
+#define mainLOAD_2_CHUNK_COUNTS		14750
+
+/* Periodic_Transmitter only reports status, so under overload it may lose one
+ * of every 4 jobs.  Its deadline history is copied to
+ * xPeriodic_TransmitterFirmStatus by every job. */
+#if ( configUSE_EDF_FIRM_DEADLINES == 1 )
+	FirmStatus_t xPeriodic_TransmitterFirmStatus;
+#endif
+
+/* Uart_Receiver only has work when a producer has queued a string, so with
+ * precedence constraints it blocks on the queue instead of polling it.  The
+ * string queued by a producer job is written out within this many ticks of the
+ * release of that job.  A job is then released by every string rather than
+ * every 20 ticks, but the producers have periods of at least 50 ticks, so at
+ * most one string from each of the 3 is queued in any 20 ticks.  Uart_Receiver
+ * is admitted with the WCET of 3 jobs, the demand of that burst, to bound its
+ * load. */
+#if ( configUSE_EDF_PRECEDENCE == 1 )
+	const TickType_t xUart_ReceiverEndToEndDeadline = 20;
+	#define mainUART_RECEIVER_WCET		3
+#else
+	#define mainUART_RECEIVER_WCET		1
+#endif
+
+/* Latency of the strings sent to Uart_Receiver, from xQueueSend() by a
+ * producer to the end of the UART write, in T1TC counts.  Copied to
+ * xUARTQueueLatencyStats by every Periodic_Transmitter job. */
+#if ( configUSE_QUEUE_LATENCY == 1 )
+	QueueLatencyStats_t xUARTQueueLatencyStats;
+#endif
+
+/* Heartbeat is a software timer expiring every 25 ticks whose callback must
+ * complete within 3 ticks of each expiry, however long the jobs of the
+ * periodic tasks are.  The deadline leaves room for the 2 ticks a started
+ * Load_2_Simulation job runs without a preemption point.  The timer service
+ * is admitted with the period, deadline and callback WCET of Heartbeat, see
+ * FreeRTOSConfig.h.  The latest the callback ran, in ticks after an expiry,
+ * is kept in xHeartbeatMaxLateness. */
+#if ( configUSE_EDF_TIMERS == 1 )
+	const TickType_t xHeartbeatPeriod = 25;
+	const TickType_t xHeartbeatDeadline = 3;
+	const TickType_t xHeartbeatWcet = 1;
+	EDFTimerHandle_t xHeartbeatTimer = NULL;
+	uint32_t ulHeartbeatCount = 0;
+	TickType_t xHeartbeatMaxLateness = 0;
+#endif
+
+/* Periodic_Transmitter releases an aperiodic Logger job of about 2 ticks every
+ * period.  The Logger alternates between running in the slack of the periodic
+ * tasks and only running when the processor is idle, every
+ * mainAPERIODIC_JOBS_PER_RUN jobs, and its response times under each scheme
+ * are copied to xAperiodicStatsSlack and xAperiodicStatsBackground. */
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+	#define mainAPERIODIC_JOBS_PER_RUN		20
+	#define mainAPERIODIC_JOB_COUNTS		14880
+	AperiodicStats_t xAperiodicStatsSlack;
+	AperiodicStats_t xAperiodicStatsBackground;
+#endif
+
+/* With configUSE_EDF_SHARED_STACK set to 1 the jobs of the tasks that never
+ * block run to completion on the kernel's shared stack, otherwise each task
+ * loops around its job on its own stack. */
+#if ( configUSE_EDF_SHARED_STACK == 1 )
+	#define mainPERIODIC_CODE( xTask, xJob )	( xJob )
+	#define mainRUN_TO_COMPLETION				pdTRUE
+#else
+	#define mainPERIODIC_CODE( xTask, xJob )	( xTask )
+	#define mainRUN_TO_COMPLETION				pdFALSE
+#endif
+
+/* The periodic tasks, one row per task:
+ *  - name, which gives the names of the task, its handle and its period,
+ *  - task code,
+ *  - stack depth in words,
+ *  - priority,
+ *  - period, relative deadline and worst case execution time in ticks, the
+ *    execution times rounded up from the measured times,
+ *  - longest non-preemptive execution in ticks,
+ *  - pdTRUE if jobs are only preempted at preemption points,
+ *  - pdTRUE if jobs run to completion on the shared stack,
+ *  - m and k of the (m,k)-firm constraint, 0 if every job must meet its
+ *    deadline.
+ * The tasks are created in this order and tagged with the pins PIN2 to PIN7
+ * of port 0, which the trace hooks drive high while the task runs. */
+#define mainPERIODIC_TASKS( X ) \
+	X( Button_1,             mainPERIODIC_CODE( Button_1_MonitorTask, Button_1_MonitorJob ),             120, 1, 50,  50,  1,  0, pdFALSE, mainRUN_TO_COMPLETION, 0, 0 ) \
+	X( Button_2,             mainPERIODIC_CODE( Button_2_MonitorTask, Button_2_MonitorJob ),             120, 2, 50,  50,  1,  0, pdFALSE, mainRUN_TO_COMPLETION, 0, 0 ) \
+	X( Periodic_Transmitter, mainPERIODIC_CODE( Periodic_TransmitterTask, Periodic_TransmitterJob ),     200, 3, 100, 100, 1,  0, pdFALSE, mainRUN_TO_COMPLETION, 3, 4 ) \
+	X( Uart_Receiver,        Uart_ReceiverTask,                                                          200, 4, 20,  20,  mainUART_RECEIVER_WCET, 0, pdFALSE, pdFALSE, 0, 0 ) \
+	X( Load_1_Simulation,    mainPERIODIC_CODE( Load_1_SimulationTask, Load_1_SimulationJob ),           200, 5, 10,  10,  5,  0, pdFALSE, mainRUN_TO_COMPLETION, 0, 0 ) \
+	X( Load_2_Simulation,    mainPERIODIC_CODE( Load_2_SimulationTask, Load_2_SimulationJob ),           200, 6, 100, 100, 12, 2, pdTRUE,  mainRUN_TO_COMPLETION, 0, 0 )
+
+/* The handle and the period of each task. */
+#define mainTASK_HANDLE( xName, pvCode, uxStack, uxPriority, xPeriod, xDeadline, xWcet, xNonPreemptive, xPoints, xRunToCompletion, uxFirmM, uxFirmK ) \
+	TaskHandle_t x##xName##Handle = NULL; \
+	const TickType_t x##xName##Period = ( xPeriod );
+mainPERIODIC_TASKS( mainTASK_HANDLE )
+
+/* A job cannot be due after the next one is released.  A row with a longer
+ * deadline fails to compile. */
+#define mainTASK_DEADLINE_CHECK( xName, pvCode, uxStack, uxPriority, xPeriod, xDeadline, xWcet, xNonPreemptive, xPoints, xRunToCompletion, uxFirmM, uxFirmK ) \
+	typedef char mainDEADLINE_OF_##xName##_EXCEEDS_ITS_PERIOD[ ( ( xDeadline ) <= ( xPeriod ) ) ? 1 : -1 ];
+mainPERIODIC_TASKS( mainTASK_DEADLINE_CHECK )
+
+/* The task set can only be schedulable by EDF if the utilisation, in units
+ * of 1 / 10000 and rounded up for each task, does not exceed 1.  That is
+ * enough when every deadline is the period.  Shorter deadlines need the
+ * processor demand test, which main() runs on the table and admission control
+ * repeats, with blocking, as the tasks are created. */
+#define mainUTILISATION_SCALE	10000UL
+#define mainTASK_UTILISATION( xName, pvCode, uxStack, uxPriority, xPeriod, xDeadline, xWcet, xNonPreemptive, xPoints, xRunToCompletion, uxFirmM, uxFirmK ) \
+	+ ( ( ( ( unsigned long ) ( xWcet ) * mainUTILISATION_SCALE ) + ( unsigned long ) ( xPeriod ) - 1UL ) / ( unsigned long ) ( xPeriod ) )
+#define mainTASK_SET_UTILISATION	( 0UL mainPERIODIC_TASKS( mainTASK_UTILISATION ) )
+typedef char mainTASK_SET_UTILISATION_EXCEEDS_1[ ( mainTASK_SET_UTILISATION <= mainUTILISATION_SCALE ) ? 1 : -1 ];
+
+/* With configSUPPORT_STATIC_ALLOCATION set to 1 the periodic tasks and the
+ * idle task are created in memory allocated at compile time, so only the
+ * queue, the timer service and the aperiodic task come from the heap.  The
+ * tasks that run to completion on the shared stack need no stack of their
+ * own. */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+	#define mainTASK_MEMORY( xName, pvCode, uxStack, uxPriority, xPeriod, xDeadline, xWcet, xNonPreemptive, xPoints, xRunToCompletion, uxFirmM, uxFirmK ) \
+		static StackType_t ux##xName##Stack[ ( ( xRunToCompletion ) != pdFALSE ) ? 1 : ( uxStack ) ]; \
+		static StaticPeriodicTask_t x##xName##TCB;
+	mainPERIODIC_TASKS( mainTASK_MEMORY )
+
+	#define mainTASK_STATIC_MEMORY( xName )	ux##xName##Stack, &x##xName##TCB,
+#else
+	#define mainTASK_STATIC_MEMORY( xName )
+#endif
+
+/* A periodic task as it is created by main(). */
+typedef struct
+{
+	PeriodicTaskParameters_t xParameters;
+	TaskHandle_t * pxHandle;
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+	StackType_t * puxStack;
+	StaticPeriodicTask_t * pxTCB;
+#endif
+} PeriodicTaskEntry_t;
+
+/* Initialiser of the entry of a task.  The members of the
+ * PeriodicTaskParameters_t are given in the order they are declared in. */
+#define mainTASK_ENTRY( xName, pvCode, uxStack, uxPriority, xPeriod, xDeadline, xWcet, xNonPreemptive, xPoints, xRunToCompletion, uxFirmM, uxFirmK ) \
+	{ \
+		{ ( pvCode ), #xName, ( uxStack ), ( void * ) 1, ( uxPriority ), ( xPeriod ), ( xWcet ), ( xNonPreemptive ), ( xPoints ), 0, \
+		  ( xRunToCompletion ), eCriticalityLow, 0, pdFALSE, ( uxFirmM ), ( uxFirmK ), ( xDeadline ) }, \
+		&x##xName##Handle, mainTASK_STATIC_MEMORY( xName ) \
+	},
+
+/* Heap used to create the application tasks, in bytes, and the time it took
+ * in processor cycles. */
+size_t xTasksHeapUsage;
+uint32_t ulTasksCreateCycles;
+
+#if ( configUSE_EDF_TRACE == 1 )
+/* Processor cycles taken by a trace hook to record one event, including the
+ * call, averaged over mainTRACE_BENCHMARK_EVENTS events. */
+#define mainTRACE_BENCHMARK_EVENTS	64
+uint32_t ulTraceEventCycles;
+#endif
 
-uint32_t SystemTime;
-uint32_t CPULoad;
 SemaphoreHandle_t userinput;
 
 /* Strings to transmit */
@@ -145,7 +295,18 @@ char Periodic_STR[]= "PERIODIC_TASK";
 char UARTBuffer[20];
 uint8_t TransmitterBufferLength;
 
-char RunTimeStatsBuffer[200];
+/* Timing state of every task, refreshed by every Periodic_Transmitter job for
+ * a debugger to dump and Tools/edf_snapshot_dump.c to print.  The header and
+ * the records are contiguous, so one dump holds the whole snapshot. */
+#if ( configUSE_EDF_SNAPSHOT == 1 )
+	#define mainSNAPSHOT_MAX_TASKS	12
+
+	struct
+	{
+		SystemSnapshot_t xHeader;
+		TaskSnapshot_t xTasks[ mainSNAPSHOT_MAX_TASKS ];
+	} xTaskSnapshot;
+#endif
 /*
  * Application entry point:
  * Starts all the other tasks, then starts the scheduler. 
@@ -154,16 +315,25 @@ char RunTimeStatsBuffer[200];
 
 
 void Button_1_MonitorTask(void * ptr);
+void Button_1_MonitorJob(void * ptr);
 
 void Button_2_MonitorTask(void * ptr);
+void Button_2_MonitorJob(void * ptr);
 
 void Periodic_TransmitterTask(void * ptr);
+void Periodic_TransmitterJob(void * ptr);
 
 void Uart_ReceiverTask(void * ptr);
 
 void Load_1_SimulationTask(void * ptr);
+void Load_1_SimulationJob(void * ptr);
 
 void Load_2_SimulationTask(void * ptr);
+void Load_2_SimulationJob(void * ptr);
+
+void Aperiodic_LoggerTask(void * ptr);
+
+void HeartbeatCallback(EDFTimerHandle_t xTimer);
 
 void vApplicationTickHook(void){
 	
@@ -173,69 +343,188 @@ void vApplicationTickHook(void){
 
 void vApplicationIdleHook(void){
 	GPIO_write(PORT_0, PIN9, PIN_IS_HIGH);
+
+#if ( configUSE_EDF_TRACE_STREAM == 1 )
+	/* The trace is only streamed when nothing else needs the processor, so
+	 * it never delays a job.  Events recorded while the processor is busy
+	 * wait in the ring, and are dropped and counted if it fills up. */
+	prvTraceStreamPoll();
+#endif
+}
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+void vApplicationGetPeriodicIdleTaskMemory( StaticPeriodicTask_t ** ppxIdleTaskTCBBuffer,
+                                            StackType_t ** ppxIdleTaskStackBuffer,
+                                            uint32_t * pulIdleTaskStackSize ){
+	static StaticPeriodicTask_t xIdleTaskTCB;
+	static StackType_t uxIdleTaskStack[ configMINIMAL_STACK_SIZE ];
+
+	*ppxIdleTaskTCBBuffer = &xIdleTaskTCB;
+	*ppxIdleTaskStackBuffer = uxIdleTaskStack;
+	*pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+#endif
+
+/* Processor cycles counted by timer 1, whose prescaler divides the peripheral
+ * clock, which runs at the processor clock, by T1PR + 1. */
+static uint32_t prvGetCycleCount( void ){
+	uint32_t ulCounter, ulPrescaler;
+
+	do{
+		ulCounter = T1TC;
+		ulPrescaler = T1PC;
+	}while( ulCounter != T1TC );
+
+	return ( ulCounter * ( T1PR + 1UL ) ) + ulPrescaler;
+}
+
+#if ( configUSE_EDF_TRACE == 1 )
+/* Record events through a trace hook while the ring is empty and nothing else
+ * writes to it, then drain them again. */
+static void prvMeasureTraceOverhead( void ){
+	EDFTraceRecord_t xRecords[ 8 ];
+	uint32_t ulStart;
+	UBaseType_t uxEvent;
+
+	ulStart = prvGetCycleCount();
+
+	for( uxEvent = 0; uxEvent < mainTRACE_BENCHMARK_EVENTS; uxEvent++ )
+	{
+		vEDFTraceTick();
+	}
+
+	ulTraceEventCycles = ( prvGetCycleCount() - ulStart ) / mainTRACE_BENCHMARK_EVENTS;
+
+	while( uxEDFTraceDrain( xRecords, sizeof( xRecords ) / sizeof( xRecords[ 0 ] ) ) > 0 )
+	{
+	}
+}
+#endif
+
+#if ( configUSE_EDF_TRACE_STREAM == 1 )
+/* Send the trace stream on UART1, 8N1, from P0.8.  P0.8 and P0.9 then no
+ * longer show the tick and idle trace, as writes to pins that are not
+ * selected as GPIO have no effect. */
+static void prvSetupTraceUart( void ){
+	const unsigned long ulDivisor = ( configCPU_CLOCK_HZ + ( 8UL * mainTRACE_BAUD_RATE ) ) / ( 16UL * mainTRACE_BAUD_RATE );
+
+	PINSEL0 = ( PINSEL0 & ~0x000F0000UL ) | 0x00050000UL;
+	U1LCR = 0x83;
+	U1DLL = ulDivisor & 0xFFUL;
+	U1DLM = ulDivisor >> 8;
+	U1LCR = 0x03;
+	U1FCR = 0x07;
 }
 
+/* Refill the transmit FIFO once it is empty, without waiting for it. */
+static void prvTraceStreamPoll( void ){
+	UBaseType_t uxByte;
+	uint8_t ucByte;
+
+	if( ( U1LSR & mainUART_LSR_THRE ) != 0 )
+	{
+		for( uxByte = 0; uxByte < mainTRACE_FIFO_LENGTH; uxByte++ )
+		{
+			if( xEDFTraceStreamGetByte( &ucByte ) == pdFALSE )
+			{
+				break;
+			}
+
+			U1THR = ucByte;
+		}
+	}
+}
+#endif
+
+/* The periodic tasks, created by main() in a single pass. */
+static const PeriodicTaskEntry_t xPeriodicTasks[] =
+{
+	mainPERIODIC_TASKS( mainTASK_ENTRY )
+};
+
+#define mainNUM_PERIODIC_TASKS	( sizeof( xPeriodicTasks ) / sizeof( xPeriodicTasks[ 0 ] ) )
+
+#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+/* The timing of every row for the processor demand test. */
+#define mainTASK_TIMING( xName, pvCode, uxStack, uxPriority, xPeriod, xDeadline, xWcet, xNonPreemptive, xPoints, xRunToCompletion, uxFirmM, uxFirmK ) \
+	{ ( xPeriod ), ( xDeadline ), ( xWcet ), ( xNonPreemptive ), 0 },
+
+static const EDFAnalysisTask_t xPeriodicTaskTimings[] =
+{
+	mainPERIODIC_TASKS( mainTASK_TIMING )
+};
+#endif
+
 int main( void )
 {
+	UBaseType_t uxTask;
+	size_t xFreeHeapBeforeTasks;
+	uint32_t ulCyclesBeforeTasks;
+
 	/* Setup the hardware for use with the Keil demo board. */
 	prvSetupHardware();
+
+#if ( configUSE_EDF_TRACE == 1 )
+	prvMeasureTraceOverhead();
+#endif
 	
-	
+#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+	{
+		EDFAnalysisTaskSet_t xTaskSet = { xPeriodicTaskTimings, mainNUM_PERIODIC_TASKS, NULL, NULL, 0 };
+
+		/* The deadlines of the table must hold before precedence shortens any
+		 * of them, otherwise admission control rejects tasks below.  Stop
+		 * here rather than run part of the task set. */
+		if( eEDFAnalysisDemandTest( &xTaskSet, NULL ) != eEDFAnalysisFeasible )
+		{
+			for( ;; );
+		}
+	}
+#endif
+
     /* Create the tasks */
-	
-    xTaskPeriodicCreate(
-                    Button_1_MonitorTask,       /* Function that implements the task. */
-                    "Button_1",          /* Text name for the task. */
-                    120,      /* Stack size in words, not bytes. */
-                    ( void * ) 1,    /* Parameter passed into the task. */
-                    1,						/* Priority at which the task is created. */
-                    &xButton_1Handle,	/* Used to pass out the created task's handle. */
-										xButton_1Period);  /* Periodicity of task */    
-									
-	xTaskPeriodicCreate(
-                    Button_2_MonitorTask,       /* Function that implements the task. */
-                    "Button_2",          /* Text name for the task. */
-                    120,      /* Stack size in words, not bytes. */
-                    ( void * ) 1,    /* Parameter passed into the task. */
-                    2,						/* Priority at which the task is created. */
-                    &xButton_2Handle,	/* Used to pass out the created task's handle. */
-										xButton_2Period);  /* Periodicity of task */ 
-										
-	xTaskPeriodicCreate(
-                    Periodic_TransmitterTask,       /* Function that implements the task. */
-                    "Periodic_Transmitter",          /* Text name for the task. */
-                    200,      /* Stack size in words, not bytes. */
-                    ( void * ) 1,    /* Parameter passed into the task. */
-                    3,						/* Priority at which the task is created. */
-                    &xPeriodic_TransmitterHandle,	/* Used to pass out the created task's handle. */
-										xPeriodic_TransmitterPeriod);  /* Periodicity of task */ 
-										
-	xTaskPeriodicCreate(
-                    Uart_ReceiverTask,       /* Function that implements the task. */
-                    "Uart_Receiver",          /* Text name for the task. */
-                    200,      /* Stack size in words, not bytes. */
-                    ( void * ) 1,    /* Parameter passed into the task. */
-                    4,						/* Priority at which the task is created. */
-                    &xUart_ReceiverTaskHandle,	/* Used to pass out the created task's handle. */
-										xUart_ReceiverTaskPeriod);  /* Periodicity of task */ 
-										
-	xTaskPeriodicCreate(
-                    Load_1_SimulationTask,       /* Function that implements the task. */
-                    "Load_1_Simulation",          /* Text name for the task. */
-                    200,      /* Stack size in words, not bytes. */
-                    ( void * ) 1,    /* Parameter passed into the task. */
-                    5,						/* Priority at which the task is created. */
-                    &xLoad_1_SimulationHandle,	/* Used to pass out the created task's handle. */
-										xLoad_1_SimulationPeriod);  /* Periodicity of task */ 
-										
-	xTaskPeriodicCreate(
-                    Load_2_SimulationTask,       /* Function that implements the task. */
-                    "Load_2_Simulation",          /* Text name for the task. */
-                    200,      /* Stack size in words, not bytes. */
-                    ( void * ) 1,    /* Parameter passed into the task. */
-                    6,						/* Priority at which the task is created. */
-                    &xLoad_2_SimulationHandle,	/* Used to pass out the created task's handle. */
-										xLoad_2_SimulationPeriod);  /* Periodicity of task */ 
+	xFreeHeapBeforeTasks = xPortGetFreeHeapSize();
+	ulCyclesBeforeTasks = prvGetCycleCount();
+
+	for( uxTask = 0; uxTask < mainNUM_PERIODIC_TASKS; uxTask++ )
+	{
+		const PeriodicTaskEntry_t * const pxTask = &( xPeriodicTasks[ uxTask ] );
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+		xTaskPeriodicCreateStatic( &( pxTask->xParameters ), pxTask->puxStack, pxTask->pxTCB, pxTask->pxHandle );
+#else
+		xTaskPeriodicCreateFromParameters( &( pxTask->xParameters ), pxTask->pxHandle );
+#endif
+	}
+
+#if ( configUSE_EDF_PRECEDENCE == 1 )
+	xTaskAddPrecedence( xButton_1Handle, xUart_ReceiverHandle, xUart_ReceiverEndToEndDeadline );
+	xTaskAddPrecedence( xButton_2Handle, xUart_ReceiverHandle, xUart_ReceiverEndToEndDeadline );
+	xTaskAddPrecedence( xPeriodic_TransmitterHandle, xUart_ReceiverHandle, xUart_ReceiverEndToEndDeadline );
+#endif
+
+#if ( configUSE_EDF_TIMERS == 1 )
+	xEDFTimerServiceStart();
+	xHeartbeatTimer = xEDFTimerCreate( "Heartbeat", xHeartbeatPeriod, xHeartbeatDeadline, xHeartbeatWcet, pdTRUE, NULL, HeartbeatCallback );
+	xEDFTimerStart( xHeartbeatTimer, 0 );
+#endif
+
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+	xTaskAperiodicCreate( Aperiodic_LoggerTask, "Aperiodic_Logger", 100, ( void * ) 1, 7, &xAperiodic_LoggerHandle );
+#endif
+
+	xTasksHeapUsage = xFreeHeapBeforeTasks - xPortGetFreeHeapSize();
+	ulTasksCreateCycles = prvGetCycleCount() - ulCyclesBeforeTasks;
+
+	/* Tag the tasks with the pin the trace hooks drive while they run.  Jobs
+	 * that run to completion start afresh every period so cannot tag
+	 * themselves once. */
+	vTaskSetApplicationTaskTag( xButton_1Handle, ( void * ) PIN2 );
+	vTaskSetApplicationTaskTag( xButton_2Handle, ( void * ) PIN3 );
+	vTaskSetApplicationTaskTag( xPeriodic_TransmitterHandle, ( void * ) PIN4 );
+	vTaskSetApplicationTaskTag( xUart_ReceiverHandle, ( void * ) PIN5 );
+	vTaskSetApplicationTaskTag( xLoad_1_SimulationHandle, ( void * ) PIN6 );
+	vTaskSetApplicationTaskTag( xLoad_2_SimulationHandle, ( void * ) PIN7 );
 
 
 	/* Create Queue to receives messages for UART */
@@ -245,6 +534,10 @@ int main( void )
                          /* Size of each item is big enough to hold the
                          whole structure. */
                          sizeof(UARTBuffer) );
+
+#if ( configUSE_QUEUE_LATENCY == 1 )
+	xQueueLatencyRegister( xUARTQueue );
+#endif
 										
 										
 	/* Now all the tasks have been started - start the scheduler */
@@ -284,110 +577,218 @@ static void prvSetupHardware( void )
 	/* Config trace timer 1 and read T1TC to get current tick */
 	configTimer1();
 
+#if ( configUSE_EDF_TRACE_STREAM == 1 )
+	prvSetupTraceUart();
+#endif
+
 	/* Setup the peripheral bus to be the same as the PLL output. */
 	VPBDIV = mainBUS_CLK_FULL;
 }
 /*-----------------------------------------------------------*/
 
 /* Button_1_Monitor Code */ 
+void Button_1_MonitorJob(void * ptr){
+
+	if((BUTTON_1_STATE) == PIN_IS_HIGH)
+	{
+		TransmitterBufferLength = strlen(Button_1_RIS);
+		xQueueSend(xUARTQueue,( void * ) &Button_1_RIS,( TickType_t ) 0 );
+	}
+	else if((BUTTON_1_STATE) == PIN_IS_LOW)
+	{
+		TransmitterBufferLength = strlen(Button_1_FAl);
+		xQueueSend(xUARTQueue,( void * ) &Button_1_FAl,( TickType_t ) 0 );
+	}
+}
+
 void Button_1_MonitorTask(void * ptr){
 
 	const TickType_t xDelay = xButton_1Period;
 	TickType_t xLastWakeTime = xTaskGetTickCount();	
-	vTaskSetApplicationTaskTag( NULL, ( void * ) 1 );
 	for(;;){
-				if((BUTTON_1_STATE) == PIN_IS_HIGH)
-				{
-					TransmitterBufferLength = strlen(Button_1_RIS);
-					xQueueSend(xUARTQueue,( void * ) &Button_1_RIS,( TickType_t ) 0 );
-				}
-				else if((BUTTON_1_STATE) == PIN_IS_LOW)
-				{
-					TransmitterBufferLength = strlen(Button_1_FAl);
-					xQueueSend(xUARTQueue,( void * ) &Button_1_FAl,( TickType_t ) 0 );
-				}
+			Button_1_MonitorJob(ptr);
 			vTaskDelayUntil( &xLastWakeTime,xDelay);
 	}
 }
 
 /* Button_2_Monitor Code */ 
+void Button_2_MonitorJob(void * ptr){
+
+	if((BUTTON_2_STATE) == PIN_IS_HIGH)
+	{
+		TransmitterBufferLength = strlen(Button_2_RIS);
+		xQueueSend(xUARTQueue,( void * ) &Button_2_RIS,( TickType_t ) 0 );
+	}
+	else if((BUTTON_2_STATE) == PIN_IS_LOW)
+	{
+		TransmitterBufferLength = strlen(Button_2_FAl);
+		xQueueSend(xUARTQueue,( void * ) &Button_2_FAl,( TickType_t ) 0 );
+	}
+}
+
 void Button_2_MonitorTask(void * ptr){
 
 	const TickType_t xDelay = xButton_2Period;
 	TickType_t xLastWakeTime = xTaskGetTickCount();
-	vTaskSetApplicationTaskTag( NULL, ( void * ) 2 );	
 	for(;;){
-					if((BUTTON_2_STATE) == PIN_IS_HIGH)
-					{
-						TransmitterBufferLength = strlen(Button_2_RIS);
-						xQueueSend(xUARTQueue,( void * ) &Button_2_RIS,( TickType_t ) 0 );
-					}
-					else if((BUTTON_2_STATE) == PIN_IS_LOW)
-					{
-						TransmitterBufferLength = strlen(Button_2_FAl);
-						xQueueSend(xUARTQueue,( void * ) &Button_2_FAl,( TickType_t ) 0 );
-					}
-					
+			Button_2_MonitorJob(ptr);
 			vTaskDelayUntil( &xLastWakeTime,xDelay);
 	}
 }
 
 /* Send preiodic string every 100ms to the consumer task */ 
+void Periodic_TransmitterJob(void * ptr){
+
+	TransmitterBufferLength = strlen(Periodic_STR);
+	xQueueSend(xUARTQueue,( void * ) &Periodic_STR,( TickType_t ) 0 );
+
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+	xTaskNotifyGive(xAperiodic_LoggerHandle);
+#endif
+
+#if ( configUSE_EDF_FIRM_DEADLINES == 1 )
+	xTaskGetFirmStatus(NULL, &xPeriodic_TransmitterFirmStatus);
+#endif
+
+#if ( configUSE_QUEUE_LATENCY == 1 )
+	xQueueLatencyGetStats(xUARTQueue, &xUARTQueueLatencyStats, pdFALSE);
+#endif
+
+#if ( configUSE_EDF_SNAPSHOT == 1 )
+	uxTaskGetSnapshot(&xTaskSnapshot.xHeader, xTaskSnapshot.xTasks, mainSNAPSHOT_MAX_TASKS);
+#endif
+}
+
 void Periodic_TransmitterTask(void * ptr){
 
 	const TickType_t xDelay = xPeriodic_TransmitterPeriod;
 	TickType_t xLastWakeTime = xTaskGetTickCount();
-	vTaskSetApplicationTaskTag( NULL, ( void * ) 3 );
 	for(;;){
-
-				TransmitterBufferLength = strlen(Periodic_STR);
-				xQueueSend(xUARTQueue,( void * ) &Periodic_STR,( TickType_t ) 0 );
-
+				Periodic_TransmitterJob(ptr);
 				vTaskDelayUntil( &xLastWakeTime,xDelay);
 		}
 }
 
-/* write on UART any received string from other tasks */
+/* write on UART any received string from other tasks.  The serial driver
+ * may block, so this task keeps its own stack. */
+#if ( configUSE_EDF_PRECEDENCE == 1 )
 void Uart_ReceiverTask(void * ptr){
 
-	const TickType_t xDelay = xUart_ReceiverTaskPeriod;
+	for(;;){
+				/* Each string queued by a producer releases one job. */
+				if( xQueueReceive(xUARTQueue, ( void * )UARTBuffer, portMAX_DELAY) == pdPASS )
+				{
+					vSerialPutString((const signed char * const)UARTBuffer, (uint16_t)TransmitterBufferLength);
+					xSerialPutChar('\n');
+#if ( configUSE_QUEUE_LATENCY == 1 )
+					vQueueLatencyItemDone(xUARTQueue);
+#endif
+				}
+		}
+}
+#else
+void Uart_ReceiverTask(void * ptr){
+
+	const TickType_t xDelay = xUart_ReceiverPeriod;
 	TickType_t xLastWakeTime = xTaskGetTickCount();
-	vTaskSetApplicationTaskTag( NULL, ( void * ) 4 );
 	for(;;){
 				xQueueReceive(xUARTQueue, ( void * )UARTBuffer, (TickType_t) 0);
 				vSerialPutString((const signed char * const)UARTBuffer, (uint16_t)TransmitterBufferLength);
 				xSerialPutChar('\n');
+#if ( configUSE_QUEUE_LATENCY == 1 )
+				vQueueLatencyItemDone(xUARTQueue);
+#endif
 				vTaskDelayUntil( &xLastWakeTime,xDelay);
 		}
 }
+#endif
+
 
+void Load_1_SimulationJob(void * ptr){
+
+	uint32_t Counts;
+	for(Counts=0; Counts < 37200; Counts++)
+	{
+	}
+}
 
 void Load_1_SimulationTask(void * ptr){
 	
 	const TickType_t xDelay = xLoad_1_SimulationPeriod;
 	TickType_t xLastWakeTime = xTaskGetTickCount();
-	vTaskSetApplicationTaskTag( NULL, ( void * ) 5 );
 	for(;;){
-				uint32_t Counts;
-				for(Counts=0; Counts < 37200; Counts++)
-				{
-				}	
+				Load_1_SimulationJob(ptr);
 				vTaskDelayUntil( &xLastWakeTime,xDelay);
 		}
 }
 
+void Load_2_SimulationJob(void * ptr){
+
+	uint32_t Chunk;
+	uint32_t Counts;
+	for(Chunk=0; Chunk < mainLOAD_2_CHUNKS; Chunk++)
+	{
+		for(Counts=0; Counts < mainLOAD_2_CHUNK_COUNTS; Counts++)
+		{
+		}
+		vTaskPreemptionPoint();
+	}
+}
+
 void Load_2_SimulationTask(void * ptr){
 
 	const TickType_t xDelay = xLoad_2_SimulationPeriod;
 	TickType_t xLastWakeTime = xTaskGetTickCount();
-	vTaskSetApplicationTaskTag( NULL, ( void * ) 6 );
 	
 	for(;;){
-				uint32_t Counts;
-				for(Counts=0; Counts < 88500; Counts++)
+				Load_2_SimulationJob(ptr);
+				vTaskDelayUntil( &xLastWakeTime,xDelay);
+		}
+}
+
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+
+/* Aperiodic job released by Periodic_Transmitter.  Its response time only
+ * depends on whether it waits for the periodic tasks to go idle. */
+void Aperiodic_LoggerTask(void * ptr){
+
+	uint32_t Counts;
+	uint32_t Jobs = 0;
+	BaseType_t xSlackStealing = pdTRUE;
+
+	for(;;){
+				ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+				/* The statistics hold every job before this one. */
+				if(++Jobs == mainAPERIODIC_JOBS_PER_RUN)
 				{
+					Jobs = 0;
+					vTaskGetAperiodicStats((xSlackStealing != pdFALSE) ? &xAperiodicStatsSlack : &xAperiodicStatsBackground, pdTRUE);
+					xSlackStealing = (xSlackStealing != pdFALSE) ? pdFALSE : pdTRUE;
+					vTaskSetSlackStealing(xSlackStealing);
 				}
 
-				vTaskDelayUntil( &xLastWakeTime,xDelay);
+				for(Counts=0; Counts < mainAPERIODIC_JOB_COUNTS; Counts++)
+				{
+				}
 		}
 }
+
+#endif
+
+#if ( configUSE_EDF_TIMERS == 1 )
+
+/* Software timer callback, run by the EDF timer service task. */
+void HeartbeatCallback(EDFTimerHandle_t xTimer){
+
+	const TickType_t xLateness = xTaskGetTickCount() - xEDFTimerGetExpiryTime(xTimer);
+
+	ulHeartbeatCount++;
+
+	if(xLateness > xHeartbeatMaxLateness)
+	{
+		xHeartbeatMaxLateness = xLateness;
+	}
+}
+
+#endif
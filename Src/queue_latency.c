@@ -0,0 +1,252 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - queue latency tracking
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "queue_latency.h"
+
+#if ( configUSE_QUEUE_LATENCY == 1 )
+
+/* The send times of the items in a registered queue, oldest first, and the
+ * latencies measured so far. */
+typedef struct xQUEUE_LATENCY
+{
+    QueueHandle_t xQueue;                                                      /*< The registered queue, NULL if the entry is free. */
+    UBaseType_t uxOldest;                                                      /*< Index in aulSendTimes of the send time of the item at the front of the queue. */
+    UBaseType_t uxWaiting;                                                     /*< Number of items in the queue. */
+    configRUN_TIME_COUNTER_TYPE aulSendTimes[ configQUEUE_LATENCY_MAX_ITEMS ]; /*< Ring of the send times of the items in the queue. */
+    configRUN_TIME_COUNTER_TYPE ulReceivedSendTime;                            /*< Send time of the item received last. */
+    BaseType_t xReceivedPending;                                               /*< pdTRUE from the time an item is received until vQueueLatencyItemDone() is called. */
+    Histogram_t xQueueing;                                                     /*< Time from send to receive of every item. */
+    Histogram_t xEndToEnd;                                                     /*< Time from send to vQueueLatencyItemDone() of every item. */
+} QueueLatency_t;
+
+static QueueLatency_t xQueueLatencies[ configQUEUE_LATENCY_MAX_QUEUES ];
+
+/*
+ * Returns the entry of the registered queue pvQueue, or NULL if pvQueue is not
+ * registered.
+ */
+static QueueLatency_t * prvQueueLatencyFind( const void * pvQueue );
+
+/*
+ * Returns the current value of the run time counter.
+ */
+static configRUN_TIME_COUNTER_TYPE prvQueueLatencyNow( void );
+
+/*-----------------------------------------------------------*/
+
+static QueueLatency_t * prvQueueLatencyFind( const void * pvQueue )
+{
+    UBaseType_t uxEntry;
+    QueueLatency_t * pxReturn = NULL;
+
+    for( uxEntry = 0; uxEntry < ( UBaseType_t ) configQUEUE_LATENCY_MAX_QUEUES; uxEntry++ )
+    {
+        if( ( const void * ) xQueueLatencies[ uxEntry ].xQueue == pvQueue )
+        {
+            pxReturn = &( xQueueLatencies[ uxEntry ] );
+            break;
+        }
+    }
+
+    return pxReturn;
+}
+/*-----------------------------------------------------------*/
+
+static configRUN_TIME_COUNTER_TYPE prvQueueLatencyNow( void )
+{
+    configRUN_TIME_COUNTER_TYPE ulNow;
+
+    #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+        portALT_GET_RUN_TIME_COUNTER_VALUE( ulNow );
+    #else
+        ulNow = portGET_RUN_TIME_COUNTER_VALUE();
+    #endif
+
+    return ulNow;
+}
+/*-----------------------------------------------------------*/
+
+void vQueueLatencyTraceSend( void * pvQueue,
+                             long lCopyPosition )
+{
+    QueueLatency_t * pxLatency;
+    UBaseType_t uxIndex;
+
+    /* Called with the queue locked by traceQUEUE_SEND() and
+     * traceQUEUE_SEND_FROM_ISR() just before the item is copied in. */
+    if( pvQueue != NULL )
+    {
+        pxLatency = prvQueueLatencyFind( pvQueue );
+
+        if( pxLatency != NULL )
+        {
+            if( lCopyPosition == ( long ) queueOVERWRITE )
+            {
+                /* The item replaces the only item the queue can hold. */
+                pxLatency->uxWaiting = 0;
+            }
+
+            if( pxLatency->uxWaiting < ( UBaseType_t ) configQUEUE_LATENCY_MAX_ITEMS )
+            {
+                if( lCopyPosition == ( long ) queueSEND_TO_FRONT )
+                {
+                    pxLatency->uxOldest = ( pxLatency->uxOldest == 0 ) ? ( UBaseType_t ) ( configQUEUE_LATENCY_MAX_ITEMS - 1 ) : ( pxLatency->uxOldest - 1 );
+                    uxIndex = pxLatency->uxOldest;
+                }
+                else
+                {
+                    uxIndex = ( pxLatency->uxOldest + pxLatency->uxWaiting ) % ( UBaseType_t ) configQUEUE_LATENCY_MAX_ITEMS;
+                }
+
+                pxLatency->aulSendTimes[ uxIndex ] = prvQueueLatencyNow();
+                ( pxLatency->uxWaiting )++;
+            }
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vQueueLatencyTraceReceive( void * pvQueue )
+{
+    QueueLatency_t * pxLatency;
+    configRUN_TIME_COUNTER_TYPE ulSendTime;
+
+    /* Called with the queue locked by traceQUEUE_RECEIVE() and
+     * traceQUEUE_RECEIVE_FROM_ISR() just before the item is copied out. */
+    if( pvQueue != NULL )
+    {
+        pxLatency = prvQueueLatencyFind( pvQueue );
+
+        if( ( pxLatency != NULL ) && ( pxLatency->uxWaiting > 0 ) )
+        {
+            ulSendTime = pxLatency->aulSendTimes[ pxLatency->uxOldest ];
+            pxLatency->uxOldest = ( pxLatency->uxOldest + 1 ) % ( UBaseType_t ) configQUEUE_LATENCY_MAX_ITEMS;
+            ( pxLatency->uxWaiting )--;
+
+            vHistogramRecord( &( pxLatency->xQueueing ), ( uint32_t ) ( prvQueueLatencyNow() - ulSendTime ) );
+
+            pxLatency->ulReceivedSendTime = ulSendTime;
+            pxLatency->xReceivedPending = pdTRUE;
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueueLatencyRegister( QueueHandle_t xQueue )
+{
+    BaseType_t xReturn = pdFAIL;
+    QueueLatency_t * pxLatency;
+
+    configASSERT( xQueue );
+    configASSERT( uxQueueMessagesWaiting( xQueue ) == 0 );
+
+    if( uxQueueSpacesAvailable( xQueue ) <= ( UBaseType_t ) configQUEUE_LATENCY_MAX_ITEMS )
+    {
+        taskENTER_CRITICAL();
+        {
+            pxLatency = prvQueueLatencyFind( NULL );
+
+            if( pxLatency != NULL )
+            {
+                pxLatency->uxOldest = 0;
+                pxLatency->uxWaiting = 0;
+                pxLatency->xReceivedPending = pdFALSE;
+                vHistogramReset( &( pxLatency->xQueueing ) );
+                vHistogramReset( &( pxLatency->xEndToEnd ) );
+
+                /* Set last so the trace macros ignore the entry until it is
+                 * initialised. */
+                pxLatency->xQueue = xQueue;
+                xReturn = pdPASS;
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vQueueLatencyItemDone( QueueHandle_t xQueue )
+{
+    QueueLatency_t * pxLatency;
+
+    configASSERT( xQueue );
+
+    taskENTER_CRITICAL();
+    {
+        pxLatency = prvQueueLatencyFind( xQueue );
+
+        if( ( pxLatency != NULL ) && ( pxLatency->xReceivedPending != pdFALSE ) )
+        {
+            vHistogramRecord( &( pxLatency->xEndToEnd ), ( uint32_t ) ( prvQueueLatencyNow() - pxLatency->ulReceivedSendTime ) );
+            pxLatency->xReceivedPending = pdFALSE;
+        }
+    }
+    taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueueLatencyGetStats( QueueHandle_t xQueue,
+                                  QueueLatencyStats_t * const pxStats,
+                                  BaseType_t xReset )
+{
+    QueueLatency_t * pxLatency;
+    BaseType_t xReturn = pdFAIL;
+
+    configASSERT( xQueue );
+    configASSERT( pxStats );
+
+    taskENTER_CRITICAL();
+    {
+        pxLatency = prvQueueLatencyFind( xQueue );
+
+        if( pxLatency != NULL )
+        {
+            vHistogramGetSummary( &( pxLatency->xQueueing ), &( pxStats->xQueueing ) );
+            vHistogramGetSummary( &( pxLatency->xEndToEnd ), &( pxStats->xEndToEnd ) );
+
+            if( xReset != pdFALSE )
+            {
+                vHistogramReset( &( pxLatency->xQueueing ) );
+                vHistogramReset( &( pxLatency->xEndToEnd ) );
+            }
+
+            xReturn = pdPASS;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_QUEUE_LATENCY */
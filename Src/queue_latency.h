@@ -0,0 +1,153 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - queue latency tracking
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Measures how long items spend in a queue and how long it takes until the
+ * receiving task has finished with them.  When configUSE_QUEUE_LATENCY is set
+ * to 1 the queue trace macros record the run time counter value at which each
+ * item of a registered queue was sent, in a ring of timestamps kept next to the
+ * queue instead of in the items themselves.  When the item is received the
+ * time it spent in the queue is added to the queueing histogram of the queue,
+ * and when the receiving task calls vQueueLatencyItemDone() the time since it
+ * was sent is added to the end-to-end histogram.  All times are in run time
+ * counter increments.
+ *
+ * Items sent to the front of a queue from an interrupt are recorded as if they
+ * were sent to the back, as the queue trace macros called from interrupts do
+ * not report the position.
+ */
+
+#ifndef INC_QUEUE_LATENCY_H
+#define INC_QUEUE_LATENCY_H
+
+#ifndef INC_QUEUE_H
+    #error "include FreeRTOS.h and queue.h must appear in source files before include queue_latency.h"
+#endif
+
+#include "histogram.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/* Set to 1 to measure the latency of the items of registered queues.  The
+ * queue trace macros must then be defined in FreeRTOSConfig.h as shown there. */
+#ifndef configUSE_QUEUE_LATENCY
+    #define configUSE_QUEUE_LATENCY    0
+#endif
+
+/* Number of queues that can be registered. */
+#ifndef configQUEUE_LATENCY_MAX_QUEUES
+    #define configQUEUE_LATENCY_MAX_QUEUES    1
+#endif
+
+/* Longest queue that can be registered. */
+#ifndef configQUEUE_LATENCY_MAX_ITEMS
+    #define configQUEUE_LATENCY_MAX_ITEMS    4
+#endif
+
+#if ( configUSE_QUEUE_LATENCY == 1 )
+    #if ( configGENERATE_RUN_TIME_STATS != 1 )
+        #error configUSE_QUEUE_LATENCY requires configGENERATE_RUN_TIME_STATS to be set to 1
+    #endif
+
+    /* Queue sets send to their container queue without reporting the
+     * position, so they cannot be traced. */
+    #if ( configUSE_QUEUE_SETS == 1 )
+        #error configUSE_QUEUE_LATENCY cannot be used with configUSE_QUEUE_SETS
+    #endif
+#endif
+
+/* Used with the xQueueLatencyGetStats() function to return the latency
+ * distributions of a queue. */
+typedef struct xQUEUE_LATENCY_STATS
+{
+    HistogramSummary_t xQueueing; /*< From the time an item is sent until it is received. */
+    HistogramSummary_t xEndToEnd; /*< From the time an item is sent until the receiving task is done with it. */
+} QueueLatencyStats_t;
+
+/**
+ * queue_latency. h
+ * <pre>
+ * BaseType_t xQueueLatencyRegister( QueueHandle_t xQueue );
+ * </pre>
+ *
+ * Start measuring the latency of the items sent to xQueue, which must be
+ * empty.  Queues cannot be unregistered, so a registered queue must never be
+ * deleted, nor reset while it holds items.
+ *
+ * @return pdPASS if the queue was registered.  pdFAIL if
+ * configQUEUE_LATENCY_MAX_QUEUES queues are already registered or the queue
+ * can hold more than configQUEUE_LATENCY_MAX_ITEMS items.
+ */
+#if ( configUSE_QUEUE_LATENCY == 1 )
+    BaseType_t xQueueLatencyRegister( QueueHandle_t xQueue );
+#endif
+
+/**
+ * queue_latency. h
+ * <pre>
+ * void vQueueLatencyItemDone( QueueHandle_t xQueue );
+ * </pre>
+ *
+ * Called by the task receiving from xQueue once it has finished processing the
+ * item it received last, to record the end-to-end latency of the item.  Does
+ * nothing if no item was received since the previous call, so it can be called
+ * whether or not the receive succeeded.  Only one task may receive from a
+ * registered queue.
+ */
+#if ( configUSE_QUEUE_LATENCY == 1 )
+    void vQueueLatencyItemDone( QueueHandle_t xQueue );
+#endif
+
+/**
+ * queue_latency. h
+ * <pre>
+ * BaseType_t xQueueLatencyGetStats( QueueHandle_t xQueue, QueueLatencyStats_t * const pxStats, BaseType_t xReset );
+ * </pre>
+ *
+ * Populate a QueueLatencyStats_t structure with the latencies of xQueue, and
+ * clear them if xReset is pdTRUE.
+ *
+ * @return pdPASS, or pdFAIL if xQueue is not registered.
+ */
+#if ( configUSE_QUEUE_LATENCY == 1 )
+    BaseType_t xQueueLatencyGetStats( QueueHandle_t xQueue,
+                                      QueueLatencyStats_t * const pxStats,
+                                      BaseType_t xReset );
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* INC_QUEUE_LATENCY_H */
@@ -40,6 +40,7 @@
 #include "task.h"
 #include "timers.h"
 #include "stack_macros.h"
+#include "edf.h"
 
 /* Lint e9021, e961 and e750 are suppressed as a MISRA exception justified
  * because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
@@ -58,6 +59,10 @@
     #include <stdio.h>
 #endif /* configUSE_STATS_FORMATTING_FUNCTIONS == 1 ) */
 
+#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+    #include "edf_analysis.h"
+#endif
+
 #if ( configUSE_PREEMPTION == 0 )
 
 /* If the cooperative scheduler is being used then a yield should not be
@@ -92,6 +97,14 @@
     #define tskSET_NEW_STACKS_TO_KNOWN_VALUE    0
 #endif
 
+/* The release time and execution time of the current job of each task are
+ * tracked if any of the following EDF extensions are used. */
+#if ( ( configUSE_EDF_MIXED_CRITICALITY == 1 ) || ( configUSE_EDF_RECLAIMING == 1 ) || ( configUSE_EDF_SLACK_STEALING == 1 ) || ( configUSE_EDF_FIRM_DEADLINES == 1 ) || ( configUSE_EDF_PRECEDENCE == 1 ) )
+    #define tskEDF_TRACK_JOBS    1
+#else
+    #define tskEDF_TRACK_JOBS    0
+#endif
+
 /*
  * Macros used by vListTask to indicate which state a task is in.
  */
@@ -144,7 +157,7 @@
         }                                                                     \
 				/* listGET_OWNER_OF_NEXT_ENTRY indexes through the list, so the tasks of \
          * the  same priority get an equal share of the processor time. */                    \
-					listGET_OWNER_OF_NEXT_ENTRY(pxCurrentTCB, &(pxReadyTasksLists[xTopPriority])); \
+					listGET_OWNER_OF_NEXT_ENTRY(pxCurrentTCB, &(pxReadyTasksLists[uxTopPriority])); \
 					uxTopReadyPriority = uxTopPriority;                                                   \
     } /* taskSELECT_HIGHEST_PRIORITY_TASK */
 
@@ -226,7 +239,7 @@
 	#define prvAddTaskToReadyList( pxTCB )																			\
 					traceMOVED_TASK_TO_READY_STATE( pxTCB );\
 					taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );                  \
-					vListInsert(&(pxReadyTasksLists), &( ( pxTCB )->xStateListItem ) );	\
+					taskEDF_INSERT_READY_TASK( pxTCB );	\
 					tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
 #endif
 		
@@ -276,6 +289,92 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
 		/* E.C. : the period of a task */
 		#if ( configUSE_EDF_SCHEDULER == 1 )
 						TickType_t xTaskPeriod; 						/*< Stores the period in tick of the task. > */
+						TickType_t xTaskDeadline;                       /*< Relative deadline of the jobs of the task in ticks, at most the period. */
+						TickType_t xTaskWcet;                           /*< Worst case execution time of one job in ticks, 0 if unknown. */
+						struct tskTaskControlBlock * pxNextPeriodicTCB; /*< Links all periodic tasks so admission control can inspect the task set. */
+		#endif
+
+		#if ( configUSE_EDF_LIMITED_PREEMPTION == 1 )
+						TickType_t xTaskMaxNonPreemptive;               /*< Longest non-preemptive execution of the task in ticks. */
+						volatile UBaseType_t uxNonPreemptiveNesting;    /*< The task cannot be preempted while this is non zero. */
+		#endif
+
+		#if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+						TickType_t xTaskPreemptionThreshold;            /*< Only tasks with a period below this value can preempt a started job of the task. */
+						struct tskTaskControlBlock * pxPreemptedTCB;    /*< The next task down the preemption stack. */
+						BaseType_t xOnPreemptionStack;                  /*< pdTRUE from the time a job starts executing until the task leaves the ready list. */
+		#endif
+
+		#if ( configUSE_EDF_SHARED_STACK == 1 )
+						TaskFunction_t pxJobCode;                       /*< Function executing one job of a run-to-completion task, NULL for other tasks. */
+						void * pvJobParameters;                         /*< Parameter passed to pxJobCode. */
+						TickType_t xLastReleaseTime;                    /*< Release time of the latest job of a run-to-completion task. */
+		#endif
+
+		#if ( configUSE_EDF_MIXED_CRITICALITY == 1 )
+						eTaskCriticality eCriticality;                  /*< Criticality level of the task. */
+						TickType_t xTaskWcetHigh;                       /*< Worst case execution time of one job in ticks assumed in HI criticality mode. */
+		#endif
+
+		#if ( tskEDF_TRACK_JOBS == 1 )
+						TickType_t xTaskReleaseTime;                    /*< Release time of the current job. */
+						configRUN_TIME_COUNTER_TYPE ulJobRunTime;       /*< Run time counter value consumed by the current job, excluding the time since it was last switched in. */
+		#endif
+
+		#if ( configUSE_EDF_RECLAIMING == 1 )
+						UBaseType_t uxReclaimState;                     /*< Whether the utilisation of the task counts towards the active utilisation. */
+						TickType_t xReclaimInactiveTime;                /*< The 0-lag time of the completed job, at which the task becomes inactive. */
+		#endif
+
+		#if ( configUSE_EDF_SERVERS == 1 )
+						struct xEDF_SERVER * pxServer;                  /*< The server the task is scheduled in, NULL if it is scheduled directly. */
+		#endif
+
+		#if ( configUSE_EDF_SLACK_STEALING == 1 )
+						BaseType_t xAperiodic;                          /*< pdTRUE if the task runs aperiodic jobs in the slack of the periodic tasks. */
+						BaseType_t xAperiodicJobPending;                /*< pdTRUE from the time an aperiodic job is released until it completes. */
+						TickType_t xAperiodicReleaseTime;               /*< Release time of the pending aperiodic job. */
+		#endif
+
+		#if ( configUSE_EDF_FIRM_DEADLINES == 1 )
+						UBaseType_t uxFirmMandatory;                    /*< m of the (m,k)-firm constraint of the task. */
+						UBaseType_t uxFirmWindow;                       /*< k of the (m,k)-firm constraint of the task, 0 if every job is mandatory. */
+						uint32_t ulFirmHistory;                         /*< One bit per job, most recent job in bit 0, set if the job met its deadline. */
+						uint32_t ulFirmSkipHistory;                     /*< One bit per job, most recent job in bit 0, set if the job was skipped. */
+						uint32_t ulFirmMetJobs;                         /*< Number of jobs that met their deadline. */
+						uint32_t ulFirmMissedJobs;                      /*< Number of jobs that completed after their deadline. */
+						uint32_t ulFirmSkippedJobs;                     /*< Number of jobs skipped on release. */
+						uint32_t ulFirmViolations;                      /*< Number of jobs after which the (m,k)-firm constraint was not met. */
+						TickType_t * pxFirmWakeTime;                    /*< The previous wake time passed to xTaskDelayUntil() while the task is delayed by it, otherwise NULL. */
+		#endif
+
+		#if ( configUSE_EDF_PRECEDENCE == 1 )
+						struct tskTaskControlBlock * pxPrecedenceSuccessor; /*< The task that consumes the output of this task, NULL if there is none. */
+						TickType_t xPrecedenceWindow;                   /*< End-to-end deadline from the release of a job of this task to the completion of the job of its successor. */
+						TickType_t xPrecedenceLimit;                    /*< Latest completion of a job of this task, relative to its release, that leaves the tasks after it enough time.  portMAX_DELAY if it has no successor. */
+						TickType_t xTaskRelativeDeadline;               /*< The smaller of xTaskDeadline and xPrecedenceLimit. */
+						const struct tskTaskControlBlock * pxPrecedenceSender; /*< The task that readied this task while the scheduler was suspended, NULL if there is none or an interrupt did. */
+		#endif
+
+		#if ( configUSE_EDF_TIMERS == 1 )
+						TickType_t xTaskWakeDeadline;                   /*< Absolute deadline of the jobs released when the task is unblocked, portMAX_DELAY to derive it from the period. */
+		#endif
+
+		#if ( configUSE_EDF_DEFERRED_INTERRUPTS == 1 )
+						TickType_t xTaskDeferredDeadline;               /*< Absolute deadline of the job an interrupt readied while the scheduler was suspended, portMAX_DELAY if there is none. */
+						TickType_t xTaskDeferredRelease;                /*< Tick of the interrupt that released the job with xTaskDeferredDeadline. */
+		#endif
+
+		#if ( configUSE_EDF_JOB_STATISTICS == 1 )
+						Histogram_t xJobResponseTimes;                  /*< Response times of the completed jobs in run time counter increments. */
+						Histogram_t xJobTardiness;                      /*< Lateness of the completed jobs that missed their deadline, 0 for the others. */
+						int32_t lJobMinLateness;                        /*< Lateness of the earliest completed job. */
+						int32_t lJobMaxLateness;                        /*< Lateness of the latest completed job. */
+						int64_t llJobTotalLateness;                     /*< Sum of the lateness of the completed jobs. */
+		#endif
+
+		#if ( configUSE_EDF_SNAPSHOT == 1 )
+						uint32_t ulMissedDeadlines;                     /*< Number of jobs completed by xTaskDelayUntil() after their deadline. */
 		#endif
 	
     #if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
@@ -347,6 +446,52 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
  * below to enable the use of older kernel aware debuggers. */
 typedef tskTCB TCB_t;
 
+#if ( configUSE_EDF_SERVERS == 1 )
+
+/*
+ * A server reserves xBudget ticks of processor time every xPeriod ticks for
+ * the tasks attached to it.  While it has budget and a ready task the server
+ * is held in xEDFServerReadyList, ordered by the end of its current period.
+ */
+    typedef struct xEDF_SERVER
+    {
+        ListItem_t xServerListItem;         /*< Used to reference the server from xEDFServerReadyList.  Its value is the deadline of the server. */
+        List_t xReadyTasksList;             /*< The ready tasks attached to the server. */
+        eServerPolicy ePolicy;              /*< The order in which ready tasks are held in xReadyTasksList. */
+        TickType_t xBudget;                 /*< Ticks of processor time reserved every period. */
+        TickType_t xPeriod;                 /*< The server period in ticks. */
+        TickType_t xRemainingBudget;        /*< Ticks of budget left in the current period. */
+        TickType_t xNextReplenishTime;      /*< The tick at which the current period ends and the budget is replenished. */
+        const char * pcServerName;          /*< Descriptive name given to the server when created. */ /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+        uint32_t ulBudgetExhaustedCount;    /*< The number of periods in which the budget ran out. */
+        struct xEDF_SERVER * pxNextServer;  /*< Links all servers. */
+
+        #if ( configUSE_EDF_RECLAIMING == 1 )
+            BaseType_t xReclaimActive;      /*< pdTRUE while the utilisation of the server counts towards the active utilisation. */
+            uint32_t ulBudgetCharge;        /*< Part of a tick, in units of 1 / taskEDF_UTILISATION_SCALE, charged to the budget but not yet deducted from it. */
+            uint32_t ulReclaimedTicks;      /*< Ticks the tasks of the server ran without a tick being deducted from the budget. */
+        #endif
+    } EDFServer_t;
+
+#endif /* configUSE_EDF_SERVERS */
+
+#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+
+/*
+ * Cursor through the task set while it is read by prvEDFReadTask().
+ */
+    typedef struct xEDF_ADMISSION_CONTEXT
+    {
+        const EDFAnalysisTask_t * pxCandidate; /*< The task or server to be admitted, read first, or NULL. */
+        const TCB_t * pxNextTCB;               /*< The next periodic task to read. */
+
+        #if ( configUSE_EDF_SERVERS == 1 )
+            const EDFServer_t * pxNextServer;  /*< The next server to read once every periodic task has been read. */
+        #endif
+    } EDFAdmissionContext_t;
+
+#endif /* configUSE_EDF_ADMISSION_CONTROL */
+
 /*lint -save -e956 A manual analysis and inspection has been used to determine
  * which static variables must be declared volatile. */
 PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
@@ -400,6 +545,165 @@ PRIVILEGED_DATA static UBaseType_t uxTaskNumber = ( UBaseType_t ) 0U;
 PRIVILEGED_DATA static volatile TickType_t xNextTaskUnblockTime = ( TickType_t ) 0U; /* Initialised to portMAX_DELAY before the scheduler starts. */
 PRIVILEGED_DATA static TaskHandle_t xIdleTaskHandle = NULL;                          /*< Holds the handle of the idle task.  The idle task is created automatically when the scheduler is started. */
 
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    PRIVILEGED_DATA static TCB_t * pxPeriodicTaskList = NULL; /*< Head of the list of all periodic tasks, linked through pxNextPeriodicTCB. */
+
+#endif
+
+#if ( configUSE_EDF_LIMITED_PREEMPTION == 1 )
+
+    PRIVILEGED_DATA static volatile BaseType_t xPreemptionDeferred = pdFALSE; /*< Set when a task with an earlier deadline is ready but the running task is non-preemptive. */
+
+#endif
+
+#if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+
+    PRIVILEGED_DATA static TCB_t * pxPreemptionStackTop = NULL;                            /*< The task whose job started most recently and has not yet completed. */
+    PRIVILEGED_DATA static volatile TickType_t xPreemptionCeiling = ( TickType_t ) portMAX_DELAY; /*< Lowest preemption threshold of the tasks on the preemption stack. */
+
+#endif
+
+#if ( configUSE_EDF_SERVERS == 1 )
+
+    PRIVILEGED_DATA static List_t xEDFServerReadyList;   /*< Servers with budget left and a ready task, ordered by deadline. */
+    PRIVILEGED_DATA static EDFServer_t * pxServerList = NULL; /*< Head of the list of all servers, linked through pxNextServer. */
+
+#endif
+
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+
+    PRIVILEGED_DATA static List_t xAperiodicReadyList;                         /*< Ready aperiodic tasks in the order their jobs were released. */
+    PRIVILEGED_DATA static TickType_t xAvailableSlack = ( TickType_t ) 0U;      /*< Lower bound of the time the periodic jobs can be postponed without missing a deadline. */
+    PRIVILEGED_DATA static BaseType_t xSlackOutOfDate = pdTRUE;                 /*< Set when a periodic job is released or completes, so the slack must be recomputed. */
+    PRIVILEGED_DATA static BaseType_t xSlackStealingEnabled = pdTRUE;           /*< When pdFALSE aperiodic jobs only run in the background. */
+    PRIVILEGED_DATA static AperiodicStats_t xAperiodicStats = { 0 };            /*< Response times of the aperiodic jobs that completed. */
+
+#endif
+
+#if ( configUSE_EDF_SHARED_STACK == 1 )
+
+    PRIVILEGED_DATA static StackType_t uxEDFSharedStack[ configEDF_SHARED_STACK_SIZE ]; /*< Stack used by the jobs of all run-to-completion tasks. */
+
+#endif
+
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    /* Utilisation of a task in units of 1 / taskEDF_UTILISATION_SCALE, rounded
+     * up so schedulability tests are never optimistic. */
+    #define taskEDF_UTILISATION_SCALE    ( ( uint32_t ) 10000UL )
+    #define taskEDF_UTILISATION( xWcet, xPeriod )    ( ( uint32_t ) ( ( ( ( uint32_t ) ( xWcet ) * taskEDF_UTILISATION_SCALE ) + ( uint32_t ) ( xPeriod ) - 1UL ) / ( uint32_t ) ( xPeriod ) ) )
+
+    /* Set the absolute deadline of a job of pxTCB released now. */
+    #if ( tskEDF_TRACK_JOBS == 1 )
+        #define taskEDF_RELEASE_JOB( pxTCB )    prvEDFJobReleased( ( pxTCB ), xTickCount )
+    #else
+        #define taskEDF_RELEASE_JOB( pxTCB )    listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ), taskEDF_RELATIVE_DEADLINE( pxTCB ) + xTickCount )
+    #endif
+
+    /* Relative deadline of the jobs of pxTCB, the deadline it was created with
+     * unless a task after it in a precedence chain needs time to run. */
+    #if ( configUSE_EDF_PRECEDENCE == 1 )
+        #define taskEDF_RELATIVE_DEADLINE( pxTCB )    ( ( pxTCB )->xTaskRelativeDeadline )
+    #else
+        #define taskEDF_RELATIVE_DEADLINE( pxTCB )    ( ( pxTCB )->xTaskDeadline )
+    #endif
+
+    /* Relative deadline given by a task definition, which is the period unless
+     * xDeadline is set. */
+    #define taskEDF_DEFINITION_DEADLINE( pxTaskDefinition )    ( ( ( pxTaskDefinition )->xDeadline != ( TickType_t ) 0U ) ? ( pxTaskDefinition )->xDeadline : ( pxTaskDefinition )->xPeriod )
+
+    /* A released job only preempts the running job if its absolute deadline is
+     * earlier and, when preemption thresholds are used, the period of its task
+     * is below the threshold of every job that has started but not completed. */
+    #if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+        #define taskEDF_IS_ABOVE_CEILING( pxTCB )    ( ( pxTCB )->xTaskPeriod < xPreemptionCeiling )
+    #else
+        #define taskEDF_IS_ABOVE_CEILING( pxTCB )    ( pdTRUE )
+    #endif
+
+    #if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+        #define taskEDF_SELECT_EDF_TASK()    prvEDFSelectTaskAboveCeiling()
+    #elif ( configUSE_EDF_SERVERS == 1 )
+        #define taskEDF_SELECT_EDF_TASK()    prvEDFSelectServerOrTask()
+    #else
+        #define taskEDF_SELECT_EDF_TASK()    ( ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( ( &pxReadyTasksLists ) ) )
+    #endif
+
+    /* The earliest deadline job, which is in a server when a server has the
+     * earliest deadline.  Unlike taskEDF_SELECT_EDF_TASK() it starts no job. */
+    #if ( configUSE_EDF_SERVERS == 1 )
+        #define taskEDF_EARLIEST_DEADLINE_TASK()    prvEDFSelectServerOrTask()
+    #else
+        #define taskEDF_EARLIEST_DEADLINE_TASK()    ( ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( ( &pxReadyTasksLists ) ) )
+    #endif
+
+    /* An aperiodic job runs in place of the selected task if there is slack. */
+    #if ( configUSE_EDF_SLACK_STEALING == 1 )
+        #define taskEDF_SELECT_TASK()    prvEDFStealSlack()
+    #else
+        #define taskEDF_SELECT_TASK()    taskEDF_SELECT_EDF_TASK()
+    #endif
+
+    /* Tasks attached to a server are held in the ready list of the server,
+     * and aperiodic tasks in the aperiodic ready list. */
+    #if ( configUSE_EDF_SERVERS == 1 ) || ( configUSE_EDF_SLACK_STEALING == 1 )
+        #define taskEDF_READY_LIST( pxTCB )          prvEDFGetReadyList( pxTCB )
+        #define taskEDF_INSERT_READY_TASK( pxTCB )   prvEDFInsertReadyTask( pxTCB )
+    #else
+        #define taskEDF_READY_LIST( pxTCB )          ( &( pxReadyTasksLists ) )
+        #define taskEDF_INSERT_READY_TASK( pxTCB )   vListInsert( &( pxReadyTasksLists ), &( ( pxTCB )->xStateListItem ) )
+    #endif
+
+    #if ( configUSE_EDF_SERVERS == 1 )
+        #define taskEDF_INVOLVES_SERVER( pxTCB )     ( ( ( pxTCB )->pxServer != NULL ) || ( pxCurrentTCB->pxServer != NULL ) )
+    #else
+        #define taskEDF_INVOLVES_SERVER( pxTCB )     ( pdFALSE )
+    #endif
+
+    #define taskEDF_IS_READY( pxTCB )    listIS_CONTAINED_WITHIN( taskEDF_READY_LIST( pxTCB ), &( ( pxTCB )->xStateListItem ) )
+
+    /* The deadlines of a task and the running task cannot be compared directly
+     * when either is scheduled in a server, so the scheduler decides. */
+    #define taskEDF_CAN_PREEMPT_CURRENT( pxTCB )                                                                                                \
+    ( ( ( listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ) ) < listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ) ) ) ||   \
+        ( taskEDF_INVOLVES_SERVER( pxTCB ) ) ) &&                                                                                           \
+      ( taskEDF_IS_ABOVE_CEILING( pxTCB ) ) )
+
+#endif /* configUSE_EDF_SCHEDULER */
+
+#if ( configUSE_EDF_MIXED_CRITICALITY == 1 )
+
+    PRIVILEGED_DATA static volatile eTaskCriticality eCriticalityMode = eCriticalityLow; /*< The criticality mode the system runs in. */
+    PRIVILEGED_DATA static uint32_t ulVirtualDeadlineScale = taskEDF_UTILISATION_SCALE;  /*< Relative deadlines of HI criticality tasks are scaled by ulVirtualDeadlineScale / taskEDF_UTILISATION_SCALE in LO mode. */
+
+#endif
+
+#if ( configUSE_EDF_RECLAIMING == 1 )
+
+    /* Reclaiming state of a periodic task.  A task is active from the time a
+     * job is released until the 0-lag time of the job after it completed. */
+    #define taskEDF_RECLAIM_INACTIVE        ( ( UBaseType_t ) 0U )
+    #define taskEDF_RECLAIM_ACTIVE          ( ( UBaseType_t ) 1U )
+    #define taskEDF_RECLAIM_DEACTIVATING    ( ( UBaseType_t ) 2U )
+
+    PRIVILEGED_DATA static uint32_t ulActiveUtilisation = 0UL;                /*< Summed utilisation of the active periodic tasks and servers, in units of 1 / taskEDF_UTILISATION_SCALE. */
+    PRIVILEGED_DATA static UBaseType_t uxReclaimPending = ( UBaseType_t ) 0U; /*< Number of tasks in the taskEDF_RECLAIM_DEACTIVATING state. */
+
+#endif
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_TRACE_FACILITY == 1 ) )
+
+    PRIVILEGED_DATA static volatile uint32_t ulContextSwitchCount = 0UL; /*< Number of switches between two different tasks. */
+
+#endif
+
+#if ( configUSE_EDF_JOB_STATISTICS == 1 )
+
+    PRIVILEGED_DATA static volatile configRUN_TIME_COUNTER_TYPE ulTickRunTime = 0UL; /*< Run time counter value when the tick count was last incremented. */
+
+#endif
+
 /* Improve support for OpenOCD. The kernel tracks Ready tasks via priority lists.
  * For tracking the state of remote threads, OpenOCD uses uxTopUsedPriority
  * to determine the number of priority lists to read back from the remote target. */
@@ -579,6 +883,304 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
  */
 static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
 
+/*
+ * Returns pdPASS if a periodic task with the timing parameters held in
+ * pxTaskDefinition can join the set of periodic tasks without any task
+ * missing its deadline under EDF, otherwise pdFAIL.
+ */
+#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+
+    static BaseType_t prvEDFAdmitTask( const PeriodicTaskParameters_t * const pxTaskDefinition ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Checks the parameters of a new periodic task.  Returns pdFAIL if the task
+ * was rejected by admission control, otherwise pdPASS.
+ */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static BaseType_t prvEDFCheckNewTask( const PeriodicTaskParameters_t * const pxTaskDefinition ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Initialises the EDF members of pxNewTCB, whose stack has already been
+ * obtained, from pxTaskDefinition and then the task itself.
+ */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static void prvEDFInitialiseNewTask( const PeriodicTaskParameters_t * const pxTaskDefinition,
+                                         TaskHandle_t * const pxCreatedTask,
+                                         TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Selects the ready task with the earliest deadline that is allowed to run
+ * given the preemption thresholds of the jobs that have started but not yet
+ * completed, and pushes it onto the preemption stack if its job is starting.
+ */
+#if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+
+    static TCB_t * prvEDFSelectTaskAboveCeiling( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Records that the job of pxTCB has started executing by pushing the task
+ * onto the preemption stack.  The stack frame of a run-to-completion job is
+ * built on the shared stack at this point.
+ */
+#if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+
+    static void prvEDFPushPreemptionStack( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * prvEDFJobReleased() starts a new job of pxTCB released at xReleaseTime,
+ * setting its deadline and clearing the execution time of the job.
+ * prvEDFGetCurrentJobRunTime() returns the run time counter value consumed by
+ * the job of the running task so far.  prvEDFGetRemainingJobTime() returns the
+ * WCET of the job of pxTCB less the whole ticks it executed, or 0 if pxTCB is
+ * not ready.
+ */
+#if ( tskEDF_TRACK_JOBS == 1 )
+
+    static void prvEDFJobReleased( TCB_t * pxTCB,
+                                   TickType_t xReleaseTime ) PRIVILEGED_FUNCTION;
+
+    static configRUN_TIME_COUNTER_TYPE prvEDFGetCurrentJobRunTime( void ) PRIVILEGED_FUNCTION;
+
+    #if ( configUSE_EDF_SLACK_STEALING == 1 ) || ( configUSE_EDF_FIRM_DEADLINES == 1 )
+        static int32_t prvEDFGetRemainingJobTime( const TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+    #endif
+
+#endif
+
+/*
+ * Functions implementing EDF with virtual deadlines.  The deadline a job is
+ * given when released depends on the current criticality mode.
+ * prvEDFSetCriticalityMode() switches mode and recomputes the deadlines of all
+ * ready jobs.
+ * prvEDFCheckBudgetOverrun() switches to HI mode if the running HI criticality
+ * job has exceeded its LO mode WCET.  prvEDFVirtualDeadlineScale() implements
+ * the EDF-VD schedulability test on the given utilisations.
+ */
+#if ( configUSE_EDF_MIXED_CRITICALITY == 1 )
+
+    static void prvEDFSetCriticalityMode( eTaskCriticality eNewMode ) PRIVILEGED_FUNCTION;
+
+    static BaseType_t prvEDFCheckBudgetOverrun( void ) PRIVILEGED_FUNCTION;
+
+    static void prvEDFUpdateVirtualDeadlineScale( void ) PRIVILEGED_FUNCTION;
+
+    static BaseType_t prvEDFVirtualDeadlineScale( uint32_t ulLowUtilisation,
+                                                  uint32_t ulHighUtilisationLow,
+                                                  uint32_t ulHighUtilisationHigh,
+                                                  uint32_t * pulScale );
+
+#endif
+
+/*
+ * prvEDFInsertReadyTask() places pxTCB in the ready list returned by
+ * prvEDFGetReadyList() - the ready list of its server, the aperiodic ready list,
+ * or the top level ready list.
+ */
+#if ( configUSE_EDF_SERVERS == 1 ) || ( configUSE_EDF_SLACK_STEALING == 1 )
+
+    static List_t * prvEDFGetReadyList( const TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+    static void prvEDFInsertReadyTask( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Functions implementing hierarchical scheduling with servers, which are
+ * constant bandwidth servers (CBS).  prvEDFSelectServerOrTask() selects the
+ * earliest deadline ready task or server, and then the task the selected
+ * server runs.  prvEDFServerTick() charges the tick to the running server and
+ * replenishes servers whose deadline was reached, returning pdTRUE if a
+ * context switch is required.  prvEDFServerZeroLagReached() returns pdTRUE if
+ * the remaining budget of pxServer can no longer be consumed at the reserved
+ * rate by its deadline.
+ */
+#if ( configUSE_EDF_SERVERS == 1 )
+
+    static TCB_t * prvEDFSelectServerOrTask( void ) PRIVILEGED_FUNCTION;
+
+    static BaseType_t prvEDFServerTick( TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+    static BaseType_t prvEDFServerZeroLagReached( const EDFServer_t * const pxServer,
+                                                  TickType_t xTime ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Functions implementing GRUB bandwidth reclaiming.  A periodic task that is
+ * not attached to a server is activated by prvEDFReclaimTaskActivate() when it
+ * becomes ready, and deactivated by prvEDFReclaimTaskDeactivate().
+ * prvEDFReclaimJobCompleted() schedules the deactivation of the running task
+ * at the 0-lag time of its job, and prvEDFReclaimTick() performs deactivations
+ * that became due.
+ */
+#if ( configUSE_EDF_RECLAIMING == 1 )
+
+    static void prvEDFReclaimTaskActivate( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+    static void prvEDFReclaimTaskDeactivate( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+    static void prvEDFReclaimJobCompleted( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+    static void prvEDFReclaimTick( TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Functions implementing slack stealing.  prvEDFComputeSlack() returns a lower
+ * bound of the time the periodic jobs can be postponed without any of them
+ * missing its deadline, using prvEDFSlackDemand() to obtain the execution time
+ * of the jobs that must complete within lInterval ticks and
+ * prvEDFSlackNextRelease() to obtain the earliest release of the next job of
+ * pxTCB.  Deadlines may be shorter than periods.  prvEDFStealSlack()
+ * runs the oldest aperiodic job if there is slack or no periodic job is ready,
+ * and otherwise selects a task by EDF.  prvEDFSlackTick() consumes slack and
+ * returns pdTRUE if an aperiodic job must give way to the periodic jobs.
+ * prvEDFAperiodicJobCompleted() records the response time of the job of pxTCB.
+ */
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+
+    static int32_t prvEDFSlackNextRelease( const TCB_t * const pxTCB,
+                                           TickType_t xNow ) PRIVILEGED_FUNCTION;
+
+    static int32_t prvEDFSlackDemand( int32_t lInterval,
+                                      TickType_t xNow ) PRIVILEGED_FUNCTION;
+
+    static TickType_t prvEDFComputeSlack( void ) PRIVILEGED_FUNCTION;
+
+    static TCB_t * prvEDFStealSlack( void ) PRIVILEGED_FUNCTION;
+
+    static BaseType_t prvEDFSlackTick( void ) PRIVILEGED_FUNCTION;
+
+    static void prvEDFAperiodicJobCompleted( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Functions implementing (m,k)-firm deadlines.  prvEDFFirmRecordJob() shifts
+ * the outcome of a job of pxTCB into its history.  prvEDFFirmJobIsMandatory()
+ * returns pdTRUE if losing the next job of pxTCB would violate its constraint.
+ * prvEDFFirmOverload() returns pdTRUE if adding the job of pxReleasedTCB to the
+ * ready jobs would make any of them miss its deadline.  prvEDFFirmSkipJob()
+ * skips the job of pxTCB released by the tick interrupt if it is optional and
+ * the system is overloaded, returning pdTRUE if the job was skipped.
+ */
+#if ( configUSE_EDF_FIRM_DEADLINES == 1 )
+
+    static UBaseType_t prvEDFFirmCountMet( uint32_t ulHistory,
+                                           UBaseType_t uxJobs ) PRIVILEGED_FUNCTION;
+
+    static BaseType_t prvEDFFirmJobIsMandatory( const TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+    static void prvEDFFirmRecordJob( TCB_t * pxTCB,
+                                     BaseType_t xDeadlineMet,
+                                     BaseType_t xSkipped ) PRIVILEGED_FUNCTION;
+
+    static BaseType_t prvEDFFirmOverload( const TCB_t * const pxReleasedTCB,
+                                          TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+    static BaseType_t prvEDFFirmSkipJob( TCB_t * pxTCB,
+                                         TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Functions implementing precedence constraints.
+ * prvEDFUpdatePrecedenceDeadlines() recomputes the relative deadline of every
+ * periodic task from the precedence edges.  prvEDFPrecedenceRelease() gives a
+ * job of pxTCB, unblocked by the task pxSender, the release time of the job of
+ * pxSender and the end-to-end deadline if pxSender is its predecessor.
+ */
+#if ( configUSE_EDF_PRECEDENCE == 1 )
+
+    static void prvEDFUpdatePrecedenceDeadlines( void ) PRIVILEGED_FUNCTION;
+
+    static void prvEDFPrecedenceRelease( TCB_t * pxTCB,
+                                         const TCB_t * const pxSender ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Gives the job of pxTCB released as it is unblocked the deadline set by
+ * vTaskSetWakeDeadline(), or its release time plus its period if that is
+ * earlier.
+ */
+#if ( configUSE_EDF_TIMERS == 1 )
+
+    static void prvEDFApplyWakeDeadline( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Starts the job of pxTCB released as an interrupt readies it, at the tick of
+ * the interrupt and with the deadline passed to xTaskDeferFromISR().
+ */
+#if ( configUSE_EDF_DEFERRED_INTERRUPTS == 1 )
+
+    static void prvEDFApplyDeferredDeadline( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Records the response time and lateness of the job of pxTCB released at
+ * xReleaseTime that completes now, with the tick count at xConstTickCount.
+ */
+#if ( configUSE_EDF_JOB_STATISTICS == 1 )
+
+    static void prvEDFRecordJobStatistics( TCB_t * pxTCB,
+                                           TickType_t xReleaseTime,
+                                           TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Reads the task with index uxIndex for the analysis of edf_analysis.c, see
+ * EDFAnalysisReadTask_t.  pvContext points to an EDFAdmissionContext_t.  The
+ * candidate comes first, followed by the periodic tasks and the servers.  A
+ * task attached to a server is accounted for by the budget of its server, so
+ * only the blocking it causes is read.
+ */
+#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+
+    static int32_t prvEDFReadTask( void * pvContext,
+                                   size_t uxIndex,
+                                   EDFAnalysisTask_t * pxTask ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Returns pdPASS if the periodic tasks and servers, plus pxCandidate unless
+ * NULL, are feasible under EDF, otherwise pdFAIL.  A task set the analysis
+ * cannot decide within configEDF_ANALYSIS_MAX_STEPS steps is rejected.  Must
+ * be called with the scheduler suspended.
+ */
+#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+
+    static BaseType_t prvEDFTaskSetFeasible( const EDFAnalysisTask_t * const pxCandidate ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Entry point of every run-to-completion task.  Executes one job each time the
+ * task is released.
+ */
+#if ( configUSE_EDF_SHARED_STACK == 1 )
+
+    static portTASK_FUNCTION_PROTO( prvEDFRunToCompletionTask, pvParameters ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * freertos_tasks_c_additions_init() should only be called if the user definable
  * macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is the only macro
@@ -592,7 +1194,9 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
 
 /*-----------------------------------------------------------*/
 
-#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+/* Periodic tasks are created statically with xTaskPeriodicCreateStatic(), as
+ * their TCB holds more than a StaticTask_t. */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 0 )
 
     TaskHandle_t xTaskCreateStatic( TaskFunction_t pxTaskCode,
                                     const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
@@ -648,7 +1252,218 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
 #endif /* SUPPORT_STATIC_ALLOCATION */
 /*-----------------------------------------------------------*/
 
-#if ( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static BaseType_t prvEDFCheckNewTask( const PeriodicTaskParameters_t * const pxTaskDefinition )
+    {
+        BaseType_t xReturn = pdPASS;
+
+        configASSERT( pxTaskDefinition->xPeriod > ( TickType_t ) 0U );
+        configASSERT( pxTaskDefinition->xDeadline <= pxTaskDefinition->xPeriod );
+
+        #if ( configUSE_EDF_SHARED_STACK == 1 )
+            /* Initialising a task overwrites the whole of the stack it uses, so
+             * run-to-completion tasks must exist before any job executes on the
+             * shared stack. */
+            configASSERT( ( pxTaskDefinition->xRunToCompletion == pdFALSE ) || ( xSchedulerRunning == pdFALSE ) );
+        #endif
+
+        #if ( configUSE_EDF_FIRM_DEADLINES == 1 )
+            /* The history of each task holds 32 jobs. */
+            configASSERT( pxTaskDefinition->uxFirmWindow <= ( UBaseType_t ) 32U );
+            configASSERT( pxTaskDefinition->uxFirmMandatory <= pxTaskDefinition->uxFirmWindow );
+        #endif
+
+        #if ( configUSE_EDF_SLACK_STEALING == 1 )
+            /* Aperiodic jobs only run in slack, so reserve no bandwidth. */
+            configASSERT( ( pxTaskDefinition->xAperiodic == pdFALSE ) || ( pxTaskDefinition->xWcet == ( TickType_t ) 0U ) );
+        #endif
+
+        #if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+            /* A task cannot allow preemption by tasks of its own or a lower
+             * preemption level. */
+            configASSERT( pxTaskDefinition->xPreemptionThreshold <= pxTaskDefinition->xPeriod );
+        #endif
+
+        #if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+            {
+                xReturn = prvEDFAdmitTask( pxTaskDefinition );
+            }
+        #endif /* configUSE_EDF_ADMISSION_CONTROL */
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEDFInitialiseNewTask( const PeriodicTaskParameters_t * const pxTaskDefinition,
+                                         TaskHandle_t * const pxCreatedTask,
+                                         TCB_t * pxNewTCB )
+    {
+        /*E.C. : initialize the period */
+        pxNewTCB->xTaskPeriod = pxTaskDefinition->xPeriod;
+        pxNewTCB->xTaskDeadline = taskEDF_DEFINITION_DEADLINE( pxTaskDefinition );
+        pxNewTCB->xTaskWcet = pxTaskDefinition->xWcet;
+
+        #if ( configUSE_EDF_SLACK_STEALING == 1 )
+            pxNewTCB->xAperiodic = pxTaskDefinition->xAperiodic;
+            pxNewTCB->xAperiodicJobPending = pdFALSE;
+        #endif
+
+        #if ( configUSE_EDF_FIRM_DEADLINES == 1 )
+            /* The task starts as if every earlier job met its deadline. */
+            pxNewTCB->uxFirmMandatory = pxTaskDefinition->uxFirmMandatory;
+            pxNewTCB->uxFirmWindow = pxTaskDefinition->uxFirmWindow;
+            pxNewTCB->ulFirmHistory = 0xFFFFFFFFUL;
+            pxNewTCB->ulFirmSkipHistory = 0UL;
+            pxNewTCB->ulFirmMetJobs = 0UL;
+            pxNewTCB->ulFirmMissedJobs = 0UL;
+            pxNewTCB->ulFirmSkippedJobs = 0UL;
+            pxNewTCB->ulFirmViolations = 0UL;
+            pxNewTCB->pxFirmWakeTime = NULL;
+        #endif
+
+        #if ( configUSE_EDF_MIXED_CRITICALITY == 1 )
+            pxNewTCB->eCriticality = pxTaskDefinition->eCriticality;
+            pxNewTCB->xTaskWcetHigh = ( pxTaskDefinition->xWcetHigh > pxTaskDefinition->xWcet ) ? pxTaskDefinition->xWcetHigh : pxTaskDefinition->xWcet;
+        #endif
+
+        #if ( configUSE_EDF_PRECEDENCE == 1 )
+            /* Edges are only added once the task exists. */
+            pxNewTCB->pxPrecedenceSuccessor = NULL;
+            pxNewTCB->xPrecedenceWindow = ( TickType_t ) 0U;
+            pxNewTCB->xPrecedenceLimit = portMAX_DELAY;
+            pxNewTCB->xTaskRelativeDeadline = pxNewTCB->xTaskDeadline;
+        #endif
+
+        #if ( configUSE_EDF_TIMERS == 1 )
+            pxNewTCB->xTaskWakeDeadline = portMAX_DELAY;
+        #endif
+
+        #if ( configUSE_EDF_JOB_STATISTICS == 1 )
+            vHistogramReset( &( pxNewTCB->xJobResponseTimes ) );
+            vHistogramReset( &( pxNewTCB->xJobTardiness ) );
+            pxNewTCB->lJobMinLateness = 0L;
+            pxNewTCB->lJobMaxLateness = 0L;
+            pxNewTCB->llJobTotalLateness = 0LL;
+        #endif
+
+        #if ( configUSE_EDF_SNAPSHOT == 1 )
+            pxNewTCB->ulMissedDeadlines = 0UL;
+        #endif
+
+        taskEDF_RELEASE_JOB( pxNewTCB );
+
+        #if ( configUSE_EDF_LIMITED_PREEMPTION == 1 )
+            pxNewTCB->xTaskMaxNonPreemptive = pxTaskDefinition->xMaxNonPreemptive;
+
+            /* A task using preemption points is never preemptable between two
+             * points, so it starts inside a region that is only left at
+             * vTaskPreemptionPoint(). */
+            pxNewTCB->uxNonPreemptiveNesting = ( pxTaskDefinition->xUsePreemptionPoints != pdFALSE ) ? ( UBaseType_t ) 1U : ( UBaseType_t ) 0U;
+        #endif
+
+        #if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+            /* By default a task can be preempted by any task with a shorter
+             * relative deadline, which is plain EDF. */
+            pxNewTCB->xTaskPreemptionThreshold = ( pxTaskDefinition->xPreemptionThreshold != ( TickType_t ) 0U ) ? pxTaskDefinition->xPreemptionThreshold : pxTaskDefinition->xPeriod;
+            pxNewTCB->pxPreemptedTCB = NULL;
+            pxNewTCB->xOnPreemptionStack = pdFALSE;
+        #endif
+
+        #if ( configUSE_EDF_SHARED_STACK == 1 )
+            if( pxTaskDefinition->xRunToCompletion != pdFALSE )
+            {
+                /* The kernel calls the task code once per job from
+                 * prvEDFRunToCompletionTask(). */
+                pxNewTCB->pxJobCode = pxTaskDefinition->pvTaskCode;
+                pxNewTCB->pvJobParameters = pxTaskDefinition->pvParameters;
+                pxNewTCB->xLastReleaseTime = xTickCount;
+
+                prvInitialiseNewTask( prvEDFRunToCompletionTask, pxTaskDefinition->pcName, ( uint32_t ) configEDF_SHARED_STACK_SIZE, NULL, pxTaskDefinition->uxPriority, pxCreatedTask, pxNewTCB, NULL );
+            }
+            else
+            {
+                pxNewTCB->pxJobCode = NULL;
+                prvInitialiseNewTask( pxTaskDefinition->pvTaskCode, pxTaskDefinition->pcName, ( uint32_t ) pxTaskDefinition->usStackDepth, pxTaskDefinition->pvParameters, pxTaskDefinition->uxPriority, pxCreatedTask, pxNewTCB, NULL );
+            }
+        #else
+            prvInitialiseNewTask( pxTaskDefinition->pvTaskCode, pxTaskDefinition->pcName, ( uint32_t ) pxTaskDefinition->usStackDepth, pxTaskDefinition->pvParameters, pxTaskDefinition->uxPriority, pxCreatedTask, pxNewTCB, NULL );
+        #endif
+    }
+
+#endif /* configUSE_EDF_SCHEDULER */
+/*-----------------------------------------------------------*/
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 )
+
+    BaseType_t xTaskPeriodicCreateStatic( const PeriodicTaskParameters_t * const pxTaskDefinition,
+                                          StackType_t * const puxStackBuffer,
+                                          StaticPeriodicTask_t * const pxTaskBuffer,
+                                          TaskHandle_t * const pxCreatedTask )
+    {
+        TCB_t * pxNewTCB;
+        StackType_t * pxStack = puxStackBuffer;
+        BaseType_t xReturn;
+
+        #if ( configUSE_EDF_SHARED_STACK == 1 )
+            if( pxTaskDefinition->xRunToCompletion != pdFALSE )
+            {
+                /* The jobs of the task execute on the shared stack, so no
+                 * stack buffer is needed. */
+                pxStack = uxEDFSharedStack;
+            }
+        #endif
+
+        configASSERT( pxStack != NULL );
+        configASSERT( pxTaskBuffer != NULL );
+
+        #if ( configASSERT_DEFINED == 1 )
+            {
+                /* Sanity check that the structure used to declare a variable of
+                 * type StaticPeriodicTask_t is large enough to hold the real task
+                 * structure, EDF members included. */
+                volatile size_t xSize = sizeof( StaticPeriodicTask_t );
+                configASSERT( xSize >= sizeof( TCB_t ) );
+                ( void ) xSize; /* Prevent lint warning when configASSERT() is not used. */
+            }
+        #endif /* configASSERT_DEFINED */
+
+        if( ( pxTaskBuffer == NULL ) || ( pxStack == NULL ) )
+        {
+            xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+        }
+        else if( prvEDFCheckNewTask( pxTaskDefinition ) == pdFAIL )
+        {
+            xReturn = errTASK_SET_NOT_SCHEDULABLE;
+        }
+        else
+        {
+            /* The memory used for the task's TCB and stack are passed into
+             * this function - use them. */
+            pxNewTCB = ( TCB_t * ) pxTaskBuffer; /*lint !e740 !e9087 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+            pxNewTCB->pxStack = pxStack;
+
+            #if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
+                {
+                    /* Tasks can be created statically or dynamically, so note
+                     * this task was created statically in case the task is later
+                     * deleted.  The shared stack is never freed either. */
+                    pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_AND_TCB;
+                }
+            #endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
+
+            prvEDFInitialiseNewTask( pxTaskDefinition, pxCreatedTask, pxNewTCB );
+            prvAddNewTaskToReadyList( pxNewTCB );
+            xReturn = pdPASS;
+        }
+
+        return xReturn;
+    }
+
+#endif /* configSUPPORT_STATIC_ALLOCATION && configUSE_EDF_SCHEDULER */
+/*-----------------------------------------------------------*/
+
+#if ( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
 
     BaseType_t xTaskCreateRestrictedStatic( const TaskParameters_t * const pxTaskDefinition,
                                             TaskHandle_t * pxCreatedTask )
@@ -755,19 +1570,47 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
                             UBaseType_t uxPriority,
                             TaskHandle_t * const pxCreatedTask )
 	#else 
-		BaseType_t xTaskPeriodicCreate( TaskFunction_t pxTaskCode,
-                            const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-                            const configSTACK_DEPTH_TYPE usStackDepth,
-                            void * const pvParameters,
-                            UBaseType_t uxPriority,
-                            TaskHandle_t * const pxCreatedTask, 
-														TickType_t period)
+		BaseType_t xTaskPeriodicCreateFromParameters( const PeriodicTaskParameters_t * const pxTaskDefinition,
+                                                      TaskHandle_t * const pxCreatedTask )
 	#endif
 														
     {
         TCB_t * pxNewTCB;
         BaseType_t xReturn;
 
+        #if ( configUSE_EDF_SHARED_STACK == 1 )
+            const BaseType_t xRunToCompletion = pxTaskDefinition->xRunToCompletion;
+            const configSTACK_DEPTH_TYPE usStackDepth = ( xRunToCompletion != pdFALSE ) ? ( configSTACK_DEPTH_TYPE ) configEDF_SHARED_STACK_SIZE : pxTaskDefinition->usStackDepth;
+        #elif ( configUSE_EDF_SCHEDULER == 1 )
+            const configSTACK_DEPTH_TYPE usStackDepth = pxTaskDefinition->usStackDepth;
+        #endif
+
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            {
+                /* Reject the task before any memory is allocated for it if the
+                 * task set would no longer be schedulable with it. */
+                if( prvEDFCheckNewTask( pxTaskDefinition ) == pdFAIL )
+                {
+                    return errTASK_SET_NOT_SCHEDULABLE;
+                }
+            }
+        #endif /* configUSE_EDF_SCHEDULER */
+
+        #if ( configUSE_EDF_SHARED_STACK == 1 )
+            if( xRunToCompletion != pdFALSE )
+            {
+                /* The jobs of the task execute on the shared stack, so only the
+                 * TCB is allocated. */
+                pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+
+                if( pxNewTCB != NULL )
+                {
+                    pxNewTCB->pxStack = uxEDFSharedStack;
+                }
+            }
+            else
+        #endif /* configUSE_EDF_SHARED_STACK */
+
         /* If the stack grows down then allocate the stack then the TCB so the stack
          * does not grow into the TCB.  Likewise if the stack grows up then allocate
          * the TCB then the stack. */
@@ -831,18 +1674,23 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
                     /* Tasks can be created statically or dynamically, so note this
                      * task was created dynamically in case it is later deleted. */
                     pxNewTCB->ucStaticallyAllocated = tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB;
+
+                    #if ( configUSE_EDF_SHARED_STACK == 1 )
+                        if( xRunToCompletion != pdFALSE )
+                        {
+                            /* The shared stack must not be freed with the task. */
+                            pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_ONLY;
+                        }
+                    #endif
                 }
             #endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
 					
-						/* Configuration for EDF scheduler */
-						#if (configUSE_EDF_SCHEDULER == 1)
-							
-							/*E.C. : initialize the period */
-							pxNewTCB->xTaskPeriod = period;
-							listSET_LIST_ITEM_VALUE( &( ( pxNewTCB )->xStateListItem ), ( pxNewTCB)->xTaskPeriod + xTickCount);
-							
-						#endif
-						prvInitialiseNewTask( pxTaskCode, pcName, ( uint32_t ) usStackDepth, pvParameters, uxPriority, pxCreatedTask, pxNewTCB, NULL);
+            #if ( configUSE_EDF_SCHEDULER == 1 )
+                prvEDFInitialiseNewTask( pxTaskDefinition, pxCreatedTask, pxNewTCB );
+            #else
+                prvInitialiseNewTask( pxTaskCode, pcName, ( uint32_t ) usStackDepth, pvParameters, uxPriority, pxCreatedTask, pxNewTCB, NULL );
+            #endif
+
             prvAddNewTaskToReadyList( pxNewTCB );
             xReturn = pdPASS;
         }
@@ -854,6 +1702,60 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
         return xReturn;
     }
 
+	#if ( configUSE_EDF_SCHEDULER == 1 )
+
+		BaseType_t xTaskPeriodicCreate( TaskFunction_t pxTaskCode,
+                                        const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                        const configSTACK_DEPTH_TYPE usStackDepth,
+                                        void * const pvParameters,
+                                        UBaseType_t uxPriority,
+                                        TaskHandle_t * const pxCreatedTask,
+                                        TickType_t period )
+		{
+			PeriodicTaskParameters_t xTaskDefinition;
+
+			/* The execution time of the task is not known, so it is created
+			 * without being accounted for by admission control. */
+			( void ) memset( ( void * ) &xTaskDefinition, 0x00, sizeof( xTaskDefinition ) );
+			xTaskDefinition.pvTaskCode = pxTaskCode;
+			xTaskDefinition.pcName = pcName;
+			xTaskDefinition.usStackDepth = usStackDepth;
+			xTaskDefinition.pvParameters = pvParameters;
+			xTaskDefinition.uxPriority = uxPriority;
+			xTaskDefinition.xPeriod = period;
+
+			return xTaskPeriodicCreateFromParameters( &xTaskDefinition, pxCreatedTask );
+		}
+
+		#if ( configUSE_EDF_SLACK_STEALING == 1 )
+
+			BaseType_t xTaskAperiodicCreate( TaskFunction_t pxTaskCode,
+			                                 const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+			                                 const configSTACK_DEPTH_TYPE usStackDepth,
+			                                 void * const pvParameters,
+			                                 UBaseType_t uxPriority,
+			                                 TaskHandle_t * const pxCreatedTask )
+			{
+				PeriodicTaskParameters_t xTaskDefinition;
+
+				/* Aperiodic jobs only run in slack, so the task has no period
+				 * and reserves no bandwidth. */
+				( void ) memset( ( void * ) &xTaskDefinition, 0x00, sizeof( xTaskDefinition ) );
+				xTaskDefinition.pvTaskCode = pxTaskCode;
+				xTaskDefinition.pcName = pcName;
+				xTaskDefinition.usStackDepth = usStackDepth;
+				xTaskDefinition.pvParameters = pvParameters;
+				xTaskDefinition.uxPriority = uxPriority;
+				xTaskDefinition.xPeriod = portMAX_DELAY;
+				xTaskDefinition.xAperiodic = pdTRUE;
+
+				return xTaskPeriodicCreateFromParameters( &xTaskDefinition, pxCreatedTask );
+			}
+
+		#endif /* configUSE_EDF_SLACK_STEALING */
+
+	#endif /* configUSE_EDF_SCHEDULER */
+
 #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 /*-----------------------------------------------------------*/
 
@@ -979,6 +1881,35 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
         }
     #endif /* configUSE_MUTEXES */
 
+    #if ( configUSE_EDF_SERVERS == 1 )
+        {
+            pxNewTCB->pxServer = NULL;
+        }
+    #endif /* configUSE_EDF_SERVERS */
+
+    #if ( configUSE_EDF_RECLAIMING == 1 )
+        {
+            pxNewTCB->uxReclaimState = taskEDF_RECLAIM_INACTIVE;
+            pxNewTCB->xReclaimInactiveTime = ( TickType_t ) 0U;
+        }
+    #endif /* configUSE_EDF_RECLAIMING */
+
+    #if ( configUSE_EDF_PRECEDENCE == 1 )
+        {
+            /* Tasks that are not periodic can still ready the first task of
+             * a chain, so they need an empty edge too. */
+            pxNewTCB->pxPrecedenceSuccessor = NULL;
+            pxNewTCB->pxPrecedenceSender = NULL;
+        }
+    #endif /* configUSE_EDF_PRECEDENCE */
+
+    #if ( configUSE_EDF_DEFERRED_INTERRUPTS == 1 )
+        {
+            pxNewTCB->xTaskDeferredDeadline = portMAX_DELAY;
+            pxNewTCB->xTaskDeferredRelease = ( TickType_t ) 0U;
+        }
+    #endif /* configUSE_EDF_DEFERRED_INTERRUPTS */
+
     vListInitialiseItem( &( pxNewTCB->xStateListItem ) );
     vListInitialiseItem( &( pxNewTCB->xEventListItem ) );
 
@@ -1146,7 +2077,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
             if( xSchedulerRunning == pdFALSE )
             {
 							#if (configUSE_EDF_SCHEDULER == 1)
-								if( pxCurrentTCB->xTaskPeriod < pxNewTCB->xTaskPeriod )
+								if( listGET_LIST_ITEM_VALUE( &( pxNewTCB->xStateListItem ) ) < listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ) ) )
                 {
                     pxCurrentTCB = pxNewTCB;
                 }
@@ -1182,7 +2113,15 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
         traceTASK_CREATE( pxNewTCB );
 				
 				#if (configUSE_EDF_SCHEDULER == 1)
-						listSET_LIST_ITEM_VALUE( &( ( pxNewTCB )->xStateListItem ), ( pxNewTCB)->xTaskPeriod + xTickCount);
+						taskEDF_RELEASE_JOB( pxNewTCB );
+
+						/* Make the task visible to admission control. */
+						pxNewTCB->pxNextPeriodicTCB = pxPeriodicTaskList;
+						pxPeriodicTaskList = pxNewTCB;
+
+						#if ( configUSE_EDF_MIXED_CRITICALITY == 1 )
+							prvEDFUpdateVirtualDeadlineScale();
+						#endif
 				#endif
 						
         prvAddTaskToReadyList( pxNewTCB );
@@ -1194,7 +2133,9 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
     if( xSchedulerRunning != pdFALSE )
     {
 			#if (configUSE_EDF_SCHEDULER == 1)
-				if( pxCurrentTCB->xTaskPeriod < pxNewTCB->xTaskPeriod )
+				/* The new task's first job is released now, so it preempts under
+				 * the same conditions as a job released by the tick. */
+				if( taskEDF_CAN_PREEMPT_CURRENT( pxNewTCB ) )
         {
             taskYIELD_IF_USING_PREEMPTION();
         }
@@ -1254,6 +2195,44 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 mtCOVERAGE_TEST_MARKER();
             }
 
+            #if ( configUSE_EDF_SCHEDULER == 1 )
+                {
+                    TCB_t ** ppxLink;
+
+                    /* The task no longer contributes to the periodic task set. */
+                    #if ( configUSE_EDF_RECLAIMING == 1 )
+                        prvEDFReclaimTaskDeactivate( pxTCB );
+                    #endif
+
+                    for( ppxLink = &pxPeriodicTaskList; *ppxLink != NULL; ppxLink = &( ( *ppxLink )->pxNextPeriodicTCB ) )
+                    {
+                        if( *ppxLink == pxTCB )
+                        {
+                            *ppxLink = pxTCB->pxNextPeriodicTCB;
+                            break;
+                        }
+                    }
+
+                    #if ( configUSE_EDF_PRECEDENCE == 1 )
+                        {
+                            TCB_t * pxPredecessor;
+
+                            /* The predecessors of the task no longer have to
+                             * leave time for it. */
+                            for( pxPredecessor = pxPeriodicTaskList; pxPredecessor != NULL; pxPredecessor = pxPredecessor->pxNextPeriodicTCB )
+                            {
+                                if( pxPredecessor->pxPrecedenceSuccessor == pxTCB )
+                                {
+                                    pxPredecessor->pxPrecedenceSuccessor = NULL;
+                                }
+                            }
+
+                            prvEDFUpdatePrecedenceDeadlines();
+                        }
+                    #endif
+                }
+            #endif /* configUSE_EDF_SCHEDULER */
+
             /* Increment the uxTaskNumber also so kernel aware debuggers can
              * detect that the task lists need re-generating.  This is done before
              * portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
@@ -1376,9 +2355,46 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 }
             }
 
+            #if ( configUSE_EDF_JOB_STATISTICS == 1 )
+                {
+                    /* The job that ends here was released at the previous
+                     * wake time. */
+                    prvEDFRecordJobStatistics( pxCurrentTCB, *pxPreviousWakeTime, xConstTickCount );
+                }
+            #endif
+
+            #if ( configUSE_EDF_SNAPSHOT == 1 )
+                {
+                    const TickType_t xDeadline = listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ) );
+
+                    /* A job completing in the tick of its deadline met it.
+                     * Jobs without a deadline have portMAX_DELAY. */
+                    if( ( xDeadline != portMAX_DELAY ) && ( ( BaseType_t ) ( xConstTickCount - xDeadline ) > ( BaseType_t ) 0 ) )
+                    {
+                        pxCurrentTCB->ulMissedDeadlines++;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif
+
             /* Update the wake time ready for the next call. */
             *pxPreviousWakeTime = xTimeToWake;
 
+            #if ( configUSE_EDF_FIRM_DEADLINES == 1 )
+                {
+                    const TickType_t xDeadline = listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ) );
+
+                    /* The job that ends here met its deadline if it completes
+                     * by it, which a precedence chain can make earlier than
+                     * the release time of the next job.  A job completing in
+                     * the tick of its deadline met it. */
+                    prvEDFFirmRecordJob( pxCurrentTCB, ( ( BaseType_t ) ( xConstTickCount - xDeadline ) <= ( BaseType_t ) 0 ) ? pdTRUE : pdFALSE, pdFALSE );
+                }
+            #endif
+
             if( xShouldDelay != pdFALSE )
             {
                 traceTASK_DELAY_UNTIL( xTimeToWake );
@@ -1386,10 +2402,35 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 /* prvAddCurrentTaskToDelayedList() needs the block time, not
                  * the time to wake, so subtract the current tick count. */
                 prvAddCurrentTaskToDelayedList( xTimeToWake - xConstTickCount, pdFALSE );
+
+                #if ( configUSE_EDF_FIRM_DEADLINES == 1 )
+                    {
+                        /* Lets the tick interrupt advance the wake time if it
+                         * skips the next job. */
+                        pxCurrentTCB->pxFirmWakeTime = pxPreviousWakeTime;
+                    }
+                #endif
             }
             else
             {
-                mtCOVERAGE_TEST_MARKER();
+                #if ( configUSE_EDF_SCHEDULER == 1 )
+                    {
+                        /* The next job was released while the previous one was
+                         * still executing, so it starts immediately with a fresh
+                         * budget and the deadline of its nominal release time. */
+                        ( void ) uxListRemove( &( pxCurrentTCB->xStateListItem ) );
+
+                        #if ( tskEDF_TRACK_JOBS == 1 )
+                            prvEDFJobReleased( pxCurrentTCB, xTimeToWake );
+                        #else
+                            listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake + taskEDF_RELATIVE_DEADLINE( pxCurrentTCB ) );
+                        #endif
+
+                        prvAddTaskToReadyList( pxCurrentTCB );
+                    }
+                #else
+                    mtCOVERAGE_TEST_MARKER();
+                #endif
             }
         }
         xAlreadyYielded = xTaskResumeAll();
@@ -1742,7 +2783,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
 							#if (configUSE_EDF_SCHEDULER == 0)
 									if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
 							#else
-									if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists), &( pxTCB->xStateListItem ) ) != pdFALSE )
+									if( taskEDF_IS_READY( pxTCB ) != pdFALSE )
 							#endif
                 {
                     /* The task is currently in its ready list - remove before
@@ -2077,7 +3118,31 @@ void vTaskStartScheduler( void )
     BaseType_t xReturn;
 
     /* Add the idle task at the lowest priority. */
-    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configUSE_EDF_SCHEDULER == 1 )
+        {
+            PeriodicTaskParameters_t xIdleTaskDefinition;
+            StaticPeriodicTask_t * pxIdleTaskTCBBuffer = NULL;
+            StackType_t * pxIdleTaskStackBuffer = NULL;
+            uint32_t ulIdleTaskStackSize;
+
+            /* The Idle task is created using user provided RAM, which has to
+             * hold the EDF members of the TCB as well. */
+            vApplicationGetPeriodicIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &ulIdleTaskStackSize );
+
+            ( void ) memset( ( void * ) &xIdleTaskDefinition, 0x00, sizeof( xIdleTaskDefinition ) );
+            xIdleTaskDefinition.pvTaskCode = prvIdleTask;
+            xIdleTaskDefinition.pcName = configIDLE_TASK_NAME;
+            xIdleTaskDefinition.usStackDepth = ( configSTACK_DEPTH_TYPE ) ulIdleTaskStackSize;
+            xIdleTaskDefinition.pvParameters = NULL;
+            xIdleTaskDefinition.uxPriority = portPRIVILEGE_BIT; /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
+            xIdleTaskDefinition.xPeriod = configEDF_IDLE_TASK_PERIOD;
+
+            xReturn = xTaskPeriodicCreateStatic( &xIdleTaskDefinition,
+                                                 pxIdleTaskStackBuffer,
+                                                 pxIdleTaskTCBBuffer,
+                                                 &xIdleTaskHandle );
+        }
+    #elif ( configSUPPORT_STATIC_ALLOCATION == 1 )
         {
             StaticTask_t * pxIdleTaskTCBBuffer = NULL;
             StackType_t * pxIdleTaskStackBuffer = NULL;
@@ -2115,14 +3180,13 @@ void vTaskStartScheduler( void )
                                    &xIdleTaskHandle
 																						); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
 					#else 
-						TickType_t IDLE_Period = 200;
 						xReturn = xTaskPeriodicCreate( prvIdleTask,
                                    configIDLE_TASK_NAME,
                                    configMINIMAL_STACK_SIZE,
                                    ( void * ) NULL,
                                    portPRIVILEGE_BIT,  /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
                                    &xIdleTaskHandle,
-																	 IDLE_Period ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+																	 configEDF_IDLE_TASK_PERIOD ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
 				#endif
         }
     #endif /* configSUPPORT_STATIC_ALLOCATION */
@@ -2172,6 +3236,14 @@ void vTaskStartScheduler( void )
         xSchedulerRunning = pdTRUE;
         xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
 
+        #if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+            {
+                /* The first job starts without passing through
+                 * vTaskSwitchContext(). */
+                prvEDFPushPreemptionStack( pxCurrentTCB );
+            }
+        #endif
+
         /* If configGENERATE_RUN_TIME_STATS is defined then the following
          * macro must be defined to configure the timer/counter used to generate
          * the run time counter time base.   NOTE:  If configGENERATE_RUN_TIME_STATS
@@ -2246,6 +3318,33 @@ void vTaskSuspendAll( void )
 
 #if ( configUSE_TICKLESS_IDLE != 0 )
 
+    #if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static TickType_t prvGetExpectedIdleTime( void )
+    {
+        TickType_t xReturn;
+
+        /* The idle task is held in the ready list with the other tasks, so a
+         * list of more than one task holds a job that has to run, whatever the
+         * deadline of the idle task. */
+        if( pxCurrentTCB != ( TCB_t * ) xIdleTaskHandle )
+        {
+            xReturn = 0;
+        }
+        else if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists ) ) > ( UBaseType_t ) 1 )
+        {
+            xReturn = 0;
+        }
+        else
+        {
+            xReturn = xNextTaskUnblockTime - xTickCount;
+        }
+
+        return xReturn;
+    }
+
+    #else /* configUSE_EDF_SCHEDULER */
+
     static TickType_t prvGetExpectedIdleTime( void )
     {
         TickType_t xReturn;
@@ -2304,6 +3403,8 @@ void vTaskSuspendAll( void )
         return xReturn;
     }
 
+    #endif /* configUSE_EDF_SCHEDULER */
+
 #endif /* configUSE_TICKLESS_IDLE */
 /*----------------------------------------------------------*/
 
@@ -2337,6 +3438,23 @@ BaseType_t xTaskResumeAll( void )
                     listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
                     portMEMORY_BARRIER();
                     listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+
+                    #if ( configUSE_EDF_PRECEDENCE == 1 )
+                        if( pxTCB->pxPrecedenceSender != NULL )
+                        {
+                            prvEDFPrecedenceRelease( pxTCB, pxTCB->pxPrecedenceSender );
+                            pxTCB->pxPrecedenceSender = NULL;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    #endif
+
+                    #if ( configUSE_EDF_DEFERRED_INTERRUPTS == 1 )
+                        prvEDFApplyDeferredDeadline( pxTCB );
+                    #endif
+
                     prvAddTaskToReadyList( pxTCB );
 
                     /* If the moved task has a priority higher than or equal to
@@ -2624,7 +3742,11 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char
                                       const UBaseType_t uxArraySize,
                                       configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime )
     {
-        UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
+        UBaseType_t uxTask = 0;
+
+        #if ( configUSE_EDF_SCHEDULER != 1 )
+            UBaseType_t uxQueue = configMAX_PRIORITIES;
+        #endif
 
         vTaskSuspendAll();
         {
@@ -2633,26 +3755,43 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char
             {
                 /* Fill in an TaskStatus_t structure with information on each
                  * task in the Ready state. */
-                do
-                {
-                    uxQueue--;
-									
-									 /* Configuration for EDF Scheduler */
-									#if (configUSE_EDF_SCHEDULER == 1)
-											 uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists), eReady );
-									#else
-											 uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady );
-									#endif
-      
-                } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                #if ( configUSE_EDF_SCHEDULER == 1 )
+                    {
+                        /* EDF keeps one ready list, besides the lists holding
+                         * the ready tasks of each server and the ready
+                         * aperiodic tasks. */
+                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists ), eReady );
 
-                /* Fill in an TaskStatus_t structure with information on each
-                 * task in the Blocked state. */
-                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
-                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+                        #if ( configUSE_EDF_SLACK_STEALING == 1 )
+                            uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xAperiodicReadyList, eReady );
+                        #endif
 
-                #if ( INCLUDE_vTaskDelete == 1 )
-                    {
+                        #if ( configUSE_EDF_SERVERS == 1 )
+                            {
+                                EDFServer_t * pxServer;
+
+                                for( pxServer = pxServerList; pxServer != NULL; pxServer = pxServer->pxNextServer )
+                                {
+                                    uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxServer->xReadyTasksList ), eReady );
+                                }
+                            }
+                        #endif
+                    }
+                #else /* if ( configUSE_EDF_SCHEDULER == 1 ) */
+                    do
+                    {
+                        uxQueue--;
+                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady );
+                    } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                #endif /* if ( configUSE_EDF_SCHEDULER == 1 ) */
+
+                /* Fill in an TaskStatus_t structure with information on each
+                 * task in the Blocked state. */
+                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
+                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+
+                #if ( INCLUDE_vTaskDelete == 1 )
+                    {
                         /* Fill in an TaskStatus_t structure with information on
                          * each task that has been deleted but not yet cleaned up. */
                         uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xTasksWaitingTermination, eDeleted );
@@ -2851,6 +3990,17 @@ BaseType_t xTaskIncrementTick( void )
          * delayed lists if it wraps to 0. */
         xTickCount = xConstTickCount;
 
+        #if ( configUSE_EDF_JOB_STATISTICS == 1 )
+            {
+                /* Completion times are measured from the latest tick. */
+                #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                    portALT_GET_RUN_TIME_COUNTER_VALUE( ulTickRunTime );
+                #else
+                    ulTickRunTime = portGET_RUN_TIME_COUNTER_VALUE();
+                #endif
+            }
+        #endif
+
         if( xConstTickCount == ( TickType_t ) 0U ) /*lint !e774 'if' does not always evaluate to false as it is looking for an overflow. */
         {
             taskSWITCH_DELAYED_LISTS();
@@ -2922,9 +4072,24 @@ BaseType_t xTaskIncrementTick( void )
 													/* Configuration for EDF Scheduler */
 													#if (configUSE_EDF_SCHEDULER == 1)
 													{
-														listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ), ( pxTCB)->xTaskPeriod + xTickCount);
+														taskEDF_RELEASE_JOB( pxTCB );
+
+														#if ( configUSE_EDF_TIMERS == 1 )
+															prvEDFApplyWakeDeadline( pxTCB );
+														#endif
 													}
 													#endif
+
+                    #if ( configUSE_EDF_FIRM_DEADLINES == 1 )
+                        {
+                            /* A skipped job leaves the task in the delayed
+                             * list, so move on to the next task. */
+                            if( prvEDFFirmSkipJob( pxTCB, xConstTickCount ) != pdFALSE )
+                            {
+                                continue;
+                            }
+                        }
+                    #endif
 													
                     prvAddTaskToReadyList( pxTCB );
 										
@@ -2935,9 +4100,19 @@ BaseType_t xTaskIncrementTick( void )
 													/*configuration for EDF Scheduler */
 													#if (configUSE_EDF_SCHEDULER == 1)
 						
-														if(listGET_LIST_ITEM_VALUE( &(pxTCB->xStateListItem) ) < listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ))){
-															 xSwitchRequired = pdTRUE;
-														
+														if( taskEDF_CAN_PREEMPT_CURRENT( pxTCB ) ){
+															#if ( configUSE_EDF_LIMITED_PREEMPTION == 1 )
+																if( pxCurrentTCB->uxNonPreemptiveNesting != ( UBaseType_t ) 0U )
+																{
+																	/* The running task is non-preemptive - hold the
+																	 * preemption until its next preemption point. */
+																	xPreemptionDeferred = pdTRUE;
+																}
+																else
+															#endif
+																{
+																	xSwitchRequired = pdTRUE;
+																}
 														}
 													#else
 													{
@@ -2954,7 +4129,7 @@ BaseType_t xTaskIncrementTick( void )
                             {
                                 mtCOVERAGE_TEST_MARKER();
                             }
-													{
+													}
 													#endif
 												}  
                     #endif /* configUSE_PREEMPTION */
@@ -2978,6 +4153,53 @@ BaseType_t xTaskIncrementTick( void )
             }
         #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
 
+        #if ( configUSE_EDF_RECLAIMING == 1 )
+            {
+                prvEDFReclaimTick( xConstTickCount );
+            }
+        #endif /* configUSE_EDF_RECLAIMING */
+
+        #if ( configUSE_EDF_SLACK_STEALING == 1 )
+            {
+                if( prvEDFSlackTick() != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* configUSE_EDF_SLACK_STEALING */
+
+        #if ( configUSE_EDF_SERVERS == 1 )
+            {
+                if( prvEDFServerTick( xConstTickCount ) != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* configUSE_EDF_SERVERS */
+
+        #if ( configUSE_EDF_MIXED_CRITICALITY == 1 )
+            {
+                /* Switching to HI criticality mode changes the deadline of every
+                 * ready job, so reschedule. */
+                if( prvEDFCheckBudgetOverrun() != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* configUSE_EDF_MIXED_CRITICALITY */
+
         #if ( configUSE_TICK_HOOK == 1 )
             {
                 /* Guard against the tick hook being called when the pended tick
@@ -3166,6 +4388,13 @@ void vTaskSwitchContext( void )
                 if( ulTotalRunTime > ulTaskSwitchedInTime )
                 {
                     pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
+
+                    #if ( tskEDF_TRACK_JOBS == 1 )
+                        {
+                            /* Charge the execution to the budget of the current job. */
+                            pxCurrentTCB->ulJobRunTime += ( ulTotalRunTime - ulTaskSwitchedInTime );
+                        }
+                    #endif
                 }
                 else
                 {
@@ -3194,7 +4423,55 @@ void vTaskSwitchContext( void )
 				 }
 				 #else
 				 {
-					 pxCurrentTCB = (TCB_t *) listGET_OWNER_OF_HEAD_ENTRY( (&pxReadyTasksLists) );
+					 #if ( configUSE_TRACE_FACILITY == 1 )
+						 TCB_t * const pxPreviousTCB = pxCurrentTCB;
+					 #endif
+
+					 #if ( configUSE_EDF_LIMITED_PREEMPTION == 1 )
+					 {
+						 /* A task that is still ready but is inside a non-preemptive
+						  * region keeps the processor.  Any task with an earlier
+						  * deadline runs once the region ends. */
+						 if( ( pxCurrentTCB->uxNonPreemptiveNesting != ( UBaseType_t ) 0U ) &&
+							 ( taskEDF_IS_READY( pxCurrentTCB ) != pdFALSE ) )
+						 {
+							 if( taskEDF_EARLIEST_DEADLINE_TASK() != pxCurrentTCB )
+							 {
+								 xPreemptionDeferred = pdTRUE;
+							 }
+						 }
+						 else
+						 {
+							 xPreemptionDeferred = pdFALSE;
+							 pxCurrentTCB = taskEDF_SELECT_TASK();
+						 }
+					 }
+					 #else
+					 {
+						 pxCurrentTCB = taskEDF_SELECT_TASK();
+					 }
+					 #endif
+
+					 #if ( configUSE_EDF_MIXED_CRITICALITY == 1 )
+					 {
+						 /* No HI criticality job is pending once the idle task is
+						  * selected, so LO criticality tasks can run normally again. */
+						 if( ( eCriticalityMode == eCriticalityHigh ) && ( pxCurrentTCB == ( TCB_t * ) xIdleTaskHandle ) )
+						 {
+							 prvEDFSetCriticalityMode( eCriticalityLow );
+							 pxCurrentTCB = taskEDF_SELECT_TASK();
+						 }
+					 }
+					 #endif
+
+					 #if ( configUSE_TRACE_FACILITY == 1 )
+					 {
+						 if( pxCurrentTCB != pxPreviousTCB )
+						 {
+							 ulContextSwitchCount++;
+						 }
+					 }
+					 #endif
 				 }
 				 #endif
 				 
@@ -3331,6 +4608,23 @@ BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
     if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
     {
         listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
+
+        #if ( configUSE_EDF_PRECEDENCE == 1 )
+            /* An interrupt does not run a job of the task it interrupted. */
+            if( configEDF_IS_INSIDE_INTERRUPT() == pdFALSE )
+            {
+                prvEDFPrecedenceRelease( pxUnblockedTCB, pxCurrentTCB );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        #endif
+
+        #if ( configUSE_EDF_TIMERS == 1 )
+            prvEDFApplyWakeDeadline( pxUnblockedTCB );
+        #endif
+
         prvAddTaskToReadyList( pxUnblockedTCB );
 
         #if ( configUSE_TICKLESS_IDLE != 0 )
@@ -3352,6 +4646,19 @@ BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
         /* The delayed and ready lists cannot be accessed, so hold this task
          * pending until the scheduler is resumed. */
         listINSERT_END( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
+
+        #if ( configUSE_EDF_PRECEDENCE == 1 )
+            /* Remembered so xTaskResumeAll() releases the job in the chain
+             * of the running task. */
+            if( configEDF_IS_INSIDE_INTERRUPT() == pdFALSE )
+            {
+                pxUnblockedTCB->pxPrecedenceSender = pxCurrentTCB;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        #endif
     }
 
     if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
@@ -3596,8 +4903,18 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
         #if ( ( configUSE_PREEMPTION == 1 ) && ( configIDLE_SHOULD_YIELD == 1 ) )
             {
 							#if (configUSE_EDF_SCHEDULER == 1)
-							
-									listSET_LIST_ITEM_VALUE( &( ( pxCurrentTCB )->xStateListItem ), ( pxCurrentTCB)->xTaskPeriod + xTickCount);
+								/* The idle task stays in the sorted ready list, behind every
+								 * job with a deadline, so it never delays a ready job and any
+								 * released job preempts it.  Only the LO criticality jobs
+								 * degraded to portMAX_DELAY in HI mode come after it. */
+								taskENTER_CRITICAL();
+								{
+									( void ) uxListRemove( &( pxCurrentTCB->xStateListItem ) );
+									listSET_LIST_ITEM_VALUE( &( ( pxCurrentTCB )->xStateListItem ), portMAX_DELAY - ( TickType_t ) 1 );
+									vListInsert( &( pxReadyTasksLists ), &( pxCurrentTCB->xStateListItem ) );
+								}
+								taskEXIT_CRITICAL();
+
 								if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists) ) > ( UBaseType_t ) 1 )
                 {
                     taskYIELD();
@@ -3811,6 +5128,10 @@ static void prvInitialiseTaskLists( void )
 	#if ( configUSE_EDF_SCHEDULER == 1 )
 	{
 			vListInitialise( &pxReadyTasksLists );
+
+			#if ( configUSE_EDF_SLACK_STEALING == 1 )
+				vListInitialise( &xAperiodicReadyList );
+			#endif
 	}
 	#else
 	{
@@ -4117,7 +5438,13 @@ static void prvCheckTasksWaitingTermination( void )
             {
                 /* The task can only have been allocated dynamically - free both
                  * the stack and TCB. */
-                vPortFreeStack( pxTCB->pxStack );
+                #if ( configUSE_EDF_SHARED_STACK == 1 )
+                    if( pxTCB->pxStack != uxEDFSharedStack )
+                #endif
+                {
+                    vPortFreeStack( pxTCB->pxStack );
+                }
+
                 vPortFree( pxTCB );
             }
         #elif ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
@@ -5084,6 +6411,15 @@ TickType_t uxTaskResetEventItemValue( void )
             if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
             {
                 listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+
+                #if ( configUSE_EDF_PRECEDENCE == 1 )
+                    prvEDFPrecedenceRelease( pxTCB, pxCurrentTCB );
+                #endif
+
+                #if ( configUSE_EDF_TIMERS == 1 )
+                    prvEDFApplyWakeDeadline( pxTCB );
+                #endif
+
                 prvAddTaskToReadyList( pxTCB );
 
                 /* The task should not have been on an event list. */
@@ -5231,6 +6567,11 @@ TickType_t uxTaskResetEventItemValue( void )
                 if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
                 {
                     listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+
+                    #if ( configUSE_EDF_DEFERRED_INTERRUPTS == 1 )
+                        prvEDFApplyDeferredDeadline( pxTCB );
+                    #endif
+
                     prvAddTaskToReadyList( pxTCB );
                 }
                 else
@@ -5456,34 +6797,2437 @@ TickType_t uxTaskResetEventItemValue( void )
 #endif /* if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
-                                            const BaseType_t xCanBlockIndefinitely )
-{
-    TickType_t xTimeToWake;
-    const TickType_t xConstTickCount = xTickCount;
+#if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
 
-    #if ( INCLUDE_xTaskAbortDelay == 1 )
+    #if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+
+        /* Shortest relative deadline of the tasks that cannot preempt a started
+         * job with the preemption threshold xPreemptionThreshold.  These are
+         * the tasks whose period is at least the threshold, which can have a
+         * shorter relative deadline when they are created with one or are the
+         * predecessor of another task. */
+        static uint32_t prvEDFThresholdDeadline( TickType_t xPreemptionThreshold )
         {
-            /* About to enter a delayed list, so ensure the ucDelayAborted flag is
-             * reset to pdFALSE so it can be detected as having been set to pdTRUE
-             * when the task leaves the Blocked state. */
-            pxCurrentTCB->ucDelayAborted = pdFALSE;
+            TickType_t xDeadline = xPreemptionThreshold;
+            const TCB_t * pxTCB;
+
+            for( pxTCB = pxPeriodicTaskList; pxTCB != NULL; pxTCB = pxTCB->pxNextPeriodicTCB )
+            {
+                if( ( pxTCB->xTaskPeriod >= xPreemptionThreshold ) && ( taskEDF_RELATIVE_DEADLINE( pxTCB ) < xDeadline ) )
+                {
+                    xDeadline = taskEDF_RELATIVE_DEADLINE( pxTCB );
+                }
+            }
+
+            return ( uint32_t ) xDeadline;
         }
-    #endif
 
-    /* Remove the task from the ready list before adding it to the blocked list
-     * as the same list item is used for both lists. */
-    if( uxListRemove( &( pxCurrentTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+    #endif /* configUSE_EDF_PREEMPTION_THRESHOLD */
+
+    static int32_t prvEDFReadTask( void * pvContext,
+                                   size_t uxIndex,
+                                   EDFAnalysisTask_t * pxTask )
     {
-        /* The current task must be in a ready list, so there is no need to
-         * check, and the port reset macro can be called directly. */
-        portRESET_READY_PRIORITY( pxCurrentTCB->uxPriority, uxTopReadyPriority ); /*lint !e931 pxCurrentTCB cannot change as it is the calling task.  pxCurrentTCB->uxPriority and uxTopReadyPriority cannot change as called with scheduler suspended or in a critical section. */
+        EDFAdmissionContext_t * pxContext = ( EDFAdmissionContext_t * ) pvContext;
+        const TCB_t * pxTCB;
+
+        if( uxIndex == ( size_t ) 0U )
+        {
+            pxContext->pxNextTCB = pxPeriodicTaskList;
+
+            #if ( configUSE_EDF_SERVERS == 1 )
+                pxContext->pxNextServer = pxServerList;
+            #endif
+
+            if( pxContext->pxCandidate != NULL )
+            {
+                *pxTask = *( pxContext->pxCandidate );
+                return 1;
+            }
+        }
+
+        pxTCB = pxContext->pxNextTCB;
+
+        if( pxTCB != NULL )
+        {
+            pxContext->pxNextTCB = pxTCB->pxNextPeriodicTCB;
+
+            pxTask->ulPeriod = ( uint32_t ) pxTCB->xTaskPeriod;
+            pxTask->ulDeadline = ( uint32_t ) taskEDF_RELATIVE_DEADLINE( pxTCB );
+            pxTask->ulWcet = ( uint32_t ) pxTCB->xTaskWcet;
+            pxTask->ulNonPreemptive = 0UL;
+            pxTask->ulPreemptionThreshold = 0UL;
+
+            #if ( configUSE_EDF_SERVERS == 1 )
+                if( pxTCB->pxServer != NULL )
+                {
+                    pxTask->ulWcet = 0UL;
+                }
+            #endif
+
+            #if ( configUSE_EDF_LIMITED_PREEMPTION == 1 )
+                pxTask->ulNonPreemptive = ( uint32_t ) pxTCB->xTaskMaxNonPreemptive;
+            #endif
+
+            #if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+                pxTask->ulPreemptionThreshold = prvEDFThresholdDeadline( pxTCB->xTaskPreemptionThreshold );
+            #endif
+
+            return 1;
+        }
+
+        #if ( configUSE_EDF_SERVERS == 1 )
+            {
+                const EDFServer_t * pxServer = pxContext->pxNextServer;
+
+                if( pxServer != NULL )
+                {
+                    pxContext->pxNextServer = pxServer->pxNextServer;
+
+                    pxTask->ulPeriod = ( uint32_t ) pxServer->xPeriod;
+                    pxTask->ulDeadline = ( uint32_t ) pxServer->xPeriod;
+                    pxTask->ulWcet = ( uint32_t ) pxServer->xBudget;
+                    pxTask->ulNonPreemptive = 0UL;
+                    pxTask->ulPreemptionThreshold = 0UL;
+
+                    return 1;
+                }
+            }
+        #endif /* configUSE_EDF_SERVERS */
+
+        return 0;
     }
-    else
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvEDFTaskSetFeasible( const EDFAnalysisTask_t * const pxCandidate )
     {
-        mtCOVERAGE_TEST_MARKER();
+        EDFAdmissionContext_t xContext;
+        EDFAnalysisTaskSet_t xTaskSet;
+
+        xContext.pxCandidate = pxCandidate;
+
+        xTaskSet.pxTasks = NULL;
+        xTaskSet.uxTaskCount = ( size_t ) 0U;
+        xTaskSet.pxReadTask = prvEDFReadTask;
+        xTaskSet.pvContext = &xContext;
+        xTaskSet.ulMaxSteps = ( uint32_t ) configEDF_ANALYSIS_MAX_STEPS;
+
+        /* The same analysis as Tools/edf_analyze.c, so a task set the
+         * analyzer accepts is also admitted here. */
+        return ( eEDFAnalysisQPATest( &xTaskSet, NULL ) == eEDFAnalysisFeasible ) ? pdPASS : pdFAIL;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvEDFAdmitTask( const PeriodicTaskParameters_t * const pxTaskDefinition )
+    {
+        BaseType_t xReturn = pdPASS;
+        EDFAnalysisTask_t xCandidate;
+
+        #if ( configUSE_EDF_LIMITED_PREEMPTION == 1 )
+            const BaseType_t xAddsLoad = ( ( pxTaskDefinition->xWcet != ( TickType_t ) 0U ) || ( pxTaskDefinition->xMaxNonPreemptive != ( TickType_t ) 0U ) ) ? pdTRUE : pdFALSE;
+        #else
+            const BaseType_t xAddsLoad = ( pxTaskDefinition->xWcet != ( TickType_t ) 0U ) ? pdTRUE : pdFALSE;
+        #endif
+
+        /* A task that neither executes for a known time nor blocks other tasks
+         * cannot make an admitted task set unschedulable. */
+        if( xAddsLoad != pdFALSE )
+        {
+            xCandidate.ulPeriod = ( uint32_t ) pxTaskDefinition->xPeriod;
+            xCandidate.ulDeadline = ( uint32_t ) taskEDF_DEFINITION_DEADLINE( pxTaskDefinition );
+            xCandidate.ulWcet = ( uint32_t ) pxTaskDefinition->xWcet;
+            xCandidate.ulNonPreemptive = 0UL;
+            xCandidate.ulPreemptionThreshold = 0UL;
+
+            #if ( configUSE_EDF_LIMITED_PREEMPTION == 1 )
+                xCandidate.ulNonPreemptive = ( uint32_t ) pxTaskDefinition->xMaxNonPreemptive;
+            #endif
+
+            vTaskSuspendAll();
+            {
+                #if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+                    {
+                        const TickType_t xPreemptionThreshold = ( pxTaskDefinition->xPreemptionThreshold != ( TickType_t ) 0U ) ? pxTaskDefinition->xPreemptionThreshold : pxTaskDefinition->xPeriod;
+
+                        xCandidate.ulPreemptionThreshold = prvEDFThresholdDeadline( xPreemptionThreshold );
+
+                        /* The period of the candidate is at least its threshold,
+                         * so its own deadline counts as well. */
+                        if( xCandidate.ulDeadline < xCandidate.ulPreemptionThreshold )
+                        {
+                            xCandidate.ulPreemptionThreshold = xCandidate.ulDeadline;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                #endif
+
+                #if ( configUSE_EDF_MIXED_CRITICALITY == 1 )
+                    {
+                        uint32_t ulLowUtilisation = 0UL;
+                        uint32_t ulHighUtilisationLow = 0UL;
+                        uint32_t ulHighUtilisationHigh = 0UL;
+                        uint32_t ulScale;
+                        const TCB_t * pxTCB;
+
+                        /* HI criticality tasks are accounted for at both of their
+                         * WCETs.  The task set must pass the EDF-VD test. */
+                        if( pxTaskDefinition->eCriticality == eCriticalityHigh )
+                        {
+                            ulHighUtilisationLow = taskEDF_UTILISATION( pxTaskDefinition->xWcet, taskEDF_DEFINITION_DEADLINE( pxTaskDefinition ) );
+                            ulHighUtilisationHigh = taskEDF_UTILISATION( ( pxTaskDefinition->xWcetHigh > pxTaskDefinition->xWcet ) ? pxTaskDefinition->xWcetHigh : pxTaskDefinition->xWcet, taskEDF_DEFINITION_DEADLINE( pxTaskDefinition ) );
+                        }
+                        else
+                        {
+                            ulLowUtilisation = taskEDF_UTILISATION( pxTaskDefinition->xWcet, taskEDF_DEFINITION_DEADLINE( pxTaskDefinition ) );
+                        }
+
+                        for( pxTCB = pxPeriodicTaskList; pxTCB != NULL; pxTCB = pxTCB->pxNextPeriodicTCB )
+                        {
+                            if( pxTCB->eCriticality == eCriticalityHigh )
+                            {
+                                ulHighUtilisationLow += taskEDF_UTILISATION( pxTCB->xTaskWcet, pxTCB->xTaskDeadline );
+                                ulHighUtilisationHigh += taskEDF_UTILISATION( pxTCB->xTaskWcetHigh, pxTCB->xTaskDeadline );
+                            }
+                            else
+                            {
+                                ulLowUtilisation += taskEDF_UTILISATION( pxTCB->xTaskWcet, pxTCB->xTaskDeadline );
+                            }
+                        }
+
+                        xReturn = prvEDFVirtualDeadlineScale( ulLowUtilisation, ulHighUtilisationLow, ulHighUtilisationHigh, &ulScale );
+                    }
+                #endif /* configUSE_EDF_MIXED_CRITICALITY */
+
+                /* The task set, with the blocking introduced by non-preemptive
+                 * execution, must pass the processor demand analysis. */
+                if( xReturn == pdPASS )
+                {
+                    xReturn = prvEDFTaskSetFeasible( &xCandidate );
+                }
+            }
+            ( void ) xTaskResumeAll();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
     }
 
+#endif /* configUSE_EDF_ADMISSION_CONTROL */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_PREEMPTION_THRESHOLD == 1 )
+
+    static TCB_t * prvEDFSelectTaskAboveCeiling( void )
+    {
+        TCB_t ** ppxStackEntry;
+        TCB_t * pxTCB;
+        const ListItem_t * pxListItem;
+        const ListItem_t * const pxEndMarker = listGET_END_MARKER( &pxReadyTasksLists );
+        TickType_t xCeiling = ( TickType_t ) portMAX_DELAY;
+
+        /* A task that left the ready list has completed its job, so it no
+         * longer restricts which tasks can run.  Normally only the stack top
+         * leaves, but any task can be suspended or deleted. */
+        ppxStackEntry = &pxPreemptionStackTop;
+
+        while( *ppxStackEntry != NULL )
+        {
+            pxTCB = *ppxStackEntry;
+
+            if( listIS_CONTAINED_WITHIN( &pxReadyTasksLists, &( pxTCB->xStateListItem ) ) == pdFALSE )
+            {
+                pxTCB->xOnPreemptionStack = pdFALSE;
+                *ppxStackEntry = pxTCB->pxPreemptedTCB;
+            }
+            else
+            {
+                if( pxTCB->xTaskPreemptionThreshold < xCeiling )
+                {
+                    xCeiling = pxTCB->xTaskPreemptionThreshold;
+                }
+
+                ppxStackEntry = &( pxTCB->pxPreemptedTCB );
+            }
+        }
+
+        if( pxPreemptionStackTop == NULL )
+        {
+            /* No job is in progress so the earliest deadline runs. */
+            pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( &pxReadyTasksLists );
+        }
+        else
+        {
+            /* The list is ordered by deadline, so the first task that is either
+             * the most recently started job or can preempt every started job
+             * is the one to run.  The idle task never preempts a started job. */
+            pxTCB = pxPreemptionStackTop;
+
+            for( pxListItem = listGET_HEAD_ENTRY( &pxReadyTasksLists ); pxListItem != pxEndMarker; pxListItem = listGET_NEXT( pxListItem ) )
+            {
+                TCB_t * const pxCandidateTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxListItem );
+
+                if( ( pxCandidateTCB == pxPreemptionStackTop ) ||
+                    ( ( pxCandidateTCB->xTaskPeriod < xCeiling ) && ( pxCandidateTCB != ( TCB_t * ) xIdleTaskHandle ) ) )
+                {
+                    pxTCB = pxCandidateTCB;
+                    break;
+                }
+            }
+        }
+
+        xPreemptionCeiling = xCeiling;
+
+        /* The job of the selected task starts now unless it was preempted
+         * earlier. */
+        prvEDFPushPreemptionStack( pxTCB );
+
+        return pxTCB;
+    }
+
+    static void prvEDFPushPreemptionStack( TCB_t * pxTCB )
+    {
+        /* The idle task never completes a job so is not tracked. */
+        if( ( pxTCB->xOnPreemptionStack == pdFALSE ) && ( pxTCB != ( TCB_t * ) xIdleTaskHandle ) )
+        {
+            pxTCB->xOnPreemptionStack = pdTRUE;
+            pxTCB->pxPreemptedTCB = pxPreemptionStackTop;
+            pxPreemptionStackTop = pxTCB;
+
+            if( pxTCB->xTaskPreemptionThreshold < xPreemptionCeiling )
+            {
+                xPreemptionCeiling = pxTCB->xTaskPreemptionThreshold;
+            }
+
+            #if ( configUSE_EDF_SHARED_STACK == 1 )
+                {
+                    if( pxTCB->pxJobCode != NULL )
+                    {
+                        StackType_t * pxTopOfStack = &( uxEDFSharedStack[ configEDF_SHARED_STACK_SIZE - 1 ] );
+                        const TCB_t * pxPreemptedTCB;
+
+                        /* Jobs on the shared stack complete in the reverse order
+                         * to which they start, so the new job's frame is placed
+                         * directly below that of the most recently preempted
+                         * run-to-completion job. */
+                        for( pxPreemptedTCB = pxTCB->pxPreemptedTCB; pxPreemptedTCB != NULL; pxPreemptedTCB = pxPreemptedTCB->pxPreemptedTCB )
+                        {
+                            if( pxPreemptedTCB->pxJobCode != NULL )
+                            {
+                                pxTopOfStack = ( StackType_t * ) ( pxPreemptedTCB->pxTopOfStack - 1 );
+                                break;
+                            }
+                        }
+
+                        pxTopOfStack = ( StackType_t * ) ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack ) & ( ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) ); /*lint !e923 !e9033 !e9078 MISRA exception. */
+
+                        /* The shared stack is too small for the depth of
+                         * preemption between run-to-completion jobs. */
+                        configASSERT( pxTopOfStack > uxEDFSharedStack );
+
+                        #if ( portHAS_STACK_OVERFLOW_CHECKING == 1 )
+                            pxTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, uxEDFSharedStack, prvEDFRunToCompletionTask, NULL );
+                        #else
+                            pxTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, prvEDFRunToCompletionTask, NULL );
+                        #endif
+                    }
+                }
+            #endif /* configUSE_EDF_SHARED_STACK */
+        }
+    }
+
+#endif /* configUSE_EDF_PREEMPTION_THRESHOLD */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_MIXED_CRITICALITY == 1 )
+
+    static TickType_t prvEDFAbsoluteDeadline( const TCB_t * const pxTCB )
+    {
+        TickType_t xRelativeDeadline = taskEDF_RELATIVE_DEADLINE( pxTCB );
+
+        if( pxTCB->eCriticality == eCriticalityHigh )
+        {
+            if( eCriticalityMode == eCriticalityLow )
+            {
+                /* Shortened deadlines leave enough slack for HI criticality
+                 * jobs to complete at their HI mode WCET after a mode switch. */
+                xRelativeDeadline = ( TickType_t ) ( ( ( uint32_t ) xRelativeDeadline * ulVirtualDeadlineScale ) / taskEDF_UTILISATION_SCALE );
+
+                if( xRelativeDeadline == ( TickType_t ) 0U )
+                {
+                    xRelativeDeadline = ( TickType_t ) 1U;
+                }
+            }
+        }
+        else if( ( eCriticalityMode == eCriticalityHigh ) && ( pxTCB != ( TCB_t * ) xIdleTaskHandle ) )
+        {
+            /* LO criticality jobs are degraded to background execution in HI
+             * mode - they only run once the idle task is selected. */
+            return portMAX_DELAY;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pxTCB->xTaskReleaseTime + xRelativeDeadline;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEDFSetCriticalityMode( eTaskCriticality eNewMode )
+    {
+        TCB_t * pxTCB;
+
+        eCriticalityMode = eNewMode;
+
+        /* Jobs that are not ready get their deadline when they are released. */
+        for( pxTCB = pxPeriodicTaskList; pxTCB != NULL; pxTCB = pxTCB->pxNextPeriodicTCB )
+        {
+            if( taskEDF_IS_READY( pxTCB ) != pdFALSE )
+            {
+                ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), prvEDFAbsoluteDeadline( pxTCB ) );
+                taskEDF_INSERT_READY_TASK( pxTCB );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        traceEDF_CRITICALITY_MODE_SWITCH( eNewMode );
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvEDFCheckBudgetOverrun( void )
+    {
+        BaseType_t xModeSwitched = pdFALSE;
+
+        if( ( eCriticalityMode == eCriticalityLow ) &&
+            ( pxCurrentTCB->eCriticality == eCriticalityHigh ) &&
+            ( pxCurrentTCB->xTaskWcet != ( TickType_t ) 0U ) )
+        {
+            if( prvEDFGetCurrentJobRunTime() > ( ( configRUN_TIME_COUNTER_TYPE ) pxCurrentTCB->xTaskWcet * ( configRUN_TIME_COUNTER_TYPE ) configEDF_RUN_TIME_COUNTS_PER_TICK ) )
+            {
+                /* The job overran its LO mode budget.  HI criticality jobs are
+                 * only guaranteed to meet their deadlines in HI mode. */
+                prvEDFSetCriticalityMode( eCriticalityHigh );
+                xModeSwitched = pdTRUE;
+            }
+        }
+
+        return xModeSwitched;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvEDFVirtualDeadlineScale( uint32_t ulLowUtilisation,
+                                                  uint32_t ulHighUtilisationLow,
+                                                  uint32_t ulHighUtilisationHigh,
+                                                  uint32_t * pulScale )
+    {
+        BaseType_t xReturn = pdFAIL;
+
+        *pulScale = taskEDF_UTILISATION_SCALE;
+
+        if( ( ulLowUtilisation + ulHighUtilisationHigh ) <= taskEDF_UTILISATION_SCALE )
+        {
+            /* Schedulable by plain EDF with the HI mode WCETs, so no deadline
+             * needs to be shortened. */
+            xReturn = pdPASS;
+        }
+        else if( ( ulLowUtilisation < taskEDF_UTILISATION_SCALE ) &&
+                 ( ulHighUtilisationHigh < taskEDF_UTILISATION_SCALE ) &&
+                 ( ulHighUtilisationLow <= taskEDF_UTILISATION_SCALE ) )
+        {
+            /* U_LO(LO) + U_HI(LO) / ( 1 - U_HI(HI) ) <= 1, with every term
+             * multiplied by the scale to stay in integer arithmetic. */
+            if( ( ulHighUtilisationLow * taskEDF_UTILISATION_SCALE ) <= ( ( taskEDF_UTILISATION_SCALE - ulLowUtilisation ) * ( taskEDF_UTILISATION_SCALE - ulHighUtilisationHigh ) ) )
+            {
+                /* x = U_HI(LO) / ( 1 - U_LO(LO) ), rounded up. */
+                *pulScale = ( ( ulHighUtilisationLow * taskEDF_UTILISATION_SCALE ) + ( taskEDF_UTILISATION_SCALE - ulLowUtilisation ) - 1UL ) / ( taskEDF_UTILISATION_SCALE - ulLowUtilisation );
+                xReturn = pdPASS;
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEDFUpdateVirtualDeadlineScale( void )
+    {
+        const TCB_t * pxTCB;
+        uint32_t ulLowUtilisation = 0UL;
+        uint32_t ulHighUtilisationLow = 0UL;
+        uint32_t ulHighUtilisationHigh = 0UL;
+        uint32_t ulScale;
+
+        for( pxTCB = pxPeriodicTaskList; pxTCB != NULL; pxTCB = pxTCB->pxNextPeriodicTCB )
+        {
+            if( pxTCB->eCriticality == eCriticalityHigh )
+            {
+                ulHighUtilisationLow += taskEDF_UTILISATION( pxTCB->xTaskWcet, pxTCB->xTaskDeadline );
+                ulHighUtilisationHigh += taskEDF_UTILISATION( pxTCB->xTaskWcetHigh, pxTCB->xTaskDeadline );
+            }
+            else
+            {
+                ulLowUtilisation += taskEDF_UTILISATION( pxTCB->xTaskWcet, pxTCB->xTaskDeadline );
+            }
+        }
+
+        /* A task set that fails the test keeps its real deadlines. */
+        ( void ) prvEDFVirtualDeadlineScale( ulLowUtilisation, ulHighUtilisationLow, ulHighUtilisationHigh, &ulScale );
+        ulVirtualDeadlineScale = ulScale;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskCheckVirtualDeadlineScaling( const PeriodicTaskParameters_t * const pxTaskDefinitions,
+                                                 UBaseType_t uxNumberOfTasks,
+                                                 uint32_t * const pulScale )
+    {
+        UBaseType_t uxTask;
+        uint32_t ulLowUtilisation = 0UL;
+        uint32_t ulHighUtilisationLow = 0UL;
+        uint32_t ulHighUtilisationHigh = 0UL;
+        uint32_t ulScale;
+        BaseType_t xReturn;
+
+        configASSERT( pxTaskDefinitions );
+
+        for( uxTask = 0; uxTask < uxNumberOfTasks; uxTask++ )
+        {
+            const PeriodicTaskParameters_t * const pxTask = &( pxTaskDefinitions[ uxTask ] );
+
+            configASSERT( pxTask->xPeriod > ( TickType_t ) 0U );
+
+            if( pxTask->eCriticality == eCriticalityHigh )
+            {
+                ulHighUtilisationLow += taskEDF_UTILISATION( pxTask->xWcet, taskEDF_DEFINITION_DEADLINE( pxTask ) );
+                ulHighUtilisationHigh += taskEDF_UTILISATION( ( pxTask->xWcetHigh > pxTask->xWcet ) ? pxTask->xWcetHigh : pxTask->xWcet, taskEDF_DEFINITION_DEADLINE( pxTask ) );
+            }
+            else
+            {
+                ulLowUtilisation += taskEDF_UTILISATION( pxTask->xWcet, taskEDF_DEFINITION_DEADLINE( pxTask ) );
+            }
+        }
+
+        xReturn = prvEDFVirtualDeadlineScale( ulLowUtilisation, ulHighUtilisationLow, ulHighUtilisationHigh, &ulScale );
+
+        if( pulScale != NULL )
+        {
+            *pulScale = ulScale;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    eTaskCriticality eTaskGetCriticalityMode( void )
+    {
+        return eCriticalityMode;
+    }
+
+#endif /* configUSE_EDF_MIXED_CRITICALITY */
+/*-----------------------------------------------------------*/
+
+#if ( tskEDF_TRACK_JOBS == 1 )
+
+    static void prvEDFJobReleased( TCB_t * pxTCB,
+                                   TickType_t xReleaseTime )
+    {
+        pxTCB->xTaskReleaseTime = xReleaseTime;
+        pxTCB->ulJobRunTime = ( configRUN_TIME_COUNTER_TYPE ) 0;
+
+        #if ( configUSE_EDF_SLACK_STEALING == 1 )
+            xSlackOutOfDate = pdTRUE;
+        #endif
+
+        #if ( configUSE_EDF_MIXED_CRITICALITY == 1 )
+            listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), prvEDFAbsoluteDeadline( pxTCB ) );
+        #else
+            listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), xReleaseTime + taskEDF_RELATIVE_DEADLINE( pxTCB ) );
+        #endif
+    }
+/*-----------------------------------------------------------*/
+
+    static configRUN_TIME_COUNTER_TYPE prvEDFGetCurrentJobRunTime( void )
+    {
+        configRUN_TIME_COUNTER_TYPE ulNow, ulJobRunTime;
+
+        #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+            portALT_GET_RUN_TIME_COUNTER_VALUE( ulNow );
+        #else
+            ulNow = portGET_RUN_TIME_COUNTER_VALUE();
+        #endif
+
+        /* Add the time since the task was last switched in, which is only
+         * charged to the job at the next context switch. */
+        ulJobRunTime = pxCurrentTCB->ulJobRunTime;
+
+        if( ulNow > ulTaskSwitchedInTime )
+        {
+            ulJobRunTime += ( ulNow - ulTaskSwitchedInTime );
+        }
+
+        return ulJobRunTime;
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_EDF_SLACK_STEALING == 1 ) || ( configUSE_EDF_FIRM_DEADLINES == 1 )
+
+        static int32_t prvEDFGetRemainingJobTime( const TCB_t * const pxTCB )
+        {
+            configRUN_TIME_COUNTER_TYPE ulRunTicks;
+            int32_t lRemaining = 0;
+
+            /* A task that left the ready list has completed its job. */
+            if( listIS_CONTAINED_WITHIN( &pxReadyTasksLists, &( pxTCB->xStateListItem ) ) != pdFALSE )
+            {
+                if( pxTCB == pxCurrentTCB )
+                {
+                    ulRunTicks = prvEDFGetCurrentJobRunTime();
+                }
+                else
+                {
+                    ulRunTicks = pxTCB->ulJobRunTime;
+                }
+
+                /* Partially executed ticks are not credited to the job. */
+                ulRunTicks /= ( configRUN_TIME_COUNTER_TYPE ) configEDF_RUN_TIME_COUNTS_PER_TICK;
+
+                if( ulRunTicks < ( configRUN_TIME_COUNTER_TYPE ) pxTCB->xTaskWcet )
+                {
+                    lRemaining = ( int32_t ) ( pxTCB->xTaskWcet - ( TickType_t ) ulRunTicks );
+                }
+            }
+
+            return lRemaining;
+        }
+
+    #endif /* ( configUSE_EDF_SLACK_STEALING == 1 ) || ( configUSE_EDF_FIRM_DEADLINES == 1 ) */
+
+#endif /* tskEDF_TRACK_JOBS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_RECLAIMING == 1 )
+
+    static void prvEDFReclaimTaskActivate( TCB_t * pxTCB )
+    {
+        /* Tasks of unknown WCET reserve no bandwidth, and the bandwidth of a
+         * task attached to a server is accounted for by the server. */
+        if( ( pxTCB->xTaskWcet != ( TickType_t ) 0U ) && ( pxTCB->pxServer == NULL ) )
+        {
+            if( pxTCB->uxReclaimState == taskEDF_RECLAIM_DEACTIVATING )
+            {
+                /* Released again before the 0-lag time of the previous job. */
+                uxReclaimPending--;
+            }
+            else if( pxTCB->uxReclaimState == taskEDF_RECLAIM_INACTIVE )
+            {
+                ulActiveUtilisation += taskEDF_UTILISATION( pxTCB->xTaskWcet, pxTCB->xTaskPeriod );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxTCB->uxReclaimState = taskEDF_RECLAIM_ACTIVE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEDFReclaimTaskDeactivate( TCB_t * pxTCB )
+    {
+        if( pxTCB->uxReclaimState == taskEDF_RECLAIM_DEACTIVATING )
+        {
+            uxReclaimPending--;
+        }
+
+        if( pxTCB->uxReclaimState != taskEDF_RECLAIM_INACTIVE )
+        {
+            ulActiveUtilisation -= taskEDF_UTILISATION( pxTCB->xTaskWcet, pxTCB->xTaskPeriod );
+            pxTCB->uxReclaimState = taskEDF_RECLAIM_INACTIVE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEDFReclaimJobCompleted( TCB_t * pxTCB )
+    {
+        TickType_t xExecuted, xZeroLag;
+        const TickType_t xElapsed = xTickCount - pxTCB->xTaskReleaseTime;
+
+        if( pxTCB->uxReclaimState == taskEDF_RECLAIM_ACTIVE )
+        {
+            xExecuted = ( TickType_t ) ( ( prvEDFGetCurrentJobRunTime() + ( configRUN_TIME_COUNTER_TYPE ) configEDF_RUN_TIME_COUNTS_PER_TICK - 1U ) / ( configRUN_TIME_COUNTER_TYPE ) configEDF_RUN_TIME_COUNTS_PER_TICK );
+
+            /* The 0-lag time is when the job would have completed had it
+             * executed at exactly the reserved rate WCET / period.  Until then
+             * the bandwidth of the task cannot be given away without risking
+             * the deadlines of other tasks. */
+            if( xExecuted >= pxTCB->xTaskWcet )
+            {
+                xZeroLag = pxTCB->xTaskPeriod;
+            }
+            else
+            {
+                xZeroLag = ( TickType_t ) ( ( ( ( uint32_t ) xExecuted * ( uint32_t ) pxTCB->xTaskPeriod ) + ( uint32_t ) pxTCB->xTaskWcet - 1UL ) / ( uint32_t ) pxTCB->xTaskWcet );
+            }
+
+            if( xZeroLag <= xElapsed )
+            {
+                prvEDFReclaimTaskDeactivate( pxTCB );
+            }
+            else
+            {
+                pxTCB->xReclaimInactiveTime = pxTCB->xTaskReleaseTime + xZeroLag;
+                pxTCB->uxReclaimState = taskEDF_RECLAIM_DEACTIVATING;
+                uxReclaimPending++;
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEDFReclaimTick( TickType_t xConstTickCount )
+    {
+        TCB_t * pxTCB;
+
+        if( uxReclaimPending != ( UBaseType_t ) 0U )
+        {
+            for( pxTCB = pxPeriodicTaskList; pxTCB != NULL; pxTCB = pxTCB->pxNextPeriodicTCB )
+            {
+                if( ( pxTCB->uxReclaimState == taskEDF_RECLAIM_DEACTIVATING ) && ( pxTCB->xReclaimInactiveTime == xConstTickCount ) )
+                {
+                    prvEDFReclaimTaskDeactivate( pxTCB );
+                }
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    uint32_t ulTaskGetActiveUtilisation( void )
+    {
+        return ulActiveUtilisation;
+    }
+
+#endif /* configUSE_EDF_RECLAIMING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SLACK_STEALING == 1 )
+
+    static int32_t prvEDFSlackNextRelease( const TCB_t * const pxTCB,
+                                           TickType_t xNow )
+    {
+        int32_t lNextRelease;
+
+        /* Ticks from now until the earliest time the next job can be released,
+         * one period after the release of the current or last job. */
+        lNextRelease = ( int32_t ) ( ( TickType_t ) ( pxTCB->xTaskReleaseTime + pxTCB->xTaskPeriod ) - xNow );
+
+        return ( lNextRelease > 0 ) ? lNextRelease : 0;
+    }
+/*-----------------------------------------------------------*/
+
+    static int32_t prvEDFSlackDemand( int32_t lInterval,
+                                      TickType_t xNow )
+    {
+        const TCB_t * pxTCB;
+        int32_t lRemaining, lFirstDeadline;
+        int32_t lDemand = 0;
+
+        /* Execution time of the periodic jobs that must complete within
+         * lInterval ticks from now. */
+        for( pxTCB = pxPeriodicTaskList; pxTCB != NULL; pxTCB = pxTCB->pxNextPeriodicTCB )
+        {
+            if( pxTCB->xTaskWcet != ( TickType_t ) 0U )
+            {
+                lRemaining = prvEDFGetRemainingJobTime( pxTCB );
+
+                if( ( lRemaining != 0 ) &&
+                    ( ( int32_t ) ( listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) ) - xNow ) <= lInterval ) )
+                {
+                    lDemand += lRemaining;
+                }
+
+                lFirstDeadline = prvEDFSlackNextRelease( pxTCB, xNow ) + ( int32_t ) taskEDF_RELATIVE_DEADLINE( pxTCB );
+
+                if( lInterval >= lFirstDeadline )
+                {
+                    lDemand += ( int32_t ) ( ( ( ( TickType_t ) ( lInterval - lFirstDeadline ) / pxTCB->xTaskPeriod ) + 1U ) * pxTCB->xTaskWcet );
+                }
+            }
+        }
+
+        return lDemand;
+    }
+/*-----------------------------------------------------------*/
+
+    static TickType_t prvEDFComputeSlack( void )
+    {
+        const TickType_t xNow = xTickCount;
+        const TCB_t * pxTCB;
+        int32_t lFirstDeadline, lCheckpoint, lCheckpointSlack;
+        int32_t lHorizon = 0;
+        int32_t lSlack;
+        BaseType_t xTasksTracked = pdFALSE;
+        uint32_t ulUtilisation = 0UL;
+        TickType_t xSlack = portMAX_DELAY;
+
+        /* Every deadline before the horizon is either the deadline of a
+         * current job or the deadline of the next job of a task, so the
+         * processor demand only has to be evaluated at those 2N points. */
+        for( pxTCB = pxPeriodicTaskList; pxTCB != NULL; pxTCB = pxTCB->pxNextPeriodicTCB )
+        {
+            if( pxTCB->xTaskWcet != ( TickType_t ) 0U )
+            {
+                lCheckpoint = prvEDFSlackNextRelease( pxTCB, xNow ) + ( int32_t ) taskEDF_RELATIVE_DEADLINE( pxTCB ) + ( int32_t ) pxTCB->xTaskPeriod;
+
+                if( ( xTasksTracked == pdFALSE ) || ( lCheckpoint < lHorizon ) )
+                {
+                    lHorizon = lCheckpoint;
+                }
+
+                ulUtilisation += taskEDF_UTILISATION( pxTCB->xTaskWcet, pxTCB->xTaskPeriod );
+                xTasksTracked = pdTRUE;
+            }
+        }
+
+        if( ulUtilisation > taskEDF_UTILISATION_SCALE )
+        {
+            /* The periodic tasks alone can miss deadlines. */
+            xSlack = ( TickType_t ) 0U;
+        }
+        else if( xTasksTracked != pdFALSE )
+        {
+            /* Beyond the horizon the demand is bounded by the remaining time of
+             * the current jobs plus the utilisation of each task multiplied by
+             * the time since one period before its first future deadline.  The
+             * bound grows no faster than time as the utilisation is at most 1,
+             * so evaluating it at the horizon covers every later deadline. */
+            lSlack = lHorizon;
+
+            for( pxTCB = pxPeriodicTaskList; pxTCB != NULL; pxTCB = pxTCB->pxNextPeriodicTCB )
+            {
+                if( pxTCB->xTaskWcet != ( TickType_t ) 0U )
+                {
+                    lSlack -= prvEDFGetRemainingJobTime( pxTCB );
+
+                    lCheckpoint = lHorizon - ( prvEDFSlackNextRelease( pxTCB, xNow ) + ( int32_t ) taskEDF_RELATIVE_DEADLINE( pxTCB ) ) + ( int32_t ) pxTCB->xTaskPeriod;
+
+                    if( lCheckpoint > 0 )
+                    {
+                        lSlack -= ( int32_t ) ( ( ( ( uint32_t ) lCheckpoint * ( uint32_t ) pxTCB->xTaskWcet ) + ( uint32_t ) pxTCB->xTaskPeriod - 1UL ) / ( uint32_t ) pxTCB->xTaskPeriod );
+                    }
+                }
+            }
+
+            /* Before the horizon the demand is evaluated exactly. */
+            for( pxTCB = pxPeriodicTaskList; pxTCB != NULL; pxTCB = pxTCB->pxNextPeriodicTCB )
+            {
+                if( pxTCB->xTaskWcet != ( TickType_t ) 0U )
+                {
+                    if( prvEDFGetRemainingJobTime( pxTCB ) != 0 )
+                    {
+                        lCheckpoint = ( int32_t ) ( listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) ) - xNow );
+                        lCheckpointSlack = lCheckpoint - prvEDFSlackDemand( lCheckpoint, xNow );
+
+                        if( lCheckpointSlack < lSlack )
+                        {
+                            lSlack = lCheckpointSlack;
+                        }
+                    }
+
+                    lFirstDeadline = prvEDFSlackNextRelease( pxTCB, xNow ) + ( int32_t ) taskEDF_RELATIVE_DEADLINE( pxTCB );
+
+                    if( lFirstDeadline < lHorizon )
+                    {
+                        lCheckpointSlack = lFirstDeadline - prvEDFSlackDemand( lFirstDeadline, xNow );
+
+                        if( lCheckpointSlack < lSlack )
+                        {
+                            lSlack = lCheckpointSlack;
+                        }
+                    }
+                }
+            }
+
+            xSlack = ( lSlack > 0 ) ? ( TickType_t ) lSlack : ( TickType_t ) 0U;
+        }
+        else
+        {
+            /* No task has a known WCET, so nothing limits the slack. */
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xSlack;
+    }
+/*-----------------------------------------------------------*/
+
+    static TCB_t * prvEDFStealSlack( void )
+    {
+        TCB_t * pxTCB;
+        BaseType_t xRunAperiodicJob = pdFALSE;
+
+        if( listLIST_IS_EMPTY( &xAperiodicReadyList ) == pdFALSE )
+        {
+            if( listCURRENT_LIST_LENGTH( &pxReadyTasksLists ) <= ( UBaseType_t ) 1U )
+            {
+                /* Only the idle task is ready, so the job runs in the
+                 * background. */
+                xRunAperiodicJob = pdTRUE;
+            }
+            else if( xSlackStealingEnabled != pdFALSE )
+            {
+                /* The slack is only recomputed when a periodic job was released
+                 * or completed, otherwise the tick interrupt keeps it current. */
+                if( xSlackOutOfDate != pdFALSE )
+                {
+                    xAvailableSlack = prvEDFComputeSlack();
+                    xSlackOutOfDate = pdFALSE;
+                }
+
+                if( xAvailableSlack != ( TickType_t ) 0U )
+                {
+                    xRunAperiodicJob = pdTRUE;
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        if( xRunAperiodicJob != pdFALSE )
+        {
+            pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( &xAperiodicReadyList );
+        }
+        else
+        {
+            pxTCB = taskEDF_SELECT_EDF_TASK();
+        }
+
+        return pxTCB;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvEDFSlackTick( void )
+    {
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        /* A tick spent on periodic jobs leaves the slack unchanged.  Any other
+         * tick, including an idle one, uses up slack. */
+        if( pxCurrentTCB->xTaskWcet == ( TickType_t ) 0U )
+        {
+            if( xAvailableSlack != ( TickType_t ) 0U )
+            {
+                xAvailableSlack--;
+            }
+
+            if( ( pxCurrentTCB->xAperiodic != pdFALSE ) &&
+                ( listCURRENT_LIST_LENGTH( &pxReadyTasksLists ) > ( UBaseType_t ) 1U ) )
+            {
+                xAperiodicStats.ulSlackStolenTicks++;
+
+                /* The periodic jobs cannot be postponed any further. */
+                if( xAvailableSlack == ( TickType_t ) 0U )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+            }
+        }
+
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEDFAperiodicJobCompleted( TCB_t * pxTCB )
+    {
+        TickType_t xResponseTime;
+
+        if( pxTCB->xAperiodicJobPending != pdFALSE )
+        {
+            pxTCB->xAperiodicJobPending = pdFALSE;
+            xResponseTime = xTickCount - pxTCB->xAperiodicReleaseTime;
+
+            xAperiodicStats.ulCompletedJobs++;
+            xAperiodicStats.ulTotalResponseTime += ( uint32_t ) xResponseTime;
+
+            if( xResponseTime > xAperiodicStats.xMaxResponseTime )
+            {
+                xAperiodicStats.xMaxResponseTime = xResponseTime;
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskSetSlackStealing( BaseType_t xEnable )
+    {
+        taskENTER_CRITICAL();
+        {
+            xSlackStealingEnabled = xEnable;
+            xSlackOutOfDate = pdTRUE;
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskGetAperiodicStats( AperiodicStats_t * const pxStats,
+                                 BaseType_t xReset )
+    {
+        configASSERT( pxStats );
+
+        taskENTER_CRITICAL();
+        {
+            *pxStats = xAperiodicStats;
+
+            if( xReset != pdFALSE )
+            {
+                ( void ) memset( ( void * ) &xAperiodicStats, 0x00, sizeof( xAperiodicStats ) );
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_EDF_SLACK_STEALING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_FIRM_DEADLINES == 1 )
+
+    static UBaseType_t prvEDFFirmCountMet( uint32_t ulHistory,
+                                           UBaseType_t uxJobs )
+    {
+        UBaseType_t uxMet = 0;
+        UBaseType_t uxJob;
+
+        for( uxJob = 0; uxJob < uxJobs; uxJob++ )
+        {
+            if( ( ulHistory & ( 1UL << uxJob ) ) != 0UL )
+            {
+                uxMet++;
+            }
+        }
+
+        return uxMet;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvEDFFirmJobIsMandatory( const TCB_t * const pxTCB )
+    {
+        BaseType_t xMandatory = pdTRUE;
+
+        /* A job is optional if the previous k - 1 jobs alone still include m
+         * that met their deadline. */
+        if( pxTCB->uxFirmWindow != ( UBaseType_t ) 0U )
+        {
+            if( prvEDFFirmCountMet( pxTCB->ulFirmHistory, pxTCB->uxFirmWindow - ( UBaseType_t ) 1U ) >= pxTCB->uxFirmMandatory )
+            {
+                xMandatory = pdFALSE;
+            }
+        }
+
+        return xMandatory;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEDFFirmRecordJob( TCB_t * pxTCB,
+                                     BaseType_t xDeadlineMet,
+                                     BaseType_t xSkipped )
+    {
+        pxTCB->ulFirmHistory <<= 1;
+        pxTCB->ulFirmSkipHistory <<= 1;
+
+        if( xSkipped != pdFALSE )
+        {
+            pxTCB->ulFirmSkipHistory |= 1UL;
+            ( pxTCB->ulFirmSkippedJobs )++;
+        }
+        else if( xDeadlineMet != pdFALSE )
+        {
+            pxTCB->ulFirmHistory |= 1UL;
+            ( pxTCB->ulFirmMetJobs )++;
+        }
+        else
+        {
+            ( pxTCB->ulFirmMissedJobs )++;
+        }
+
+        if( ( pxTCB->uxFirmWindow != ( UBaseType_t ) 0U ) &&
+            ( prvEDFFirmCountMet( pxTCB->ulFirmHistory, pxTCB->uxFirmWindow ) < pxTCB->uxFirmMandatory ) )
+        {
+            ( pxTCB->ulFirmViolations )++;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvEDFFirmOverload( const TCB_t * const pxReleasedTCB,
+                                          TickType_t xConstTickCount )
+    {
+        const ListItem_t * pxListItem;
+        const ListItem_t * const pxEndMarker = listGET_END_MARKER( &pxReadyTasksLists );
+        const TickType_t xReleasedDeadline = listGET_LIST_ITEM_VALUE( &( pxReleasedTCB->xStateListItem ) );
+        TickType_t xDeadline;
+        TickType_t xDemand = ( TickType_t ) 0U;
+        BaseType_t xReleasedCounted = pdFALSE;
+        BaseType_t xOverload = pdFALSE;
+
+        /* The ready list is in deadline order, so the execution time that must
+         * complete before each deadline is a running sum.  The released job is
+         * counted at the position of its own deadline.  Jobs that already
+         * missed their deadline are not protected. */
+        for( pxListItem = listGET_HEAD_ENTRY( &pxReadyTasksLists ); ( pxListItem != pxEndMarker ) && ( xOverload == pdFALSE ); pxListItem = listGET_NEXT( pxListItem ) )
+        {
+            xDeadline = listGET_LIST_ITEM_VALUE( pxListItem );
+
+            if( ( xReleasedCounted == pdFALSE ) && ( xReleasedDeadline < xDeadline ) )
+            {
+                xReleasedCounted = pdTRUE;
+                xDemand += pxReleasedTCB->xTaskWcet;
+
+                if( xDemand > ( TickType_t ) ( xReleasedDeadline - xConstTickCount ) )
+                {
+                    xOverload = pdTRUE;
+                }
+            }
+
+            xDemand += ( TickType_t ) prvEDFGetRemainingJobTime( ( const TCB_t * ) listGET_LIST_ITEM_OWNER( pxListItem ) );
+
+            if( xDemand > ( TickType_t ) ( xDeadline - xConstTickCount ) )
+            {
+                xOverload = pdTRUE;
+            }
+        }
+
+        if( ( xOverload == pdFALSE ) && ( xReleasedCounted == pdFALSE ) )
+        {
+            xDemand += pxReleasedTCB->xTaskWcet;
+
+            if( xDemand > ( TickType_t ) ( xReleasedDeadline - xConstTickCount ) )
+            {
+                xOverload = pdTRUE;
+            }
+        }
+
+        return xOverload;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvEDFFirmSkipJob( TCB_t * pxTCB,
+                                         TickType_t xConstTickCount )
+    {
+        TickType_t * const pxWakeTime = pxTCB->pxFirmWakeTime;
+        TickType_t xTimeToWake;
+        BaseType_t xSkipped = pdFALSE;
+
+        pxTCB->pxFirmWakeTime = NULL;
+
+        /* Only a job released by xTaskDelayUntil() can be skipped, as the next
+         * release time of any other job is not known. */
+        if( ( pxWakeTime != NULL ) &&
+            ( prvEDFFirmJobIsMandatory( pxTCB ) == pdFALSE ) &&
+            ( prvEDFFirmOverload( pxTCB, xConstTickCount ) != pdFALSE ) )
+        {
+            /* The task stays blocked until the release of its next job, as if
+             * the skipped job had completed immediately. */
+            xTimeToWake = *pxWakeTime + pxTCB->xTaskPeriod;
+            *pxWakeTime = xTimeToWake;
+            pxTCB->pxFirmWakeTime = pxWakeTime;
+
+            prvEDFFirmRecordJob( pxTCB, pdFALSE, pdTRUE );
+            traceEDF_JOB_SKIPPED( pxTCB );
+
+            listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), xTimeToWake );
+
+            if( xTimeToWake < xConstTickCount )
+            {
+                /* Wake time has overflowed.  Place this item in the overflow
+                 * list. */
+                vListInsert( pxOverflowDelayedTaskList, &( pxTCB->xStateListItem ) );
+            }
+            else
+            {
+                vListInsert( pxDelayedTaskList, &( pxTCB->xStateListItem ) );
+            }
+
+            xSkipped = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xSkipped;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskGetFirmStatus( TaskHandle_t xTask,
+                                   FirmStatus_t * const pxFirmStatus )
+    {
+        const TCB_t * pxTCB;
+
+        configASSERT( pxFirmStatus );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+
+            pxFirmStatus->uxMandatory = pxTCB->uxFirmMandatory;
+            pxFirmStatus->uxWindow = pxTCB->uxFirmWindow;
+            pxFirmStatus->ulHistory = pxTCB->ulFirmHistory;
+            pxFirmStatus->ulSkipHistory = pxTCB->ulFirmSkipHistory;
+            pxFirmStatus->ulMetJobs = pxTCB->ulFirmMetJobs;
+            pxFirmStatus->ulMissedJobs = pxTCB->ulFirmMissedJobs;
+            pxFirmStatus->ulSkippedJobs = pxTCB->ulFirmSkippedJobs;
+            pxFirmStatus->ulViolations = pxTCB->ulFirmViolations;
+        }
+        taskEXIT_CRITICAL();
+
+        return pdPASS;
+    }
+
+#endif /* configUSE_EDF_FIRM_DEADLINES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_JOB_STATISTICS == 1 )
+
+    static void prvEDFRecordJobStatistics( TCB_t * pxTCB,
+                                           TickType_t xReleaseTime,
+                                           TickType_t xConstTickCount )
+    {
+        configRUN_TIME_COUNTER_TYPE ulNow;
+        uint32_t ulSinceTick;
+        int32_t lLateness;
+        const TickType_t xDeadline = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+
+        #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+            portALT_GET_RUN_TIME_COUNTER_VALUE( ulNow );
+        #else
+            ulNow = portGET_RUN_TIME_COUNTER_VALUE();
+        #endif
+
+        /* Times are whole ticks plus the part of the current tick that has
+         * passed, so no division is needed. */
+        ulSinceTick = ( uint32_t ) ( ulNow - ulTickRunTime );
+
+        vHistogramRecord( &( pxTCB->xJobResponseTimes ), ( ( uint32_t ) ( xConstTickCount - xReleaseTime ) * ( uint32_t ) configEDF_RUN_TIME_COUNTS_PER_TICK ) + ulSinceTick );
+
+        /* LO criticality jobs degraded to background execution have no
+         * deadline. */
+        if( xDeadline != portMAX_DELAY )
+        {
+            lLateness = ( ( int32_t ) ( xConstTickCount - xDeadline ) * ( int32_t ) configEDF_RUN_TIME_COUNTS_PER_TICK ) + ( int32_t ) ulSinceTick;
+
+            if( ( pxTCB->xJobTardiness.ulCount == 0UL ) || ( lLateness < pxTCB->lJobMinLateness ) )
+            {
+                pxTCB->lJobMinLateness = lLateness;
+            }
+
+            if( ( pxTCB->xJobTardiness.ulCount == 0UL ) || ( lLateness > pxTCB->lJobMaxLateness ) )
+            {
+                pxTCB->lJobMaxLateness = lLateness;
+            }
+
+            pxTCB->llJobTotalLateness += lLateness;
+            vHistogramRecord( &( pxTCB->xJobTardiness ), ( lLateness > 0L ) ? ( uint32_t ) lLateness : 0UL );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskGetJobStatistics( TaskHandle_t xTask,
+                                      JobStatistics_t * const pxJobStatistics )
+    {
+        const TCB_t * pxTCB;
+        uint32_t ulJobs;
+
+        configASSERT( pxJobStatistics );
+
+        /* Jobs are only recorded by tasks, with the scheduler suspended, so
+         * the percentiles are computed without masking interrupts. */
+        vTaskSuspendAll();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            ulJobs = pxTCB->xJobTardiness.ulCount;
+
+            vHistogramGetSummary( &( pxTCB->xJobResponseTimes ), &( pxJobStatistics->xResponseTime ) );
+            vHistogramGetSummary( &( pxTCB->xJobTardiness ), &( pxJobStatistics->xTardiness ) );
+
+            /* Jobs that met their deadline are all in the first bucket. */
+            pxJobStatistics->ulMissedDeadlines = ulJobs - pxTCB->xJobTardiness.aulBuckets[ 0 ];
+            pxJobStatistics->lMinLateness = pxTCB->lJobMinLateness;
+            pxJobStatistics->lMaxLateness = pxTCB->lJobMaxLateness;
+            pxJobStatistics->lMeanLateness = ( ulJobs == 0UL ) ? 0L : ( int32_t ) ( pxTCB->llJobTotalLateness / ( int64_t ) ulJobs );
+        }
+        ( void ) xTaskResumeAll();
+
+        return pdPASS;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskResetJobStatistics( TaskHandle_t xTask )
+    {
+        TCB_t * pxTCB;
+
+        vTaskSuspendAll();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+
+            vHistogramReset( &( pxTCB->xJobResponseTimes ) );
+            vHistogramReset( &( pxTCB->xJobTardiness ) );
+            pxTCB->lJobMinLateness = 0L;
+            pxTCB->lJobMaxLateness = 0L;
+            pxTCB->llJobTotalLateness = 0LL;
+        }
+        ( void ) xTaskResumeAll();
+    }
+
+#endif /* configUSE_EDF_JOB_STATISTICS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SNAPSHOT == 1 )
+
+    UBaseType_t uxTaskGetSnapshot( SystemSnapshot_t * const pxSnapshot,
+                                   TaskSnapshot_t * const pxTaskSnapshots,
+                                   const UBaseType_t uxArraySize )
+    {
+        const TCB_t * pxTCB;
+        TaskSnapshot_t xRecord;
+        TaskSnapshot_t * pxRecord;
+        List_t const * pxStateList;
+        eTaskState eState;
+        UBaseType_t uxTask = ( UBaseType_t ) 0U;
+        uint32_t ulChanged = 0UL;
+
+        configASSERT( pxSnapshot );
+        configASSERT( pxTaskSnapshots );
+
+        /* The tick is held pending, so no task changes list while the
+         * periodic task list is visited. */
+        vTaskSuspendAll();
+        {
+            if( uxArraySize >= uxCurrentNumberOfTasks )
+            {
+                for( pxTCB = pxPeriodicTaskList; pxTCB != NULL; pxTCB = pxTCB->pxNextPeriodicTCB )
+                {
+                    eState = eTaskGetState( ( TaskHandle_t ) pxTCB );
+                    pxStateList = listLIST_ITEM_CONTAINER( &( pxTCB->xStateListItem ) );
+
+                    xRecord.ulTaskNumber = ( uint32_t ) pxTCB->uxTCBNumber;
+                    xRecord.ulState = ( uint32_t ) eState;
+                    xRecord.ulPeriod = ( uint32_t ) pxTCB->xTaskPeriod;
+                    xRecord.ulDeadline = ( ( eState == eRunning ) || ( eState == eReady ) ) ? ( uint32_t ) listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) ) : 0UL;
+                    xRecord.ulWakeTime = ( ( pxStateList == pxDelayedTaskList ) || ( pxStateList == pxOverflowDelayedTaskList ) ) ? ( uint32_t ) listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) ) : 0UL;
+                    xRecord.ulMissedDeadlines = pxTCB->ulMissedDeadlines;
+
+                    #if ( configGENERATE_RUN_TIME_STATS == 1 )
+                        xRecord.ulRunTime = ( uint32_t ) pxTCB->ulRunTimeCounter;
+                    #else
+                        xRecord.ulRunTime = 0UL;
+                    #endif
+
+                    /* Compare with the previous record without its flag. */
+                    pxRecord = &( pxTaskSnapshots[ uxTask ] );
+                    pxRecord->ulState &= taskSNAPSHOT_STATE_MASK;
+
+                    if( memcmp( ( void * ) pxRecord, ( void * ) &xRecord, sizeof( TaskSnapshot_t ) ) != 0 )
+                    {
+                        xRecord.ulState |= taskSNAPSHOT_CHANGED;
+                        ulChanged++;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    *pxRecord = xRecord;
+                    uxTask++;
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxSnapshot->ulMagic = taskSNAPSHOT_MAGIC;
+            pxSnapshot->ulSequence++;
+            pxSnapshot->ulTickCount = ( uint32_t ) xTickCount;
+            pxSnapshot->ulTasks = ( uint32_t ) uxTask;
+            pxSnapshot->ulChangedTasks = ulChanged;
+
+            #if ( configGENERATE_RUN_TIME_STATS == 1 )
+                #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                    portALT_GET_RUN_TIME_COUNTER_VALUE( pxSnapshot->ulRunTime );
+                #else
+                    pxSnapshot->ulRunTime = ( uint32_t ) portGET_RUN_TIME_COUNTER_VALUE();
+                #endif
+            #else
+                pxSnapshot->ulRunTime = 0UL;
+            #endif
+        }
+        ( void ) xTaskResumeAll();
+
+        return uxTask;
+    }
+
+#endif /* configUSE_EDF_SNAPSHOT */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_PRECEDENCE == 1 )
+
+    static void prvEDFUpdatePrecedenceDeadlines( void )
+    {
+        TCB_t * pxTCB;
+        const TCB_t * pxSuccessor;
+        TickType_t xLimit;
+        BaseType_t xChanged;
+
+        for( pxTCB = pxPeriodicTaskList; pxTCB != NULL; pxTCB = pxTCB->pxNextPeriodicTCB )
+        {
+            pxTCB->xPrecedenceLimit = portMAX_DELAY;
+        }
+
+        /* Each pass moves the limits one more task up every chain, so the loop
+         * ends after as many passes as the longest chain has tasks. */
+        do
+        {
+            xChanged = pdFALSE;
+
+            for( pxTCB = pxPeriodicTaskList; pxTCB != NULL; pxTCB = pxTCB->pxNextPeriodicTCB )
+            {
+                pxSuccessor = pxTCB->pxPrecedenceSuccessor;
+
+                if( pxSuccessor != NULL )
+                {
+                    /* The job of the successor has to complete within both the
+                     * end-to-end deadline and its own limit. */
+                    xLimit = ( pxSuccessor->xPrecedenceLimit < pxTCB->xPrecedenceWindow ) ? pxSuccessor->xPrecedenceLimit : pxTCB->xPrecedenceWindow;
+                    xLimit = ( xLimit > pxSuccessor->xTaskWcet ) ? ( xLimit - pxSuccessor->xTaskWcet ) : ( TickType_t ) 0U;
+
+                    if( xLimit != pxTCB->xPrecedenceLimit )
+                    {
+                        pxTCB->xPrecedenceLimit = xLimit;
+                        xChanged = pdTRUE;
+                    }
+                }
+            }
+        } while( xChanged != pdFALSE );
+
+        for( pxTCB = pxPeriodicTaskList; pxTCB != NULL; pxTCB = pxTCB->pxNextPeriodicTCB )
+        {
+            pxTCB->xTaskRelativeDeadline = ( pxTCB->xPrecedenceLimit < pxTCB->xTaskDeadline ) ? pxTCB->xPrecedenceLimit : pxTCB->xTaskDeadline;
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEDFPrecedenceRelease( TCB_t * pxTCB,
+                                         const TCB_t * const pxSender )
+    {
+        const TCB_t * const pxPredecessor = pxSender;
+        TickType_t xWindow;
+
+        if( pxPredecessor->pxPrecedenceSuccessor == pxTCB )
+        {
+            /* The job belongs to the same chain as the sending job, so both
+             * share a release time and the successor only has to complete by
+             * the end-to-end deadline. */
+            xWindow = ( pxTCB->xPrecedenceLimit < pxPredecessor->xPrecedenceWindow ) ? pxTCB->xPrecedenceLimit : pxPredecessor->xPrecedenceWindow;
+
+            prvEDFJobReleased( pxTCB, pxPredecessor->xTaskReleaseTime );
+            listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), pxPredecessor->xTaskReleaseTime + xWindow );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskAddPrecedence( TaskHandle_t xPredecessor,
+                                   TaskHandle_t xSuccessor,
+                                   TickType_t xEndToEndDeadline )
+    {
+        TCB_t * const pxPredecessor = xPredecessor;
+        TCB_t * const pxSuccessor = xSuccessor;
+        const TCB_t * pxTCB;
+        BaseType_t xReturn = pdPASS;
+
+        configASSERT( pxPredecessor );
+        configASSERT( pxSuccessor );
+
+        vTaskSuspendAll();
+        {
+            if( pxPredecessor->pxPrecedenceSuccessor != NULL )
+            {
+                xReturn = pdFAIL;
+            }
+            else
+            {
+                /* The edge closes a cycle if the predecessor can already be
+                 * reached from the successor. */
+                for( pxTCB = pxSuccessor; pxTCB != NULL; pxTCB = pxTCB->pxPrecedenceSuccessor )
+                {
+                    if( pxTCB == pxPredecessor )
+                    {
+                        xReturn = pdFAIL;
+                        break;
+                    }
+                }
+            }
+
+            if( xReturn == pdPASS )
+            {
+                pxPredecessor->pxPrecedenceSuccessor = pxSuccessor;
+                pxPredecessor->xPrecedenceWindow = xEndToEndDeadline;
+                prvEDFUpdatePrecedenceDeadlines();
+
+                for( pxTCB = pxPeriodicTaskList; pxTCB != NULL; pxTCB = pxTCB->pxNextPeriodicTCB )
+                {
+                    if( pxTCB->xTaskRelativeDeadline < pxTCB->xTaskWcet )
+                    {
+                        xReturn = errTASK_SET_NOT_SCHEDULABLE;
+                        break;
+                    }
+                }
+
+                #if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+                    /* Shorter deadlines add demand to short intervals. */
+                    if( ( xReturn == pdPASS ) && ( prvEDFTaskSetFeasible( NULL ) != pdPASS ) )
+                    {
+                        xReturn = errTASK_SET_NOT_SCHEDULABLE;
+                    }
+                #endif
+
+                if( xReturn != pdPASS )
+                {
+                    pxPredecessor->pxPrecedenceSuccessor = NULL;
+                    prvEDFUpdatePrecedenceDeadlines();
+                }
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        return xReturn;
+    }
+
+#endif /* configUSE_EDF_PRECEDENCE */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_TIMERS == 1 )
+
+    static void prvEDFApplyWakeDeadline( TCB_t * pxTCB )
+    {
+        const TickType_t xConstTickCount = xTickCount;
+
+        if( pxTCB->xTaskWakeDeadline != portMAX_DELAY )
+        {
+            /* Compared relative to now so tick count overflows do not matter.
+             * A deadline that has passed is treated as being too far away. */
+            if( ( TickType_t ) ( pxTCB->xTaskWakeDeadline - xConstTickCount ) < pxTCB->xTaskPeriod )
+            {
+                listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), pxTCB->xTaskWakeDeadline );
+            }
+            else
+            {
+                listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), xConstTickCount + taskEDF_RELATIVE_DEADLINE( pxTCB ) );
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskSetDeadline( TickType_t xDeadline )
+    {
+        List_t * pxReadyList;
+
+        taskENTER_CRITICAL();
+        {
+            /* The running task is ready, so only its position within its
+             * ready list changes. */
+            pxReadyList = listLIST_ITEM_CONTAINER( &( pxCurrentTCB->xStateListItem ) );
+            ( void ) uxListRemove( &( pxCurrentTCB->xStateListItem ) );
+            listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xDeadline );
+            vListInsert( pxReadyList, &( pxCurrentTCB->xStateListItem ) );
+
+            #if ( configUSE_EDF_SLACK_STEALING == 1 )
+                xSlackOutOfDate = pdTRUE;
+            #endif
+        }
+        taskEXIT_CRITICAL();
+
+        /* Let the scheduler pick the job with the earliest deadline again. */
+        taskYIELD_IF_USING_PREEMPTION();
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskSetWakeDeadline( TickType_t xDeadline )
+    {
+        taskENTER_CRITICAL();
+        {
+            pxCurrentTCB->xTaskWakeDeadline = xDeadline;
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_EDF_TIMERS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_DEFERRED_INTERRUPTS == 1 )
+
+    static void prvEDFApplyDeferredDeadline( TCB_t * pxTCB )
+    {
+        if( pxTCB->xTaskDeferredDeadline != portMAX_DELAY )
+        {
+            /* The job was released when the interrupt occurred, even if the
+             * scheduler was suspended until later. */
+            #if ( tskEDF_TRACK_JOBS == 1 )
+                prvEDFJobReleased( pxTCB, pxTCB->xTaskDeferredRelease );
+            #endif
+
+            listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), pxTCB->xTaskDeferredDeadline );
+            pxTCB->xTaskDeferredDeadline = portMAX_DELAY;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskDeferFromISR( TaskHandle_t xHandler,
+                                  uint32_t ulEventBits,
+                                  TickType_t xRelativeDeadline,
+                                  BaseType_t * pxHigherPriorityTaskWoken )
+    {
+        TCB_t * const pxTCB = xHandler;
+        TickType_t xDeadline, xHandlerDeadline;
+        BaseType_t xReturn;
+        uint8_t ucOriginalNotifyState;
+        UBaseType_t uxSavedInterruptStatus;
+
+        configASSERT( pxTCB );
+
+        /* See the comment in xTaskGenericNotifyFromISR(). */
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        /* The deadline is compared against the jobs in the EDF ready list
+         * only. */
+        #if ( configUSE_EDF_SERVERS == 1 )
+            configASSERT( pxTCB->pxServer == NULL );
+        #endif
+
+        #if ( configUSE_EDF_SLACK_STEALING == 1 )
+            configASSERT( pxTCB->xAperiodic == pdFALSE );
+        #endif
+
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            xDeadline = xTickCount + xRelativeDeadline;
+
+            if( pxTCB->ucNotifyState[ tskDEFAULT_INDEX_TO_NOTIFY ] == taskWAITING_NOTIFICATION )
+            {
+                /* The notification below readies the handler, and the job it
+                 * releases takes this deadline either straight away or when
+                 * the scheduler is resumed. */
+                pxTCB->xTaskDeferredDeadline = xDeadline;
+                pxTCB->xTaskDeferredRelease = xTickCount;
+            }
+            else if( pxTCB->xTaskDeferredDeadline != portMAX_DELAY )
+            {
+                /* An earlier interrupt readied the handler while the scheduler
+                 * was suspended and the job is still waiting to be released. */
+                if( xDeadline < pxTCB->xTaskDeferredDeadline )
+                {
+                    pxTCB->xTaskDeferredDeadline = xDeadline;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else if( ( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE ) &&
+                     ( listIS_CONTAINED_WITHIN( &pxReadyTasksLists, &( pxTCB->xStateListItem ) ) != pdFALSE ) )
+            {
+                /* The ready job handles this event too, so it must not finish
+                 * later than the event requires. */
+                if( xDeadline < listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) ) )
+                {
+                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                    listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), xDeadline );
+                    vListInsert( &pxReadyTasksLists, &( pxTCB->xStateListItem ) );
+
+                    #if ( configUSE_EDF_SLACK_STEALING == 1 )
+                        xSlackOutOfDate = pdTRUE;
+                    #endif
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                /* The handler is blocked on something other than its
+                 * notification, so the event is picked up by the job that is
+                 * already in progress. */
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* Notified here rather than by xTaskGenericNotifyFromISR(), which
+             * would request a switch from the task priorities.  The switch is
+             * decided from the deadlines below. */
+            ucOriginalNotifyState = pxTCB->ucNotifyState[ tskDEFAULT_INDEX_TO_NOTIFY ];
+            pxTCB->ucNotifyState[ tskDEFAULT_INDEX_TO_NOTIFY ] = taskNOTIFICATION_RECEIVED;
+            pxTCB->ulNotifiedValue[ tskDEFAULT_INDEX_TO_NOTIFY ] |= ulEventBits;
+            xReturn = pdPASS;
+
+            traceTASK_NOTIFY_FROM_ISR( tskDEFAULT_INDEX_TO_NOTIFY );
+
+            if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
+            {
+                /* The task should not have been on an event list. */
+                configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+
+                if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+                {
+                    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+                    prvEDFApplyDeferredDeadline( pxTCB );
+                    prvAddTaskToReadyList( pxTCB );
+                }
+                else
+                {
+                    /* The delayed and ready lists cannot be accessed, so hold
+                     * this task pending until the scheduler is resumed. */
+                    listINSERT_END( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( listIS_CONTAINED_WITHIN( &pxReadyTasksLists, &( pxTCB->xStateListItem ) ) != pdFALSE )
+            {
+                xHandlerDeadline = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+            }
+            else
+            {
+                /* portMAX_DELAY if the handler is not ready at all. */
+                xHandlerDeadline = pxTCB->xTaskDeferredDeadline;
+            }
+
+            if( xHandlerDeadline < listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ) ) )
+            {
+                /* The handler's job is now at the head of the ready list. */
+                if( pxHigherPriorityTaskWoken != NULL )
+                {
+                    *pxHigherPriorityTaskWoken = pdTRUE;
+                }
+
+                /* Mark that a yield is pending in case the user is not
+                 * using the "xHigherPriorityTaskWoken" parameter. */
+                xYieldPending = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_EDF_DEFERRED_INTERRUPTS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SERVERS == 1 ) || ( configUSE_EDF_SLACK_STEALING == 1 )
+
+    static List_t * prvEDFGetReadyList( const TCB_t * const pxTCB )
+    {
+        List_t * pxReadyList = &( pxReadyTasksLists );
+
+        #if ( configUSE_EDF_SERVERS == 1 )
+            if( pxTCB->pxServer != NULL )
+            {
+                pxReadyList = &( pxTCB->pxServer->xReadyTasksList );
+            }
+        #endif
+
+        #if ( configUSE_EDF_SLACK_STEALING == 1 )
+            if( pxTCB->xAperiodic != pdFALSE )
+            {
+                pxReadyList = &xAperiodicReadyList;
+            }
+        #endif
+
+        return pxReadyList;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvEDFInsertReadyTask( TCB_t * pxTCB )
+    {
+        #if ( configUSE_EDF_SERVERS == 1 )
+            EDFServer_t * const pxServer = pxTCB->pxServer;
+
+            if( pxServer != NULL )
+            {
+                #if ( configUSE_EDF_RECLAIMING == 1 )
+                    if( pxServer->xReclaimActive == pdFALSE )
+                    {
+                        pxServer->xReclaimActive = pdTRUE;
+                        ulActiveUtilisation += taskEDF_UTILISATION( pxServer->xBudget, pxServer->xPeriod );
+                    }
+                #endif
+
+                /* CBS wake-up rule - a server that becomes backlogged once its
+                 * remaining budget can no longer be consumed at the reserved
+                 * rate by its deadline starts a new period.  Otherwise it could
+                 * run the budget it kept while idle shortly before its
+                 * deadline, more than its bandwidth allows. */
+                if( ( listLIST_IS_EMPTY( &( pxServer->xReadyTasksList ) ) != pdFALSE ) &&
+                    ( prvEDFServerZeroLagReached( pxServer, xTickCount ) != pdFALSE ) )
+                {
+                    if( listIS_CONTAINED_WITHIN( &xEDFServerReadyList, &( pxServer->xServerListItem ) ) != pdFALSE )
+                    {
+                        ( void ) uxListRemove( &( pxServer->xServerListItem ) );
+                    }
+
+                    pxServer->xRemainingBudget = pxServer->xBudget;
+                    pxServer->xNextReplenishTime = xTickCount + pxServer->xPeriod;
+                    listSET_LIST_ITEM_VALUE( &( pxServer->xServerListItem ), pxServer->xNextReplenishTime );
+
+                    #if ( configUSE_EDF_RECLAIMING == 1 )
+                        pxServer->ulBudgetCharge = 0UL;
+                    #endif
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                if( pxServer->ePolicy == eServerPolicyFIFO )
+                {
+                    vListInsertEnd( &( pxServer->xReadyTasksList ), &( pxTCB->xStateListItem ) );
+                }
+                else
+                {
+                    vListInsert( &( pxServer->xReadyTasksList ), &( pxTCB->xStateListItem ) );
+                }
+
+                /* A server with budget left competes for the processor as soon
+                 * as one of its tasks is ready. */
+                if( ( pxServer->xRemainingBudget != ( TickType_t ) 0U ) &&
+                    ( listIS_CONTAINED_WITHIN( &xEDFServerReadyList, &( pxServer->xServerListItem ) ) == pdFALSE ) )
+                {
+                    vListInsert( &xEDFServerReadyList, &( pxServer->xServerListItem ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+        #endif /* configUSE_EDF_SERVERS */
+
+        #if ( configUSE_EDF_SLACK_STEALING == 1 )
+            if( pxTCB->xAperiodic != pdFALSE )
+            {
+                /* The job is released when the task becomes ready, unless it
+                 * was only preempted or its priority changed. */
+                if( pxTCB->xAperiodicJobPending == pdFALSE )
+                {
+                    pxTCB->xAperiodicJobPending = pdTRUE;
+                    pxTCB->xAperiodicReleaseTime = xTickCount;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* Aperiodic jobs have no deadline and are served in release
+                 * order.  The scheduler decides at the next context switch
+                 * whether there is slack to run the job. */
+                listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), portMAX_DELAY );
+                vListInsertEnd( &xAperiodicReadyList, &( pxTCB->xStateListItem ) );
+                xYieldPending = pdTRUE;
+            }
+            else
+        #endif /* configUSE_EDF_SLACK_STEALING */
+        {
+            vListInsert( &( pxReadyTasksLists ), &( pxTCB->xStateListItem ) );
+
+            #if ( configUSE_EDF_RECLAIMING == 1 )
+                prvEDFReclaimTaskActivate( pxTCB );
+            #endif
+        }
+    }
+
+#endif /* ( configUSE_EDF_SERVERS == 1 ) || ( configUSE_EDF_SLACK_STEALING == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SERVERS == 1 )
+
+    static TCB_t * prvEDFSelectServerOrTask( void )
+    {
+        TCB_t * pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( &pxReadyTasksLists );
+        EDFServer_t * pxServer = NULL;
+
+        /* Tasks leave a server's ready list without the server being told, so
+         * drop servers that no longer have a ready task here. */
+        while( listLIST_IS_EMPTY( &xEDFServerReadyList ) == pdFALSE )
+        {
+            pxServer = ( EDFServer_t * ) listGET_OWNER_OF_HEAD_ENTRY( &xEDFServerReadyList );
+
+            if( listLIST_IS_EMPTY( &( pxServer->xReadyTasksList ) ) != pdFALSE )
+            {
+                ( void ) uxListRemove( &( pxServer->xServerListItem ) );
+                pxServer = NULL;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        /* The earliest deadline server competes with the earliest deadline
+         * task that is not attached to a server.  The idle task only runs when
+         * no server is eligible. */
+        if( pxServer != NULL )
+        {
+            if( ( pxTCB == ( TCB_t * ) xIdleTaskHandle ) ||
+                ( listGET_LIST_ITEM_VALUE( &( pxServer->xServerListItem ) ) < listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) ) ) )
+            {
+                pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( &( pxServer->xReadyTasksList ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return pxTCB;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvEDFServerTick( TickType_t xConstTickCount )
+    {
+        BaseType_t xSwitchRequired = pdFALSE;
+        EDFServer_t * pxServer = pxCurrentTCB->pxServer;
+
+        /* Charge the tick to the server of the task that was running. */
+        if( ( pxServer != NULL ) && ( pxServer->xRemainingBudget != ( TickType_t ) 0U ) )
+        {
+            #if ( configUSE_EDF_RECLAIMING == 1 )
+                {
+                    /* GRUB - the budget is depleted at the rate of the active
+                     * utilisation rather than 1, so the server runs in the
+                     * bandwidth left unused by inactive tasks and servers. */
+                    pxServer->ulBudgetCharge += ( ulActiveUtilisation < taskEDF_UTILISATION_SCALE ) ? ulActiveUtilisation : taskEDF_UTILISATION_SCALE;
+
+                    if( pxServer->ulBudgetCharge >= taskEDF_UTILISATION_SCALE )
+                    {
+                        pxServer->ulBudgetCharge -= taskEDF_UTILISATION_SCALE;
+                        ( pxServer->xRemainingBudget )--;
+                    }
+                    else
+                    {
+                        ( pxServer->ulReclaimedTicks )++;
+                    }
+                }
+            #else
+                {
+                    ( pxServer->xRemainingBudget )--;
+                }
+            #endif /* configUSE_EDF_RECLAIMING */
+
+            if( pxServer->xRemainingBudget == ( TickType_t ) 0U )
+            {
+                /* The server is throttled until its next replenishment. */
+                if( listIS_CONTAINED_WITHIN( &xEDFServerReadyList, &( pxServer->xServerListItem ) ) != pdFALSE )
+                {
+                    ( void ) uxListRemove( &( pxServer->xServerListItem ) );
+                }
+
+                ( pxServer->ulBudgetExhaustedCount )++;
+                xSwitchRequired = pdTRUE;
+            }
+        }
+
+        /* The full budget is restored when the deadline of a server is
+         * reached and the deadline moves one period later.  A server that
+         * exhausted its budget is throttled until then. */
+        for( pxServer = pxServerList; pxServer != NULL; pxServer = pxServer->pxNextServer )
+        {
+            #if ( configUSE_EDF_RECLAIMING == 1 )
+                {
+                    /* A server without ready tasks stops counting as active at
+                     * its 0-lag time - the time at which its remaining budget,
+                     * consumed at the reserved rate, would run out by its
+                     * deadline.  This is the time after which the CBS
+                     * wake-up rule gives it a new deadline, so a server
+                     * woken before it is still active and keeps its deadline
+                     * and budget. */
+                    if( ( pxServer->xReclaimActive != pdFALSE ) && ( listLIST_IS_EMPTY( &( pxServer->xReadyTasksList ) ) != pdFALSE ) )
+                    {
+                        if( prvEDFServerZeroLagReached( pxServer, xConstTickCount ) != pdFALSE )
+                        {
+                            pxServer->xReclaimActive = pdFALSE;
+                            ulActiveUtilisation -= taskEDF_UTILISATION( pxServer->xBudget, pxServer->xPeriod );
+                        }
+                    }
+                }
+            #endif /* configUSE_EDF_RECLAIMING */
+
+            if( xConstTickCount == pxServer->xNextReplenishTime )
+            {
+                pxServer->xRemainingBudget = pxServer->xBudget;
+
+                #if ( configUSE_EDF_RECLAIMING == 1 )
+                    pxServer->ulBudgetCharge = 0UL;
+                #endif
+
+                pxServer->xNextReplenishTime = xConstTickCount + pxServer->xPeriod;
+
+                if( listIS_CONTAINED_WITHIN( &xEDFServerReadyList, &( pxServer->xServerListItem ) ) != pdFALSE )
+                {
+                    ( void ) uxListRemove( &( pxServer->xServerListItem ) );
+                }
+
+                listSET_LIST_ITEM_VALUE( &( pxServer->xServerListItem ), pxServer->xNextReplenishTime );
+
+                if( listLIST_IS_EMPTY( &( pxServer->xReadyTasksList ) ) == pdFALSE )
+                {
+                    vListInsert( &xEDFServerReadyList, &( pxServer->xServerListItem ) );
+                    xSwitchRequired = pdTRUE;
+                }
+            }
+        }
+
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvEDFServerZeroLagReached( const EDFServer_t * const pxServer,
+                                                  TickType_t xTime )
+    {
+        BaseType_t xReturn = pdFALSE;
+        const TickType_t xTimeToDeadline = pxServer->xNextReplenishTime - xTime;
+
+        /* The deadline is at most one period ahead unless it already passed.
+         * Otherwise the 0-lag time, xDeadline - q * P / Q, is reached when
+         * q * P >= ( xDeadline - xTime ) * Q. */
+        if( xTimeToDeadline > pxServer->xPeriod )
+        {
+            xReturn = pdTRUE;
+        }
+        else if( ( ( uint64_t ) pxServer->xRemainingBudget * ( uint64_t ) pxServer->xPeriod ) >= ( ( uint64_t ) xTimeToDeadline * ( uint64_t ) pxServer->xBudget ) )
+        {
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    ServerHandle_t xTaskCreateServer( const char * const pcName,
+                                      TickType_t xBudget,
+                                      TickType_t xPeriod,
+                                      eServerPolicy ePolicy )
+    {
+        EDFServer_t * pxServer = NULL;
+
+        configASSERT( xPeriod > ( TickType_t ) 0U );
+        configASSERT( ( xBudget > ( TickType_t ) 0U ) && ( xBudget <= xPeriod ) );
+
+        #if ( configUSE_EDF_ADMISSION_CONTROL == 1 )
+            {
+                BaseType_t xFeasible;
+                EDFAnalysisTask_t xCandidate;
+
+                /* The CBS rules keep the demand of a server within that of a
+                 * periodic task with the budget as WCET and the server period
+                 * as period and deadline, so the server is analysed as one next
+                 * to the periodic tasks that are not attached to a server. */
+                xCandidate.ulPeriod = ( uint32_t ) xPeriod;
+                xCandidate.ulDeadline = ( uint32_t ) xPeriod;
+                xCandidate.ulWcet = ( uint32_t ) xBudget;
+                xCandidate.ulNonPreemptive = 0UL;
+                xCandidate.ulPreemptionThreshold = 0UL;
+
+                vTaskSuspendAll();
+                {
+                    xFeasible = prvEDFTaskSetFeasible( &xCandidate );
+                }
+                ( void ) xTaskResumeAll();
+
+                if( xFeasible != pdPASS )
+                {
+                    return NULL;
+                }
+            }
+        #endif /* configUSE_EDF_ADMISSION_CONTROL */
+
+        pxServer = ( EDFServer_t * ) pvPortMalloc( sizeof( EDFServer_t ) );
+
+        if( pxServer != NULL )
+        {
+            vListInitialise( &( pxServer->xReadyTasksList ) );
+            vListInitialiseItem( &( pxServer->xServerListItem ) );
+            listSET_LIST_ITEM_OWNER( &( pxServer->xServerListItem ), pxServer );
+
+            pxServer->pcServerName = pcName;
+            pxServer->ePolicy = ePolicy;
+            pxServer->xBudget = xBudget;
+            pxServer->xPeriod = xPeriod;
+            pxServer->ulBudgetExhaustedCount = 0UL;
+
+            #if ( configUSE_EDF_RECLAIMING == 1 )
+                pxServer->xReclaimActive = pdFALSE;
+                pxServer->ulBudgetCharge = 0UL;
+                pxServer->ulReclaimedTicks = 0UL;
+            #endif
+
+            taskENTER_CRITICAL();
+            {
+                /* The server list is not reset when the first task is created,
+                 * so servers can be created before or after tasks. */
+                if( listLIST_IS_INITIALISED( &xEDFServerReadyList ) == pdFALSE )
+                {
+                    vListInitialise( &xEDFServerReadyList );
+                }
+
+                pxServer->xRemainingBudget = xBudget;
+                pxServer->xNextReplenishTime = xTickCount + xPeriod;
+                listSET_LIST_ITEM_VALUE( &( pxServer->xServerListItem ), pxServer->xNextReplenishTime );
+
+                pxServer->pxNextServer = pxServerList;
+                pxServerList = pxServer;
+            }
+            taskEXIT_CRITICAL();
+        }
+
+        return pxServer;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskAttachToServer( TaskHandle_t xTask,
+                                    ServerHandle_t xServer )
+    {
+        TCB_t * const pxTCB = prvGetTCBFromHandle( xTask );
+        BaseType_t xWasReady;
+
+        /* The idle task must always be able to run. */
+        configASSERT( pxTCB != ( TCB_t * ) xIdleTaskHandle );
+
+        taskENTER_CRITICAL();
+        {
+            /* Move a ready task to the ready list of its new server. */
+            xWasReady = taskEDF_IS_READY( pxTCB );
+
+            if( xWasReady != pdFALSE )
+            {
+                ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+            }
+
+            #if ( configUSE_EDF_RECLAIMING == 1 )
+                {
+                    /* The bandwidth of a task attached to a server is part of
+                     * that of the server. */
+                    prvEDFReclaimTaskDeactivate( pxTCB );
+                }
+            #endif
+
+            pxTCB->pxServer = xServer;
+
+            if( xWasReady != pdFALSE )
+            {
+                prvAddTaskToReadyList( pxTCB );
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xSchedulerRunning != pdFALSE )
+        {
+            taskYIELD_IF_USING_PREEMPTION();
+        }
+
+        return pdPASS;
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TRACE_FACILITY == 1 )
+
+        UBaseType_t uxTaskGetServerState( ServerStatus_t * const pxServerStatusArray,
+                                          const UBaseType_t uxArraySize )
+        {
+            UBaseType_t uxServer = 0;
+            const EDFServer_t * pxServer;
+
+            vTaskSuspendAll();
+            {
+                for( pxServer = pxServerList; ( pxServer != NULL ) && ( uxServer < uxArraySize ); pxServer = pxServer->pxNextServer )
+                {
+                    pxServerStatusArray[ uxServer ].xHandle = ( ServerHandle_t ) pxServer;
+                    pxServerStatusArray[ uxServer ].pcServerName = pxServer->pcServerName;
+                    pxServerStatusArray[ uxServer ].ePolicy = pxServer->ePolicy;
+                    pxServerStatusArray[ uxServer ].xBudget = pxServer->xBudget;
+                    pxServerStatusArray[ uxServer ].xPeriod = pxServer->xPeriod;
+                    pxServerStatusArray[ uxServer ].xRemainingBudget = pxServer->xRemainingBudget;
+                    pxServerStatusArray[ uxServer ].xDeadline = listGET_LIST_ITEM_VALUE( &( pxServer->xServerListItem ) );
+                    pxServerStatusArray[ uxServer ].uxReadyTasks = listCURRENT_LIST_LENGTH( &( pxServer->xReadyTasksList ) );
+                    pxServerStatusArray[ uxServer ].ulBudgetExhaustedCount = pxServer->ulBudgetExhaustedCount;
+
+                    #if ( configUSE_EDF_RECLAIMING == 1 )
+                        pxServerStatusArray[ uxServer ].ulReclaimedTicks = pxServer->ulReclaimedTicks;
+                    #else
+                        pxServerStatusArray[ uxServer ].ulReclaimedTicks = 0UL;
+                    #endif
+
+                    uxServer++;
+                }
+            }
+            ( void ) xTaskResumeAll();
+
+            return uxServer;
+        }
+
+    #endif /* configUSE_TRACE_FACILITY */
+
+#endif /* configUSE_EDF_SERVERS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SHARED_STACK == 1 )
+
+    static portTASK_FUNCTION( prvEDFRunToCompletionTask, pvParameters )
+    {
+        TCB_t * const pxTCB = pxCurrentTCB;
+
+        /* Stop warnings. */
+        ( void ) pvParameters;
+
+        /* A fresh stack frame is built each time a job starts, so the loop only
+         * runs a second time if the job overran into its next period. */
+        for( ; ; )
+        {
+            pxTCB->pxJobCode( pxTCB->pvJobParameters );
+            ( void ) xTaskDelayUntil( &( pxTCB->xLastReleaseTime ), pxTCB->xTaskPeriod );
+        }
+    }
+
+#endif /* configUSE_EDF_SHARED_STACK */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_LIMITED_PREEMPTION == 1 )
+
+    void vTaskEnterNonPreemptiveRegion( void )
+    {
+        /* Only the running task changes its own nesting count, and the tick
+         * interrupt only reads it, so no critical section is needed. */
+        ( pxCurrentTCB->uxNonPreemptiveNesting )++;
+    }
+
+#endif /* configUSE_EDF_LIMITED_PREEMPTION */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_LIMITED_PREEMPTION == 1 )
+
+    void vTaskExitNonPreemptiveRegion( void )
+    {
+        configASSERT( pxCurrentTCB->uxNonPreemptiveNesting );
+
+        ( pxCurrentTCB->uxNonPreemptiveNesting )--;
+
+        /* Take any preemption that was deferred while inside the region. */
+        if( ( pxCurrentTCB->uxNonPreemptiveNesting == ( UBaseType_t ) 0U ) && ( xPreemptionDeferred != pdFALSE ) )
+        {
+            taskYIELD();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_EDF_LIMITED_PREEMPTION */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_LIMITED_PREEMPTION == 1 )
+
+    void vTaskPreemptionPoint( void )
+    {
+        /* A task using preemption points runs with a nesting count of one
+         * between points.  If it is nested any deeper it is inside an explicit
+         * non-preemptive region, which the point must not break. */
+        if( ( xPreemptionDeferred != pdFALSE ) && ( pxCurrentTCB->uxNonPreemptiveNesting == ( UBaseType_t ) 1U ) )
+        {
+            /* Become preemptable just long enough for the scheduler to select
+             * the task with the earliest deadline. */
+            pxCurrentTCB->uxNonPreemptiveNesting = ( UBaseType_t ) 0U;
+            taskYIELD();
+            pxCurrentTCB->uxNonPreemptiveNesting = ( UBaseType_t ) 1U;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_EDF_LIMITED_PREEMPTION */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_TRACE_FACILITY == 1 ) )
+
+    uint32_t ulTaskGetContextSwitchCount( void )
+    {
+        return ulContextSwitchCount;
+    }
+
+#endif
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configGENERATE_RUN_TIME_STATS == 1 ) )
+
+    uint32_t ulTaskGetSystemLoad( void )
+    {
+        configRUN_TIME_COUNTER_TYPE ulNow, ulIdleTime;
+        uint32_t ulReturn;
+
+        taskENTER_CRITICAL();
+        {
+            #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                portALT_GET_RUN_TIME_COUNTER_VALUE( ulNow );
+            #else
+                ulNow = portGET_RUN_TIME_COUNTER_VALUE();
+            #endif
+
+            ulIdleTime = xIdleTaskHandle->ulRunTimeCounter;
+
+            /* The time since the running task was switched in is only charged
+             * to it at the next context switch. */
+            if( ( pxCurrentTCB == xIdleTaskHandle ) && ( ulNow > ulTaskSwitchedInTime ) )
+            {
+                ulIdleTime += ( ulNow - ulTaskSwitchedInTime );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        /* Multiplied in 64 bits so the percentage neither overflows the
+         * counter type nor exceeds 100 through a truncated divisor. */
+        if( ( ulNow > ( configRUN_TIME_COUNTER_TYPE ) 0 ) && ( ulNow > ulIdleTime ) )
+        {
+            ulReturn = ( uint32_t ) ( ( ( uint64_t ) ( ulNow - ulIdleTime ) * ( uint64_t ) 10000U ) / ( uint64_t ) ulNow );
+        }
+        else
+        {
+            ulReturn = 0UL;
+        }
+
+        return ulReturn;
+    }
+
+#endif
+/*-----------------------------------------------------------*/
+
+static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
+                                            const BaseType_t xCanBlockIndefinitely )
+{
+    TickType_t xTimeToWake;
+    const TickType_t xConstTickCount = xTickCount;
+
+    #if ( INCLUDE_xTaskAbortDelay == 1 )
+        {
+            /* About to enter a delayed list, so ensure the ucDelayAborted flag is
+             * reset to pdFALSE so it can be detected as having been set to pdTRUE
+             * when the task leaves the Blocked state. */
+            pxCurrentTCB->ucDelayAborted = pdFALSE;
+        }
+    #endif
+
+    /* Remove the task from the ready list before adding it to the blocked list
+     * as the same list item is used for both lists. */
+    if( uxListRemove( &( pxCurrentTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+    {
+        /* The current task must be in a ready list, so there is no need to
+         * check, and the port reset macro can be called directly. */
+        portRESET_READY_PRIORITY( pxCurrentTCB->uxPriority, uxTopReadyPriority ); /*lint !e931 pxCurrentTCB cannot change as it is the calling task.  pxCurrentTCB->uxPriority and uxTopReadyPriority cannot change as called with scheduler suspended or in a critical section. */
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    #if ( configUSE_EDF_RECLAIMING == 1 )
+        {
+            /* The job of the task is complete once it blocks. */
+            prvEDFReclaimJobCompleted( pxCurrentTCB );
+        }
+    #endif
+
+    #if ( configUSE_EDF_FIRM_DEADLINES == 1 )
+        {
+            /* Only xTaskDelayUntil() sets the wake time, after blocking. */
+            pxCurrentTCB->pxFirmWakeTime = NULL;
+        }
+    #endif
+
+    #if ( configUSE_EDF_SLACK_STEALING == 1 )
+        {
+            if( pxCurrentTCB->xAperiodic != pdFALSE )
+            {
+                prvEDFAperiodicJobCompleted( pxCurrentTCB );
+            }
+            else
+            {
+                /* The unused part of the WCET of the job becomes slack. */
+                xSlackOutOfDate = pdTRUE;
+            }
+        }
+    #endif
+
     #if ( INCLUDE_vTaskSuspend == 1 )
         {
             if( ( xTicksToWait == portMAX_DELAY ) && ( xCanBlockIndefinitely != pdFALSE ) )
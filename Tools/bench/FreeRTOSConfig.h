@@ -0,0 +1,118 @@
+/*
+ * FreeRTOS V202112.00
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/*-----------------------------------------------------------
+ * Configuration of the scheduler overhead benchmark, see edf_bench.c.  The
+ * kernel runs on the FreeRTOS POSIX port, so every task is a thread and the
+ * tick is a signal.
+ *
+ * The ready queue backend is selected when building:
+ *     edf      deadline ordered ready list, the default
+ *     fp       one ready list per priority, -DconfigUSE_EDF_SCHEDULER=0
+ *     fp-clz   as fp with the port's bitmap task selection,
+ *              -DconfigUSE_EDF_SCHEDULER=0 -DconfigUSE_PORT_OPTIMISED_TASK_SELECTION=1
+ *----------------------------------------------------------*/
+
+#include <limits.h>
+
+#include "edf_bench.h"
+
+/*****************************************************************/
+#define configUSE_PREEMPTION		1
+#define configUSE_IDLE_HOOK			1
+#define configUSE_TICK_HOOK			1
+#define configTICK_RATE_HZ			( ( TickType_t ) 1000 )
+#define configMAX_PRIORITIES		( 32 )
+#define configMINIMAL_STACK_SIZE	( ( unsigned short ) PTHREAD_STACK_MIN )	/* Every task is a thread, whose stack is at least this many words */
+#define configMAX_TASK_NAME_LEN		( 12 )
+#define configUSE_16_BIT_TICKS		0
+#define configIDLE_SHOULD_YIELD		1
+#define configUSE_TIME_SLICING		0
+#define configUSE_MUTEXES			0
+#define configUSE_TIMERS			0
+#define configCHECK_FOR_STACK_OVERFLOW	0
+
+#define configGENERATE_RUN_TIME_STATS	1									/* Switches account run time as on the target */
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#define portGET_RUN_TIME_COUNTER_VALUE()		ulBenchRunTimeCounter()
+#define configSUPPORT_STATIC_ALLOCATION			0
+#define configSUPPORT_DYNAMIC_ALLOCATION		1							/* heap_3.c, tasks are allocated with malloc() */
+#define configUSE_TRACE_FACILITY				1
+
+#define configQUEUE_REGISTRY_SIZE	0
+
+#define configHISTOGRAM_SUB_BUCKET_BITS	3									/* Durations within 1/8 of their value */
+#define configHISTOGRAM_VALUE_BITS		24									/* Up to 16M timestamp counts, several milliseconds */
+
+#ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
+	#define configUSE_PORT_OPTIMISED_TASK_SELECTION	0
+#endif
+
+/* Configuration for EDF Scheduler.  The EDF extensions are left at their
+ * defaults, off, so the plain deadline ordered ready list is measured. */
+#ifndef configUSE_EDF_SCHEDULER
+	#define configUSE_EDF_SCHEDULER		1
+#endif
+
+/* Timestamps of the operations measured, taken with ullBenchTimestamp().  A
+ * tick is only measured when it is processed as it happens, not when the
+ * ticks pended while the scheduler was suspended are unwound, as the tick
+ * hook closing the measurement is then not called. */
+#define traceTASK_SWITCHED_OUT()					vBenchSwitchStart()
+#define traceTASK_SWITCHED_IN()						vBenchSwitchEnd()
+#define traceMOVED_TASK_TO_READY_STATE( pxTCB )		vBenchReadyStart()
+#define tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )	vBenchReadyEnd()
+#define traceTASK_INCREMENT_TICK( xTickCount )		do{	\
+														if( ( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE ) && ( xPendedTicks == ( TickType_t ) 0 ) ){	\
+															vBenchTickStart();	\
+														}	\
+													}while(0)
+
+#define configASSERT( x )	do{ if( ( x ) == 0 ){ vBenchAssertCalled( __FILE__, __LINE__ ); } }while(0)
+
+
+/* Co-routine definitions. */
+#define configUSE_CO_ROUTINES 		0
+#define configMAX_CO_ROUTINE_PRIORITIES ( 2 )
+
+/* Set the following definitions to 1 to include the API function, or zero
+to exclude the API function. */
+
+#define INCLUDE_vTaskPrioritySet		0
+#define INCLUDE_uxTaskPriorityGet		0
+#define INCLUDE_vTaskDelete				0
+#define INCLUDE_vTaskCleanUpResources	0
+#define INCLUDE_vTaskSuspend			1
+#define INCLUDE_vTaskDelayUntil			1
+#define INCLUDE_vTaskDelay				1
+#define INCLUDE_xTaskGetSchedulerState	1
+#define INCLUDE_xTaskGetCurrentTaskHandle	1							/* Used by the POSIX port */
+
+#endif /* FREERTOS_CONFIG_H */
@@ -0,0 +1,673 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - EDF scheduler benchmark
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+/*
+ * Scheduler overhead benchmark.  Runs the kernel of Src/tasks.c on the
+ * FreeRTOS POSIX port with synthetic periodic task sets, and measures how long
+ * vTaskSwitchContext(), xTaskIncrementTick(), prvAddTaskToReadyList() and
+ * xTaskResumeAll() take, using the trace hooks of FreeRTOSConfig.h.  Each job
+ * spins for its share of the requested utilisation, the end of it with the
+ * scheduler suspended so that xTaskResumeAll() has pended ticks and tasks to
+ * process.
+ *
+ * Every task set runs in a process of its own, so one run cannot disturb the
+ * next.  One line of CSV, or one JSON object with the histogram of the
+ * durations, is printed for each operation of each run.  The durations are in
+ * the unit of ullBenchTimestamp() and include the cost of taking the two
+ * timestamps, measured by the "timestamp" operation.
+ *
+ * Build with a FreeRTOS-Kernel V10.4.6 checkout in $KERNEL, adding
+ * -DconfigUSE_EDF_SCHEDULER=0 to measure the fixed priority ready lists
+ * instead, see FreeRTOSConfig.h:
+ *
+ *     P=$KERNEL/portable/ThirdParty/GCC/Posix
+ *     cc -std=gnu99 -O2 -pthread -ITools/bench -ISrc -I$KERNEL/include -I$P -I$P/utils \
+ *        -o edf_bench Tools/bench/edf_bench.c Src/tasks.c Src/histogram.c \
+ *        $KERNEL/list.c $KERNEL/portable/MemMang/heap_3.c $P/port.c $P/utils/wait_for_event.c
+ *     ./edf_bench -n 1,10,100,1000 -p loguniform,harmonic -o json > edf.json
+ *
+ * Options:
+ *     -n counts       comma separated numbers of tasks, 1,10,100,1000 by default
+ *     -p periods      comma separated period distributions, uniform,
+ *                     loguniform or harmonic (powers of two times the
+ *                     shortest), loguniform by default
+ *     -r min:max      range of the periods in ticks, 10:1000 by default
+ *     -u utilisation  total utilisation of the task set, 0.5 by default
+ *     -s percent      share of each job run with the scheduler suspended, 10
+ *                     by default
+ *     -w ticks        ticks run before measuring, 500 by default
+ *     -d ticks        ticks measured, 5000 by default
+ *     -S seed         seed of the task set generator, 1 by default
+ *     -o format       csv or json, csv by default
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "edf.h"
+#include "histogram.h"
+
+#define benchMAX_TASKS         1000
+#define benchMAX_COUNTS        16
+#define benchTIMESTAMP_PAIRS   1000
+
+#if ( configUSE_EDF_SCHEDULER == 1 )
+    #define benchBACKEND    "edf"
+#elif ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+    #define benchBACKEND    "fp-clz"
+#else
+    #define benchBACKEND    "fp"
+#endif
+
+typedef enum
+{
+    ePeriodsUniform = 0,
+    ePeriodsLogUniform,
+    ePeriodsHarmonic,
+    ePeriodsNumDistributions
+} ePeriodDistribution;
+
+typedef struct xBENCH_TASK
+{
+    TickType_t xPeriod;
+    uint32_t ulLoops;          /*< Iterations of prvBusy() run by each job. */
+    uint32_t ulSuspendedLoops; /*< How many of them run with the scheduler suspended. */
+} BenchTask_t;
+
+typedef struct xBENCH
+{
+    int iCounts[ benchMAX_COUNTS ];
+    int iNumCounts;
+    int iDistributions[ ePeriodsNumDistributions ];
+    int iNumDistributions;
+    TickType_t xMinPeriod;
+    TickType_t xMaxPeriod;
+    double dUtilisation;
+    uint32_t ulSuspendedPercent;
+    TickType_t xWarmUp;
+    TickType_t xDuration;
+    uint64_t ullSeed;
+    int iJson;
+    double dLoopsPerTick;
+
+    /* State of the run in progress. */
+    int iTasks;
+    int iDistribution;
+    int iFirstRun;
+    BenchTask_t xTasks[ benchMAX_TASKS ];
+    uint64_t ullRandom;
+    volatile TickType_t xTicks;
+    volatile int iRecording;
+    volatile int iDone;
+    Histogram_t xHistograms[ benchNUM_OPS ];
+} Bench_t;
+
+static const char * const pcDistributionNames[ ePeriodsNumDistributions ] = { "uniform", "loguniform", "harmonic" };
+static const char * const pcOperationNames[ benchNUM_OPS ] = { "switch", "tick", "ready", "resume_all", "timestamp" };
+
+static Bench_t xBench;
+
+uint64_t ullBenchSwitchStarted = 0ULL;
+uint64_t ullBenchTickStarted = 0ULL;
+uint64_t ullBenchReadyStarted = 0ULL;
+uint64_t ullBenchResumeAllStarted = 0ULL;
+
+/*-----------------------------------------------------------*/
+
+void vBenchRecord( int iOperation,
+                   uint64_t ullDuration )
+{
+    if( xBench.iRecording != 0 )
+    {
+        vHistogramRecord( &( xBench.xHistograms[ iOperation ] ), ( ullDuration > 0xFFFFFFFFULL ) ? 0xFFFFFFFFUL : ( uint32_t ) ullDuration );
+    }
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulBenchRunTimeCounter( void )
+{
+    struct timespec xNow;
+
+    ( void ) clock_gettime( CLOCK_MONOTONIC, &xNow );
+
+    return ( uint32_t ) ( ( ( uint64_t ) xNow.tv_sec * 1000000ULL ) + ( ( uint64_t ) xNow.tv_nsec / 1000ULL ) );
+}
+/*-----------------------------------------------------------*/
+
+void vBenchAssertCalled( const char * pcFile,
+                         int iLine )
+{
+    fprintf( stderr, "assertion failed at %s:%d\n", pcFile, iLine );
+    abort();
+}
+/*-----------------------------------------------------------*/
+
+static void prvBusy( uint32_t ulLoops )
+{
+    volatile uint32_t ulCount;
+
+    for( ulCount = 0; ulCount < ulLoops; ulCount++ )
+    {
+    }
+}
+/*-----------------------------------------------------------*/
+
+static double prvCalibrate( void )
+{
+    const uint32_t ulLoops = 20000000UL;
+    struct timespec xStart, xEnd;
+    double dNanoseconds, dBest = 0.0;
+    int x;
+
+    /* The fastest of a few runs, as the host may be busy. */
+    for( x = 0; x < 3; x++ )
+    {
+        ( void ) clock_gettime( CLOCK_MONOTONIC, &xStart );
+        prvBusy( ulLoops );
+        ( void ) clock_gettime( CLOCK_MONOTONIC, &xEnd );
+
+        dNanoseconds = ( ( double ) ( xEnd.tv_sec - xStart.tv_sec ) * 1e9 ) + ( double ) ( xEnd.tv_nsec - xStart.tv_nsec );
+
+        if( ( dNanoseconds > 0.0 ) && ( ( dBest == 0.0 ) || ( dNanoseconds < dBest ) ) )
+        {
+            dBest = dNanoseconds;
+        }
+    }
+
+    return ( double ) ulLoops * ( 1e9 / ( double ) configTICK_RATE_HZ ) / dBest;
+}
+/*-----------------------------------------------------------*/
+
+static double prvRandom( void )
+{
+    /* xorshift64*, so that the task sets are the same on every host. */
+    xBench.ullRandom ^= xBench.ullRandom >> 12;
+    xBench.ullRandom ^= xBench.ullRandom << 25;
+    xBench.ullRandom ^= xBench.ullRandom >> 27;
+
+    return ( double ) ( ( xBench.ullRandom * 2685821657736338717ULL ) >> 11 ) / 9007199254740992.0;
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t prvPeriod( void )
+{
+    const double dMin = ( double ) xBench.xMinPeriod, dMax = ( double ) xBench.xMaxPeriod;
+    TickType_t xPeriod;
+    int iPowers;
+
+    switch( xBench.iDistribution )
+    {
+        case ePeriodsUniform:
+            xPeriod = xBench.xMinPeriod + ( TickType_t ) ( prvRandom() * ( dMax - dMin + 1.0 ) );
+            break;
+
+        case ePeriodsLogUniform:
+            xPeriod = ( TickType_t ) llround( exp( log( dMin ) + ( prvRandom() * ( log( dMax ) - log( dMin ) ) ) ) );
+            break;
+
+        default:
+            iPowers = ( int ) floor( log2( dMax / dMin ) ) + 1;
+            xPeriod = xBench.xMinPeriod << ( int ) ( prvRandom() * iPowers );
+            break;
+    }
+
+    return ( xPeriod > xBench.xMaxPeriod ) ? xBench.xMaxPeriod : xPeriod;
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchTask( void * pvParameters )
+{
+    const BenchTask_t * const pxTask = ( const BenchTask_t * ) pvParameters;
+    TickType_t xLastWakeTime = xTaskGetTickCount();
+    uint64_t ullEnd;
+
+    for( ; ; )
+    {
+        prvBusy( pxTask->ulLoops - pxTask->ulSuspendedLoops );
+
+        vTaskSuspendAll();
+        prvBusy( pxTask->ulSuspendedLoops );
+
+        /* Ended by vBenchSwitchStart() instead if the task is switched out
+         * before xTaskResumeAll() returns. */
+        ullBenchResumeAllStarted = ullBenchTimestamp();
+        ( void ) xTaskResumeAll();
+        ullEnd = ullBenchTimestamp();
+
+        taskENTER_CRITICAL();
+        {
+            if( ullBenchResumeAllStarted != 0ULL )
+            {
+                vBenchRecord( benchOP_RESUME_ALL, ullEnd - ullBenchResumeAllStarted );
+                ullBenchResumeAllStarted = 0ULL;
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        vTaskDelayUntil( &xLastWakeTime, pxTask->xPeriod );
+    }
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULER == 0 )
+
+    static int prvComparePeriods( const void * pvA,
+                                  const void * pvB )
+    {
+        const TickType_t xA = xBench.xTasks[ *( const int * ) pvA ].xPeriod;
+        const TickType_t xB = xBench.xTasks[ *( const int * ) pvB ].xPeriod;
+
+        return ( xA > xB ) - ( xA < xB );
+    }
+
+#endif /* configUSE_EDF_SCHEDULER */
+/*-----------------------------------------------------------*/
+
+static int prvCreateTasks( void )
+{
+    char cName[ configMAX_TASK_NAME_LEN ];
+    BaseType_t xResult;
+    int x;
+
+    #if ( configUSE_EDF_SCHEDULER == 0 )
+        static int iByPeriod[ benchMAX_TASKS ];
+        static UBaseType_t uxPriorities[ benchMAX_TASKS ];
+
+        /* Rate monotonic priorities, spread over every priority above the
+         * idle task as there are fewer priorities than tasks. */
+        for( x = 0; x < xBench.iTasks; x++ )
+        {
+            iByPeriod[ x ] = x;
+        }
+
+        qsort( iByPeriod, ( size_t ) xBench.iTasks, sizeof( iByPeriod[ 0 ] ), prvComparePeriods );
+
+        for( x = 0; x < xBench.iTasks; x++ )
+        {
+            uxPriorities[ iByPeriod[ x ] ] = ( UBaseType_t ) ( configMAX_PRIORITIES - 1 ) - ( ( UBaseType_t ) x * ( configMAX_PRIORITIES - 2 ) ) / ( UBaseType_t ) xBench.iTasks;
+        }
+    #endif
+
+    for( x = 0; x < xBench.iTasks; x++ )
+    {
+        snprintf( cName, sizeof( cName ), "Bench%d", x );
+
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            {
+                PeriodicTaskParameters_t xDefinition = { 0 };
+
+                xDefinition.pvTaskCode = prvBenchTask;
+                xDefinition.pcName = cName;
+                xDefinition.usStackDepth = configMINIMAL_STACK_SIZE;
+                xDefinition.pvParameters = &( xBench.xTasks[ x ] );
+                xDefinition.uxPriority = 1;
+                xDefinition.xPeriod = xBench.xTasks[ x ].xPeriod;
+                xResult = xTaskPeriodicCreateFromParameters( &xDefinition, NULL );
+            }
+        #else
+            xResult = xTaskCreate( prvBenchTask, cName, configMINIMAL_STACK_SIZE, &( xBench.xTasks[ x ] ), uxPriorities[ x ], NULL );
+        #endif
+
+        if( xResult != pdPASS )
+        {
+            fprintf( stderr, "could not create task %d of %d\n", x, xBench.iTasks );
+            return 0;
+        }
+    }
+
+    return 1;
+}
+/*-----------------------------------------------------------*/
+
+static void prvPrintRow( int iOperation,
+                         int iFirstRow )
+{
+    const Histogram_t * const pxHistogram = &( xBench.xHistograms[ iOperation ] );
+    HistogramSummary_t xSummary;
+    uint32_t ulBucket;
+    int iFirstBucket = 1;
+
+    vHistogramGetSummary( pxHistogram, &xSummary );
+
+    if( xBench.iJson == 0 )
+    {
+        printf( "%s,%d,%s,%.3f,%s,%lu,%lu,%lu,%lu,%lu,%lu,%lu,%s\n",
+                benchBACKEND, xBench.iTasks, pcDistributionNames[ xBench.iDistribution ], xBench.dUtilisation,
+                pcOperationNames[ iOperation ], ( unsigned long ) xSummary.ulCount,
+                ( unsigned long ) xSummary.ulMin, ( unsigned long ) xSummary.ulMean, ( unsigned long ) xSummary.ulP50,
+                ( unsigned long ) xSummary.ulP90, ( unsigned long ) xSummary.ulP99, ( unsigned long ) xSummary.ulMax,
+                benchTIMESTAMP_UNIT );
+        return;
+    }
+
+    printf( "%s  { \"backend\": \"%s\", \"tasks\": %d, \"periods\": \"%s\", \"utilisation\": %.3f, \"operation\": \"%s\", \"unit\": \"%s\",\n",
+            iFirstRow ? "" : ",\n", benchBACKEND, xBench.iTasks, pcDistributionNames[ xBench.iDistribution ], xBench.dUtilisation,
+            pcOperationNames[ iOperation ], benchTIMESTAMP_UNIT );
+    printf( "    \"count\": %lu, \"min\": %lu, \"mean\": %lu, \"p50\": %lu, \"p90\": %lu, \"p99\": %lu, \"max\": %lu,\n",
+            ( unsigned long ) xSummary.ulCount, ( unsigned long ) xSummary.ulMin, ( unsigned long ) xSummary.ulMean,
+            ( unsigned long ) xSummary.ulP50, ( unsigned long ) xSummary.ulP90, ( unsigned long ) xSummary.ulP99,
+            ( unsigned long ) xSummary.ulMax );
+
+    /* The non empty buckets, as pairs of the largest value a bucket counts
+     * and the number of values in it. */
+    printf( "    \"histogram\": [" );
+
+    for( ulBucket = 0; ulBucket < ( uint32_t ) histogramNUM_BUCKETS; ulBucket++ )
+    {
+        if( pxHistogram->aulBuckets[ ulBucket ] != 0UL )
+        {
+            printf( "%s[ %lu, %lu ]", iFirstBucket ? " " : ", ",
+                    ( unsigned long ) ( ( ulBucket == ( uint32_t ) ( histogramNUM_BUCKETS - 1 ) ) ? pxHistogram->ulMax : ulHistogramBucketUpperBound( ulBucket ) ),
+                    ( unsigned long ) pxHistogram->aulBuckets[ ulBucket ] );
+            iFirstBucket = 0;
+        }
+    }
+
+    printf( " ] }" );
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationTickHook( void )
+{
+    const uint64_t ullNow = ullBenchTimestamp();
+
+    if( ullBenchTickStarted != 0ULL )
+    {
+        vBenchRecord( benchOP_TICK, ullNow - ullBenchTickStarted );
+        ullBenchTickStarted = 0ULL;
+    }
+
+    xBench.xTicks++;
+
+    if( xBench.xTicks == xBench.xWarmUp )
+    {
+        xBench.iRecording = 1;
+    }
+    else if( xBench.xTicks == ( xBench.xWarmUp + xBench.xDuration ) )
+    {
+        xBench.iRecording = 0;
+        xBench.iDone = 1;
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationIdleHook( void )
+{
+    int iOperation;
+
+    /* The idle task runs at least once per configEDF_IDLE_TASK_PERIOD, and
+     * whenever no other task is ready. */
+    if( xBench.iDone != 0 )
+    {
+        for( iOperation = 0; iOperation < benchNUM_OPS; iOperation++ )
+        {
+            prvPrintRow( iOperation, xBench.iFirstRun && ( iOperation == 0 ) );
+        }
+
+        fflush( stdout );
+        _exit( 0 );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvRun( void )
+{
+    const double dTaskUtilisation = xBench.dUtilisation / ( double ) xBench.iTasks;
+    uint64_t ullStart;
+    double dLoops;
+    int x;
+
+    /* The same seed for every run, so the task sets with the same number of
+     * tasks are the same whatever the backend. */
+    xBench.ullRandom = xBench.ullSeed * 0x9E3779B97F4A7C15ULL + 1ULL;
+
+    for( x = 0; x < xBench.iTasks; x++ )
+    {
+        xBench.xTasks[ x ].xPeriod = prvPeriod();
+        dLoops = xBench.dLoopsPerTick * ( double ) xBench.xTasks[ x ].xPeriod * dTaskUtilisation;
+        xBench.xTasks[ x ].ulLoops = ( dLoops > 4e9 ) ? 4000000000UL : ( uint32_t ) dLoops;
+        xBench.xTasks[ x ].ulSuspendedLoops = ( uint32_t ) ( ( ( uint64_t ) xBench.xTasks[ x ].ulLoops * xBench.ulSuspendedPercent ) / 100ULL );
+    }
+
+    if( prvCreateTasks() == 0 )
+    {
+        _exit( 1 );
+    }
+
+    xBench.iRecording = 1;
+
+    for( x = 0; x < benchTIMESTAMP_PAIRS; x++ )
+    {
+        ullStart = ullBenchTimestamp();
+        vBenchRecord( benchOP_TIMESTAMP, ullBenchTimestamp() - ullStart );
+    }
+
+    xBench.iRecording = 0;
+
+    vTaskStartScheduler();
+
+    fprintf( stderr, "the scheduler could not be started\n" );
+    _exit( 1 );
+}
+/*-----------------------------------------------------------*/
+
+static int prvWaitForRun( pid_t xChild )
+{
+    /* Generous, as starting a thousand threads takes a while. */
+    const long lTimeoutMs = 30000L + ( long ) ( ( ( xBench.xWarmUp + xBench.xDuration ) * 4000UL ) / configTICK_RATE_HZ );
+    struct timespec xPoll = { 0, 10000000L };
+    long lWaitedMs;
+    int iStatus;
+
+    for( lWaitedMs = 0; lWaitedMs < lTimeoutMs; lWaitedMs += 10L )
+    {
+        if( waitpid( xChild, &iStatus, WNOHANG ) == xChild )
+        {
+            return WIFEXITED( iStatus ) && ( WEXITSTATUS( iStatus ) == 0 );
+        }
+
+        ( void ) nanosleep( &xPoll, NULL );
+    }
+
+    ( void ) kill( xChild, SIGKILL );
+    ( void ) waitpid( xChild, &iStatus, 0 );
+    fprintf( stderr, "timed out\n" );
+
+    return 0;
+}
+/*-----------------------------------------------------------*/
+
+static int prvParseCounts( const char * pcValue )
+{
+    char * pcEnd;
+
+    for( xBench.iNumCounts = 0; xBench.iNumCounts < benchMAX_COUNTS; )
+    {
+        const long lCount = strtol( pcValue, &pcEnd, 0 );
+
+        if( ( pcEnd == pcValue ) || ( lCount < 1L ) || ( lCount > benchMAX_TASKS ) )
+        {
+            return 0;
+        }
+
+        xBench.iCounts[ xBench.iNumCounts++ ] = ( int ) lCount;
+
+        if( *pcEnd != ',' )
+        {
+            return *pcEnd == '\0';
+        }
+
+        pcValue = pcEnd + 1;
+    }
+
+    return 0;
+}
+/*-----------------------------------------------------------*/
+
+static int prvParseDistributions( const char * pcValue )
+{
+    size_t xLength;
+    int x;
+
+    for( xBench.iNumDistributions = 0; xBench.iNumDistributions < ePeriodsNumDistributions; )
+    {
+        xLength = strcspn( pcValue, "," );
+
+        for( x = 0; x < ePeriodsNumDistributions; x++ )
+        {
+            if( ( strlen( pcDistributionNames[ x ] ) == xLength ) && ( strncmp( pcValue, pcDistributionNames[ x ], xLength ) == 0 ) )
+            {
+                break;
+            }
+        }
+
+        if( x == ePeriodsNumDistributions )
+        {
+            return 0;
+        }
+
+        xBench.iDistributions[ xBench.iNumDistributions++ ] = x;
+
+        if( pcValue[ xLength ] == '\0' )
+        {
+            return 1;
+        }
+
+        pcValue += xLength + 1;
+    }
+
+    return 0;
+}
+/*-----------------------------------------------------------*/
+
+int main( int argc,
+          char ** argv )
+{
+    unsigned long ulMin = 10UL, ulMax = 1000UL;
+    int iArg, iCount, iDistribution, iValid = 1, iFailed = 0, iRuns = 0;
+    pid_t xChild;
+
+    xBench.iCounts[ 0 ] = 1;
+    xBench.iCounts[ 1 ] = 10;
+    xBench.iCounts[ 2 ] = 100;
+    xBench.iCounts[ 3 ] = 1000;
+    xBench.iNumCounts = 4;
+    xBench.iDistributions[ 0 ] = ePeriodsLogUniform;
+    xBench.iNumDistributions = 1;
+    xBench.dUtilisation = 0.5;
+    xBench.ulSuspendedPercent = 10UL;
+    xBench.xWarmUp = 500;
+    xBench.xDuration = 5000;
+    xBench.ullSeed = 1ULL;
+
+    for( iArg = 1; iArg < argc; iArg++ )
+    {
+        const char * const pcOption = argv[ iArg ];
+        const char * const pcValue = ( iArg + 1 < argc ) ? argv[ iArg + 1 ] : NULL;
+
+        if( ( pcOption[ 0 ] == '-' ) && ( pcOption[ 1 ] != '\0' ) && ( pcOption[ 2 ] == '\0' ) && ( pcValue != NULL ) &&
+            ( strchr( "nprusdwSo", pcOption[ 1 ] ) != NULL ) )
+        {
+            iArg++;
+
+            switch( pcOption[ 1 ] )
+            {
+                case 'n': iValid &= prvParseCounts( pcValue ); break;
+                case 'p': iValid &= prvParseDistributions( pcValue ); break;
+                case 'r': iValid &= ( sscanf( pcValue, "%lu:%lu", &ulMin, &ulMax ) == 2 ); break;
+                case 'u': xBench.dUtilisation = atof( pcValue ); break;
+                case 's': xBench.ulSuspendedPercent = strtoul( pcValue, NULL, 0 ); break;
+                case 'w': xBench.xWarmUp = ( TickType_t ) strtoul( pcValue, NULL, 0 ); break;
+                case 'd': xBench.xDuration = ( TickType_t ) strtoul( pcValue, NULL, 0 ); break;
+                case 'S': xBench.ullSeed = strtoull( pcValue, NULL, 0 ); break;
+                case 'o': xBench.iJson = ( strcmp( pcValue, "json" ) == 0 ); iValid &= xBench.iJson || ( strcmp( pcValue, "csv" ) == 0 ); break;
+            }
+        }
+        else
+        {
+            iValid = 0;
+        }
+    }
+
+    xBench.xMinPeriod = ( TickType_t ) ulMin;
+    xBench.xMaxPeriod = ( TickType_t ) ulMax;
+
+    if( ( iValid == 0 ) || ( ulMin < 1UL ) || ( ulMax < ulMin ) || ( xBench.dUtilisation <= 0.0 ) ||
+        ( xBench.ulSuspendedPercent > 100UL ) || ( xBench.xWarmUp < 1 ) || ( xBench.xDuration < 1 ) )
+    {
+        fprintf( stderr, "usage: %s [-n counts] [-p periods] [-r min:max] [-u utilisation] [-s percent] [-w ticks] [-d ticks] [-S seed] [-o csv|json]\n", argv[ 0 ] );
+        return 1;
+    }
+
+    xBench.dLoopsPerTick = prvCalibrate();
+
+    printf( xBench.iJson ? "[\n" : "backend,tasks,periods,utilisation,operation,count,min,mean,p50,p90,p99,max,unit\n" );
+
+    for( iDistribution = 0; iDistribution < xBench.iNumDistributions; iDistribution++ )
+    {
+        for( iCount = 0; iCount < xBench.iNumCounts; iCount++ )
+        {
+            xBench.iTasks = xBench.iCounts[ iCount ];
+            xBench.iDistribution = xBench.iDistributions[ iDistribution ];
+            xBench.iFirstRun = ( iRuns == 0 );
+
+            fflush( stdout );
+            xChild = fork();
+
+            if( xChild == 0 )
+            {
+                prvRun();
+            }
+
+            if( ( xChild > 0 ) && prvWaitForRun( xChild ) )
+            {
+                iRuns++;
+            }
+            else
+            {
+                fprintf( stderr, "%d tasks with %s periods failed\n", xBench.iTasks, pcDistributionNames[ xBench.iDistribution ] );
+                iFailed = 1;
+            }
+        }
+    }
+
+    if( xBench.iJson != 0 )
+    {
+        printf( "\n]\n" );
+    }
+
+    return iFailed;
+}
@@ -0,0 +1,123 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - EDF scheduler benchmark
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+/*
+ * Timestamps taken by the trace hooks of the benchmark, see FreeRTOSConfig.h.
+ * Included by FreeRTOSConfig.h, so only uses standard C types.  On x86 the
+ * time stamp counter is read, which counts cycles at the nominal clock rate of
+ * the processor whatever its current frequency, else the monotonic clock is
+ * read in nanoseconds.
+ */
+
+#ifndef INC_EDF_BENCH_H
+#define INC_EDF_BENCH_H
+
+#include <stdint.h>
+
+#if defined( __x86_64__ ) || defined( __i386__ )
+    #include <x86intrin.h>
+
+    #define benchTIMESTAMP_UNIT    "cycles"
+
+    static inline uint64_t ullBenchTimestamp( void )
+    {
+        return __rdtsc();
+    }
+#else
+    #include <time.h>
+
+    #define benchTIMESTAMP_UNIT    "ns"
+
+    static inline uint64_t ullBenchTimestamp( void )
+    {
+        struct timespec xNow;
+
+        ( void ) clock_gettime( CLOCK_MONOTONIC, &xNow );
+
+        return ( ( uint64_t ) xNow.tv_sec * 1000000000ULL ) + ( uint64_t ) xNow.tv_nsec;
+    }
+#endif
+
+/* The operations measured, each in its own histogram. */
+#define benchOP_SWITCH        0 /* vTaskSwitchContext(), from switching out the running task to switching in the next. */
+#define benchOP_TICK          1 /* xTaskIncrementTick(), up to the tick hook. */
+#define benchOP_READY         2 /* prvAddTaskToReadyList(). */
+#define benchOP_RESUME_ALL    3 /* xTaskResumeAll(), until it returns or switches to another task. */
+#define benchOP_TIMESTAMP     4 /* Two back to back timestamps, to be subtracted from the others. */
+#define benchNUM_OPS          5
+
+/* When each operation in progress started, 0 if none is. */
+extern uint64_t ullBenchSwitchStarted;
+extern uint64_t ullBenchTickStarted;
+extern uint64_t ullBenchReadyStarted;
+extern uint64_t ullBenchResumeAllStarted;
+
+void vBenchRecord( int iOperation,
+                   uint64_t ullDuration );
+uint32_t ulBenchRunTimeCounter( void );
+void vBenchAssertCalled( const char * pcFile,
+                         int iLine );
+
+static inline void vBenchSwitchStart( void )
+{
+    const uint64_t ullNow = ullBenchTimestamp();
+
+    /* A task switched out inside xTaskResumeAll() ends its measurement. */
+    if( ullBenchResumeAllStarted != 0ULL )
+    {
+        vBenchRecord( benchOP_RESUME_ALL, ullNow - ullBenchResumeAllStarted );
+        ullBenchResumeAllStarted = 0ULL;
+    }
+
+    ullBenchSwitchStarted = ullBenchTimestamp();
+}
+
+static inline void vBenchSwitchEnd( void )
+{
+    const uint64_t ullNow = ullBenchTimestamp();
+
+    vBenchRecord( benchOP_SWITCH, ullNow - ullBenchSwitchStarted );
+}
+
+static inline void vBenchTickStart( void )
+{
+    ullBenchTickStarted = ullBenchTimestamp();
+}
+
+static inline void vBenchReadyStart( void )
+{
+    ullBenchReadyStarted = ullBenchTimestamp();
+}
+
+static inline void vBenchReadyEnd( void )
+{
+    const uint64_t ullNow = ullBenchTimestamp();
+
+    vBenchRecord( benchOP_READY, ullNow - ullBenchReadyStarted );
+}
+
+#endif /* INC_EDF_BENCH_H */
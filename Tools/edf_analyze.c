@@ -0,0 +1,352 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - EDF schedulability analyzer
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Host side schedulability analyzer of a periodic task set under EDF, built
+ * on the analysis in Src/edf_analysis.c that the kernel runs for admission
+ * control, so both always agree.  Prints whether the task set is feasible by
+ * Quick Processor-demand Analysis and the critical scaling factor of its
+ * WCETs, and optionally the worst case response time of every task.
+ *
+ * The task set file has one line per task with its name, period, relative
+ * deadline and WCET, and optionally the longest time it runs without being
+ * preemptable and its preemption threshold, all in ticks.  A deadline of 0 is
+ * the period.  The preemption threshold is the shortest relative deadline of
+ * the tasks that cannot preempt a started job of the task, as in
+ * EDFAnalysisTask_t.  Text after a # is ignored:
+ *
+ *     # name             period  deadline  wcet  blocking  threshold
+ *     Button_1           50      50        1
+ *     Load_1_Simulation  10      0         5     2
+ *
+ * Build and run on the host:
+ *
+ *     cc -std=c99 -O2 -ISrc -o edf_analyze Tools/edf_analyze.c Src/edf_analysis.c
+ *     ./edf_analyze taskset.txt
+ *
+ * The exit status is 0 if the task set is feasible, 1 if it is not, and 2 if
+ * it could not be decided.
+ *
+ * Options:
+ *     -d          also check every deadline up to the bound with the exact
+ *                 processor-demand test, which finds the shortest interval
+ *                 in which the demand exceeds the time available
+ *     -r          also compute the worst case response time of every task,
+ *                 whose cost grows with the length of the busy period
+ *     -s steps    evaluations of the demand allowed per test, and per task for
+ *                 the response times, 10000 by default, 0 for no limit.  The
+ *                 scaling factor is only a lower bound if a test runs out of
+ *                 steps, as happens when it is close to the inverse of the
+ *                 utilisation
+ *     -c          print the response times as CSV
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "edf_analysis.h"
+
+#define analyzeNAME_LENGTH    32
+
+typedef struct xANALYZE_TASKS
+{
+    EDFAnalysisTask_t * pxTasks;
+    char ( * pcNames )[ analyzeNAME_LENGTH ];
+    size_t uxCount;
+    size_t uxSize;
+} AnalyzeTasks_t;
+
+/*-----------------------------------------------------------*/
+
+static int prvReadTaskSet( const char * pcFileName,
+                           AnalyzeTasks_t * pxTasks )
+{
+    char cLine[ 256 ], cName[ analyzeNAME_LENGTH ];
+    char * pcComment;
+    unsigned long ulPeriod, ulDeadline, ulWcet, ulBlocking, ulThreshold;
+    int iFields, iLine = 0;
+    FILE * pxFile = fopen( pcFileName, "r" );
+
+    if( pxFile == NULL )
+    {
+        perror( pcFileName );
+        return -1;
+    }
+
+    while( fgets( cLine, sizeof( cLine ), pxFile ) != NULL )
+    {
+        iLine++;
+        pcComment = strchr( cLine, '#' );
+
+        if( pcComment != NULL )
+        {
+            *pcComment = '\0';
+        }
+
+        ulBlocking = 0UL;
+        ulThreshold = 0UL;
+        iFields = sscanf( cLine, "%31s %lu %lu %lu %lu %lu", cName, &ulPeriod, &ulDeadline, &ulWcet, &ulBlocking, &ulThreshold );
+
+        if( iFields <= 0 )
+        {
+            continue;
+        }
+
+        if( ( iFields < 4 ) || ( ulPeriod == 0UL ) || ( ulPeriod > UINT32_MAX ) || ( ulDeadline > UINT32_MAX ) ||
+            ( ulWcet > UINT32_MAX ) || ( ulBlocking > ulWcet ) || ( ulThreshold > UINT32_MAX ) )
+        {
+            fprintf( stderr, "%s:%d: expected name period deadline wcet [blocking [threshold]]\n", pcFileName, iLine );
+            fclose( pxFile );
+            return -1;
+        }
+
+        if( pxTasks->uxCount == pxTasks->uxSize )
+        {
+            pxTasks->uxSize = ( pxTasks->uxSize != 0 ) ? ( pxTasks->uxSize * 2 ) : 64;
+            pxTasks->pxTasks = realloc( pxTasks->pxTasks, pxTasks->uxSize * sizeof( pxTasks->pxTasks[ 0 ] ) );
+            pxTasks->pcNames = realloc( pxTasks->pcNames, pxTasks->uxSize * sizeof( pxTasks->pcNames[ 0 ] ) );
+
+            if( ( pxTasks->pxTasks == NULL ) || ( pxTasks->pcNames == NULL ) )
+            {
+                fprintf( stderr, "out of memory\n" );
+                exit( 1 );
+            }
+        }
+
+        snprintf( pxTasks->pcNames[ pxTasks->uxCount ], analyzeNAME_LENGTH, "%s", cName );
+        pxTasks->pxTasks[ pxTasks->uxCount ].ulPeriod = ( uint32_t ) ulPeriod;
+        pxTasks->pxTasks[ pxTasks->uxCount ].ulDeadline = ( uint32_t ) ( ( ulDeadline != 0UL ) ? ulDeadline : ulPeriod );
+        pxTasks->pxTasks[ pxTasks->uxCount ].ulWcet = ( uint32_t ) ulWcet;
+        pxTasks->pxTasks[ pxTasks->uxCount ].ulNonPreemptive = ( uint32_t ) ulBlocking;
+        pxTasks->pxTasks[ pxTasks->uxCount ].ulPreemptionThreshold = ( uint32_t ) ulThreshold;
+        pxTasks->uxCount++;
+    }
+
+    fclose( pxFile );
+
+    return ( int ) pxTasks->uxCount;
+}
+/*-----------------------------------------------------------*/
+
+static double prvMilliseconds( clock_t xStart )
+{
+    return ( ( double ) ( clock() - xStart ) * 1e3 ) / ( double ) CLOCKS_PER_SEC;
+}
+/*-----------------------------------------------------------*/
+
+static void prvPrintTest( const char * pcTest,
+                          eEDFAnalysisResult eResult,
+                          const EDFAnalysisReport_t * pxReport )
+{
+    printf( "%-16s", pcTest );
+
+    switch( eResult )
+    {
+        case eEDFAnalysisFeasible:
+            printf( "feasible" );
+            break;
+
+        case eEDFAnalysisInfeasible:
+
+            if( pxReport->ullMissTime == 0U )
+            {
+                printf( "infeasible, utilisation above 1" );
+            }
+            else
+            {
+                printf( "infeasible, demand %llu in the first %llu ticks", ( unsigned long long ) pxReport->ullDemand, ( unsigned long long ) pxReport->ullMissTime );
+            }
+
+            break;
+
+        default:
+            printf( "undecided" );
+            break;
+    }
+
+    printf( ", bound %llu, %lu steps\n", ( unsigned long long ) pxReport->ullBound, ( unsigned long ) pxReport->ulSteps );
+}
+/*-----------------------------------------------------------*/
+
+int main( int argc,
+          char ** argv )
+{
+    const char * pcTaskSet = NULL;
+    AnalyzeTasks_t xTasks = { NULL, NULL, 0, 0 };
+    EDFAnalysisTaskSet_t xTaskSet;
+    EDFAnalysisReport_t xReport;
+    eEDFAnalysisResult eResult, eDemandResult, eResponseResult;
+    clock_t xStart;
+    unsigned long ulMaxSteps = 10000UL;
+    uint64_t ullResponseTime;
+    uint32_t ulScaling;
+    double dUtilisation = 0.0;
+    size_t ux;
+    int iArg, iDemand = 0, iResponseTimes = 0, iCsv = 0;
+
+    for( iArg = 1; iArg < argc; iArg++ )
+    {
+        const char * const pcOption = argv[ iArg ];
+        const char * const pcValue = ( iArg + 1 < argc ) ? argv[ iArg + 1 ] : NULL;
+
+        if( strcmp( pcOption, "-d" ) == 0 )
+        {
+            iDemand = 1;
+        }
+        else if( ( strcmp( pcOption, "-s" ) == 0 ) && ( pcValue != NULL ) )
+        {
+            ulMaxSteps = strtoul( pcValue, NULL, 0 );
+            iArg++;
+        }
+        else if( strcmp( pcOption, "-r" ) == 0 )
+        {
+            iResponseTimes = 1;
+        }
+        else if( strcmp( pcOption, "-c" ) == 0 )
+        {
+            iCsv = 1;
+        }
+        else if( ( pcOption[ 0 ] != '-' ) && ( pcTaskSet == NULL ) )
+        {
+            pcTaskSet = pcOption;
+        }
+        else
+        {
+            pcTaskSet = NULL;
+            break;
+        }
+    }
+
+    if( ( pcTaskSet == NULL ) || ( ulMaxSteps > UINT32_MAX ) )
+    {
+        fprintf( stderr, "usage: %s [-d] [-r] [-s steps] [-c] taskset\n", argv[ 0 ] );
+        return 2;
+    }
+
+    if( prvReadTaskSet( pcTaskSet, &xTasks ) <= 0 )
+    {
+        return 2;
+    }
+
+    memset( &xTaskSet, 0, sizeof( xTaskSet ) );
+    xTaskSet.pxTasks = xTasks.pxTasks;
+    xTaskSet.uxTaskCount = xTasks.uxCount;
+    xTaskSet.ulMaxSteps = ( uint32_t ) ulMaxSteps;
+
+    for( ux = 0; ux < xTasks.uxCount; ux++ )
+    {
+        dUtilisation += ( double ) xTasks.pxTasks[ ux ].ulWcet / ( double ) xTasks.pxTasks[ ux ].ulPeriod;
+    }
+
+    printf( "%-16s%lu\n", "tasks", ( unsigned long ) xTasks.uxCount );
+    printf( "%-16s%.6f\n", "utilisation", dUtilisation );
+
+    xStart = clock();
+    eResult = eEDFAnalysisQPATest( &xTaskSet, &xReport );
+    fprintf( stderr, "QPA took %.3f ms\n", prvMilliseconds( xStart ) );
+    prvPrintTest( "QPA", eResult, &xReport );
+
+    if( iDemand != 0 )
+    {
+        xStart = clock();
+        eDemandResult = eEDFAnalysisDemandTest( &xTaskSet, &xReport );
+        fprintf( stderr, "demand test took %.3f ms\n", prvMilliseconds( xStart ) );
+        prvPrintTest( "demand", eDemandResult, &xReport );
+
+        /* Both tests are exact, so they can only differ by one being
+         * undecided. */
+        if( ( eDemandResult != eResult ) && ( eDemandResult != eEDFAnalysisUndecided ) && ( eResult != eEDFAnalysisUndecided ) )
+        {
+            fprintf( stderr, "the tests disagree\n" );
+            return 2;
+        }
+
+        if( eResult == eEDFAnalysisUndecided )
+        {
+            eResult = eDemandResult;
+        }
+    }
+
+    xStart = clock();
+
+    if( eEDFAnalysisScalingFactor( &xTaskSet, &ulScaling ) == eEDFAnalysisFeasible )
+    {
+        printf( "%-16s%.6f", "scaling factor", ( double ) ulScaling / ( double ) edfanalysisSCALING_ONE );
+    }
+    else
+    {
+        printf( "%-16sat least %.6f", "scaling factor", ( double ) ulScaling / ( double ) edfanalysisSCALING_ONE );
+    }
+
+    if( ulScaling != 0UL )
+    {
+        printf( ", needs %.6f of the processor speed", ( double ) edfanalysisSCALING_ONE / ( double ) ulScaling );
+    }
+
+    printf( "\n" );
+    fprintf( stderr, "scaling factor took %.3f ms\n", prvMilliseconds( xStart ) );
+
+    if( iResponseTimes != 0 )
+    {
+        printf( iCsv ? "\nname,period,deadline,wcet,blocking,threshold,wcrt\n" : "\n%-20s %10s %10s %10s %10s %10s %12s\n",
+                "name", "period", "deadline", "wcet", "blocking", "threshold", "wcrt" );
+        xStart = clock();
+
+        for( ux = 0; ux < xTasks.uxCount; ux++ )
+        {
+            const EDFAnalysisTask_t * const pxTask = &( xTasks.pxTasks[ ux ] );
+            char cResponseTime[ 32 ];
+
+            eResponseResult = eEDFAnalysisResponseTime( &xTaskSet, ux, &ullResponseTime );
+
+            if( eResponseResult == eEDFAnalysisUndecided )
+            {
+                snprintf( cResponseTime, sizeof( cResponseTime ), "?" );
+            }
+            else
+            {
+                snprintf( cResponseTime, sizeof( cResponseTime ), "%llu%s", ( unsigned long long ) ullResponseTime, ( eResponseResult == eEDFAnalysisInfeasible ) ? "!" : "" );
+            }
+
+            printf( iCsv ? "%s,%lu,%lu,%lu,%lu,%lu,%s\n" : "%-20s %10lu %10lu %10lu %10lu %10lu %12s\n",
+                    xTasks.pcNames[ ux ], ( unsigned long ) pxTask->ulPeriod, ( unsigned long ) pxTask->ulDeadline, ( unsigned long ) pxTask->ulWcet,
+                    ( unsigned long ) pxTask->ulNonPreemptive, ( unsigned long ) pxTask->ulPreemptionThreshold, cResponseTime );
+        }
+
+        fprintf( stderr, "response times took %.3f ms\n", prvMilliseconds( xStart ) );
+    }
+
+    free( xTasks.pxTasks );
+    free( xTasks.pcNames );
+
+    return ( eResult == eEDFAnalysisFeasible ) ? 0 : ( ( eResult == eEDFAnalysisInfeasible ) ? 1 : 2 );
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,345 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - EDF snapshot printer
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Host side printer of the snapshots taken by uxTaskGetSnapshot(), see
+ * Src/edf.h.  A snapshot is a SystemSnapshot_t followed by its TaskSnapshot_t
+ * records, all little endian 32-bit words.  The input holds any number of
+ * snapshots, found by their taskSNAPSHOT_MAGIC word, so it can be a series of
+ * memory dumps appended to one file.  The load of each task is computed from
+ * its run time in the previous snapshot.
+ *
+ * Build and run on the host, dumping the snapshot kept by the demo with GDB:
+ *
+ *     cc -std=c99 -O2 -o edf_snapshot_dump Tools/edf_snapshot_dump.c
+ *     (gdb) append binary memory snapshots.bin &xTaskSnapshot (&xTaskSnapshot)+1
+ *     ./edf_snapshot_dump -t 1=Button_1 -t 2=Button_2 snapshots.bin
+ *
+ * Options:
+ *     -c              the input holds only the changed records after each
+ *                     header, as sent by the example in Src/edf.h, and the
+ *                     full table is rebuilt from them
+ *     -o              only print the records that changed
+ *     -f hz           run time counter frequency, 59940 by default for T1TC
+ *                     with T1PR = 1000 at 60MHz
+ *     -t number=name  name task number, repeated for each task
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define dumpMAX_TASKS              256
+#define dumpSNAPSHOT_MAGIC         0x53464445UL
+#define dumpHEADER_WORDS           6
+#define dumpRECORD_WORDS           7
+#define dumpSTATE_MASK             0x000000FFUL
+#define dumpCHANGED                0x00000100UL
+
+/* A TaskSnapshot_t, in the order of its members. */
+typedef struct xDUMP_RECORD
+{
+    uint32_t ulTaskNumber;
+    uint32_t ulState;
+    uint32_t ulPeriod;
+    uint32_t ulDeadline;
+    uint32_t ulWakeTime;
+    uint32_t ulRunTime;
+    uint32_t ulMissedDeadlines;
+} DumpRecord_t;
+
+typedef struct xDUMP
+{
+    double dCountsPerSecond;
+    int iChangedOnlyInput;
+    int iChangedOnlyOutput;
+    const char * pcTaskNames[ dumpMAX_TASKS ];
+
+    /* The table as of the last snapshot, indexed by task number. */
+    DumpRecord_t xTasks[ dumpMAX_TASKS ];
+    int iKnown[ dumpMAX_TASKS ];
+    int iChanged[ dumpMAX_TASKS ];
+
+    /* Run times at the previous snapshot, to compute the load. */
+    int iHavePrevious;
+    uint32_t ulPreviousTime;
+    uint32_t ulPreviousRunTime[ dumpMAX_TASKS ];
+    int iHavePreviousRunTime[ dumpMAX_TASKS ];
+    unsigned long ulSnapshots;
+} Dump_t;
+
+/*-----------------------------------------------------------*/
+
+static uint32_t prvWord( const uint8_t * pucBytes )
+{
+    return ( uint32_t ) pucBytes[ 0 ] | ( ( uint32_t ) pucBytes[ 1 ] << 8 ) | ( ( uint32_t ) pucBytes[ 2 ] << 16 ) | ( ( uint32_t ) pucBytes[ 3 ] << 24 );
+}
+/*-----------------------------------------------------------*/
+
+static const char * prvStateName( uint32_t ulState )
+{
+    /* The values of eTaskState. */
+    static const char * const pcNames[] = { "running", "ready", "blocked", "suspended", "deleted", "invalid" };
+
+    return ( ulState < ( sizeof( pcNames ) / sizeof( pcNames[ 0 ] ) ) ) ? pcNames[ ulState ] : "?";
+}
+/*-----------------------------------------------------------*/
+
+static void prvPrintSnapshot( Dump_t * pxDump,
+                              uint32_t ulSequence,
+                              uint32_t ulTickCount,
+                              uint32_t ulTime,
+                              unsigned long ulChanged,
+                              unsigned long ulRecords )
+{
+    const uint32_t ulElapsed = ulTime - pxDump->ulPreviousTime;
+    char cNumber[ 16 ];
+    int x;
+
+    printf( "snapshot %lu at tick %lu, %lu of %lu records changed\n",
+            ( unsigned long ) ulSequence, ( unsigned long ) ulTickCount, ulChanged, ulRecords );
+    printf( "  %-20s %-9s %7s %10s %10s %12s %7s %7s\n", "task", "state", "period", "deadline", "wake", "run ms", "load%", "missed" );
+
+    for( x = 0; x < dumpMAX_TASKS; x++ )
+    {
+        const DumpRecord_t * const pxRecord = &( pxDump->xTasks[ x ] );
+        char cDeadline[ 16 ] = "-", cWake[ 16 ] = "-", cLoad[ 16 ] = "-";
+
+        if( ( pxDump->iKnown[ x ] == 0 ) || ( ( pxDump->iChangedOnlyOutput != 0 ) && ( pxDump->iChanged[ x ] == 0 ) ) )
+        {
+            continue;
+        }
+
+        snprintf( cNumber, sizeof( cNumber ), "Task %d", x );
+
+        if( pxRecord->ulDeadline != 0 )
+        {
+            snprintf( cDeadline, sizeof( cDeadline ), "%lu", ( unsigned long ) pxRecord->ulDeadline );
+        }
+
+        if( pxRecord->ulWakeTime != 0 )
+        {
+            snprintf( cWake, sizeof( cWake ), "%lu", ( unsigned long ) pxRecord->ulWakeTime );
+        }
+
+        if( ( pxDump->iHavePrevious != 0 ) && ( pxDump->iHavePreviousRunTime[ x ] != 0 ) && ( ulElapsed != 0 ) )
+        {
+            snprintf( cLoad, sizeof( cLoad ), "%.2f", ( 100.0 * ( double ) ( uint32_t ) ( pxRecord->ulRunTime - pxDump->ulPreviousRunTime[ x ] ) ) / ( double ) ulElapsed );
+        }
+
+        printf( "%c %-20s %-9s %7lu %10s %10s %12.3f %7s %7lu\n",
+                ( pxDump->iChanged[ x ] != 0 ) ? '*' : ' ',
+                ( pxDump->pcTaskNames[ x ] != NULL ) ? pxDump->pcTaskNames[ x ] : cNumber,
+                prvStateName( pxRecord->ulState & dumpSTATE_MASK ),
+                ( unsigned long ) pxRecord->ulPeriod, cDeadline, cWake,
+                ( ( double ) pxRecord->ulRunTime * 1000.0 ) / pxDump->dCountsPerSecond,
+                cLoad, ( unsigned long ) pxRecord->ulMissedDeadlines );
+    }
+
+    printf( "\n" );
+
+    for( x = 0; x < dumpMAX_TASKS; x++ )
+    {
+        if( pxDump->iKnown[ x ] != 0 )
+        {
+            pxDump->ulPreviousRunTime[ x ] = pxDump->xTasks[ x ].ulRunTime;
+            pxDump->iHavePreviousRunTime[ x ] = 1;
+        }
+    }
+
+    pxDump->ulPreviousTime = ulTime;
+    pxDump->iHavePrevious = 1;
+}
+/*-----------------------------------------------------------*/
+
+/* Decode the snapshot at pucSnapshot, returning the number of bytes it takes
+ * or 0 if it does not fit in the xLength bytes left. */
+static size_t prvSnapshot( Dump_t * pxDump,
+                           const uint8_t * pucSnapshot,
+                           size_t xLength )
+{
+    const uint32_t ulSequence = prvWord( pucSnapshot + 4 );
+    const uint32_t ulTickCount = prvWord( pucSnapshot + 8 );
+    const uint32_t ulTime = prvWord( pucSnapshot + 12 );
+    const uint32_t ulTasks = prvWord( pucSnapshot + 16 );
+    const uint32_t ulChanged = prvWord( pucSnapshot + 20 );
+    const uint32_t ulRecords = ( pxDump->iChangedOnlyInput != 0 ) ? ulChanged : ulTasks;
+    const size_t xSize = ( dumpHEADER_WORDS + ( ( size_t ) ulRecords * dumpRECORD_WORDS ) ) * 4;
+    uint32_t ulRecord;
+    int x;
+
+    if( ( ulRecords > dumpMAX_TASKS ) || ( xSize > xLength ) )
+    {
+        return 0;
+    }
+
+    for( x = 0; x < dumpMAX_TASKS; x++ )
+    {
+        pxDump->iChanged[ x ] = 0;
+
+        /* A full snapshot lists every task there is. */
+        if( pxDump->iChangedOnlyInput == 0 )
+        {
+            pxDump->iKnown[ x ] = 0;
+        }
+    }
+
+    for( ulRecord = 0; ulRecord < ulRecords; ulRecord++ )
+    {
+        const uint8_t * const pucRecord = pucSnapshot + ( ( dumpHEADER_WORDS + ( ulRecord * dumpRECORD_WORDS ) ) * 4 );
+        const uint32_t ulNumber = prvWord( pucRecord );
+        DumpRecord_t * pxRecord;
+
+        if( ulNumber >= dumpMAX_TASKS )
+        {
+            fprintf( stderr, "snapshot %lu: task number %lu out of range\n", ( unsigned long ) ulSequence, ( unsigned long ) ulNumber );
+            continue;
+        }
+
+        pxRecord = &( pxDump->xTasks[ ulNumber ] );
+        pxRecord->ulTaskNumber = ulNumber;
+        pxRecord->ulState = prvWord( pucRecord + 4 );
+        pxRecord->ulPeriod = prvWord( pucRecord + 8 );
+        pxRecord->ulDeadline = prvWord( pucRecord + 12 );
+        pxRecord->ulWakeTime = prvWord( pucRecord + 16 );
+        pxRecord->ulRunTime = prvWord( pucRecord + 20 );
+        pxRecord->ulMissedDeadlines = prvWord( pucRecord + 24 );
+        pxDump->iKnown[ ulNumber ] = 1;
+        pxDump->iChanged[ ulNumber ] = ( ( pxRecord->ulState & dumpCHANGED ) != 0 ) ? 1 : 0;
+    }
+
+    prvPrintSnapshot( pxDump, ulSequence, ulTickCount, ulTime, ( unsigned long ) ulChanged, ( unsigned long ) ulTasks );
+    pxDump->ulSnapshots++;
+
+    return xSize;
+}
+/*-----------------------------------------------------------*/
+
+int main( int argc,
+          char ** argv )
+{
+    static Dump_t xDump;
+    uint8_t * pucInput = NULL;
+    size_t xLength = 0, xSize = 0, xRead, xOffset, xTaken;
+    int iArg, iNumber;
+    FILE * pxInput = stdin;
+
+    xDump.dCountsPerSecond = 59940.0;
+
+    for( iArg = 1; iArg < argc; iArg++ )
+    {
+        const char * const pcOption = argv[ iArg ];
+
+        if( strcmp( pcOption, "-c" ) == 0 )
+        {
+            xDump.iChangedOnlyInput = 1;
+        }
+        else if( strcmp( pcOption, "-o" ) == 0 )
+        {
+            xDump.iChangedOnlyOutput = 1;
+        }
+        else if( ( strcmp( pcOption, "-f" ) == 0 ) && ( iArg + 1 < argc ) )
+        {
+            xDump.dCountsPerSecond = atof( argv[ ++iArg ] );
+        }
+        else if( ( strcmp( pcOption, "-t" ) == 0 ) && ( iArg + 1 < argc ) && ( sscanf( argv[ iArg + 1 ], "%d=", &iNumber ) == 1 ) &&
+                 ( iNumber >= 0 ) && ( iNumber < dumpMAX_TASKS ) && ( strchr( argv[ iArg + 1 ], '=' ) != NULL ) )
+        {
+            xDump.pcTaskNames[ iNumber ] = strchr( argv[ ++iArg ], '=' ) + 1;
+        }
+        else if( ( pcOption[ 0 ] != '-' ) && ( pxInput == stdin ) )
+        {
+            pxInput = fopen( pcOption, "rb" );
+
+            if( pxInput == NULL )
+            {
+                perror( pcOption );
+                return 1;
+            }
+        }
+        else
+        {
+            fprintf( stderr, "usage: %s [-c] [-o] [-f hz] [-t number=name]... [snapshots]\n", argv[ 0 ] );
+            return 1;
+        }
+    }
+
+    if( xDump.dCountsPerSecond <= 0.0 )
+    {
+        fprintf( stderr, "the run time counter frequency must be positive\n" );
+        return 1;
+    }
+
+    /* Snapshots are small, so the whole input is read before decoding. */
+    do
+    {
+        if( xLength == xSize )
+        {
+            xSize = ( xSize == 0 ) ? 65536 : ( xSize * 2 );
+            pucInput = realloc( pucInput, xSize );
+
+            if( pucInput == NULL )
+            {
+                fprintf( stderr, "out of memory\n" );
+                return 1;
+            }
+        }
+
+        xRead = fread( pucInput + xLength, 1, xSize - xLength, pxInput );
+        xLength += xRead;
+    } while( xRead > 0 );
+
+    for( xOffset = 0; ( xOffset + ( dumpHEADER_WORDS * 4 ) ) <= xLength; )
+    {
+        xTaken = 0;
+
+        if( prvWord( pucInput + xOffset ) == dumpSNAPSHOT_MAGIC )
+        {
+            xTaken = prvSnapshot( &xDump, pucInput + xOffset, xLength - xOffset );
+        }
+
+        /* Skip the unused records at the end of a memory dump, or a magic
+         * word that was not the start of a snapshot. */
+        xOffset += ( xTaken != 0 ) ? xTaken : 1;
+    }
+
+    if( xDump.ulSnapshots == 0 )
+    {
+        fprintf( stderr, "no snapshot found\n" );
+    }
+
+    if( pxInput != stdin )
+    {
+        fclose( pxInput );
+    }
+
+    free( pucInput );
+
+    return ( xDump.ulSnapshots != 0 ) ? 0 : 1;
+}
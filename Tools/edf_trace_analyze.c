@@ -0,0 +1,924 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - EDF schedule analyzer
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Host side analyzer of the scheduler event stream sent by
+ * xEDFTraceStreamGetByte().  Rebuilds the jobs of every task from a captured
+ * stream and checks that the schedule follows EDF.
+ *
+ * A job is released when its task enters the ready state, and completes when
+ * the task is switched out no longer ready, so jobs must only block at their
+ * end.  The absolute deadline of a job is the tick count at its release plus
+ * the relative deadline given in the task set file, which is what the kernel
+ * should be scheduling by - deadlines the kernel derives differently, such as
+ * from a drifting tick count or a deadline the idle task gives itself, show
+ * up as violations.  For every job the response time, lateness and number of
+ * preemptions are measured.
+ *
+ * A violation is an interval during which a task runs while another task
+ * with an earlier deadline is ready.  Tasks missing from the task set file,
+ * such as the idle task, have no deadline, so any time they run while a job
+ * is ready is a violation.  Non-preemptive regions and preemption thresholds
+ * cause violations by design - they are bounded by the blocking the task set
+ * was admitted with.
+ *
+ * Build and run on the host:
+ *
+ *     cc -std=c99 -O2 -o edf_trace_analyze Tools/edf_trace_analyze.c
+ *     ./edf_trace_analyze -s taskset.txt -g schedule.svg trace.bin
+ *
+ * The task set file has one line per task with its number, as reported in the
+ * xTaskNumber member of TaskStatus_t, its name, and its period and relative
+ * deadline in ticks.  A task without a period has no deadline.  Text after a
+ * # is ignored:
+ *
+ *     # number  name                  period  deadline
+ *     1         Button_1              50      50
+ *     5         Load_1_Simulation     10      10
+ *     9         IDLE
+ *
+ * Options:
+ *     -s file         task set file
+ *     -f hz           run time counter frequency, 59940 by default for T1TC
+ *                     with T1PR = 1000 at 60MHz
+ *     -r hz           tick frequency, 1000 by default
+ *     -a counts       ignore violations lasting no more than this many run
+ *                     time counter increments, 1 by default, which leaves
+ *                     out the time the kernel takes to switch
+ *     -v count        print the first count violations, 10 by default
+ *     -j file         write every job to a CSV file
+ *     -g file         draw the schedule as an SVG Gantt chart
+ *     -w from:to      time window of the chart in milliseconds from the start
+ *                     of the trace, 0:200 by default
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "edf_trace_stream.h"
+
+#define analyzeMAX_TASKS           256
+#define analyzeNO_TASK             ( -1 )
+#define analyzeNO_DEADLINE         UINT64_MAX
+
+/* Gantt chart layout in pixels. */
+#define analyzeCHART_WIDTH         1600
+#define analyzeCHART_LABEL_WIDTH   160
+#define analyzeCHART_ROW_HEIGHT    24
+#define analyzeCHART_AXIS_HEIGHT   30
+
+typedef struct xANALYZER_TASK
+{
+    char cName[ 32 ];
+    int iSeen;                   /* The task appears in the trace. */
+    uint32_t ulPeriod;           /* In ticks, 0 if the task has no deadline. */
+    uint32_t ulDeadline;         /* Relative deadline in ticks. */
+    int iReady;
+    int iJobActive;              /* A job was released and has not completed. */
+    int iJobStarted;             /* The active job has run. */
+    uint64_t ullRelease;         /* Release time of the active job. */
+    uint64_t ullStart;           /* Time the active job first ran. */
+    uint64_t ullReleaseTick;     /* Tick count at the release of the active job. */
+    uint64_t ullDeadlineTick;    /* Absolute deadline of the active job in ticks, analyzeNO_DEADLINE if none. */
+    uint64_t ullDeadline;        /* Absolute deadline of the active job in run time counter increments. */
+    uint32_t ulJobPreemptions;   /* Preemptions of the active job. */
+    int iHavePreviousRelease;
+    uint64_t ullPreviousReleaseTick;
+
+    /* Statistics over all completed jobs. */
+    unsigned long ulJobs;
+    unsigned long ulMissed;
+    unsigned long ulOffPeriodReleases; /* Releases not one period after the previous release. */
+    uint64_t ullResponseMin;
+    uint64_t ullResponseMax;
+    double dResponseSum;
+    int64_t llLatenessMax;
+    unsigned long ulPreemptions;
+    uint32_t ulPreemptionsMax;
+    uint64_t ullRunTime;
+} AnalyzerTask_t;
+
+/* Something drawn on the Gantt chart. */
+typedef enum
+{
+    eChartRun,
+    eChartRelease,
+    eChartDeadline,
+    eChartMissedDeadline,
+    eChartViolation
+} eChartItemType;
+
+typedef struct xCHART_ITEM
+{
+    eChartItemType eType;
+    int iTask;
+    uint64_t ullStart;
+    uint64_t ullEnd;
+} ChartItem_t;
+
+typedef struct xANALYZER
+{
+    AnalyzerTask_t xTasks[ analyzeMAX_TASKS ];
+    int iReadyTasks[ analyzeMAX_TASKS ];
+    int iReadyCount;
+    int iRunning;                /* Task switched in last, or analyzeNO_TASK. */
+    uint64_t ullRunStart;        /* Time iRunning was switched in. */
+    uint64_t ullTicks;           /* Ticks since the start of the trace. */
+    uint64_t ullLastTickTime;
+    int iHaveTick;
+    int iHaveTime;
+    uint64_t ullFirstTime;
+    uint64_t ullLastTime;
+    double dCountsPerSecond;
+    double dCountsPerTick;
+    uint64_t ullAllowance;
+    unsigned long ulQueueEvents;
+    unsigned long ulDroppedEvents;
+    unsigned long ulLostPeriods;
+
+    /* The violation in progress. */
+    int iInverted;
+    uint64_t ullInversionStart;
+    int iInversionRunning;
+    int iInversionWaiting;
+
+    unsigned long ulViolations;
+    unsigned long ulViolationsToPrint;
+    uint64_t ullViolationTime;
+    uint64_t ullViolationMax;
+
+    FILE * pxJobs;
+
+    /* Chart items within the window. */
+    int iChart;
+    uint64_t ullChartFrom;       /* Window relative to the start of the trace. */
+    uint64_t ullChartTo;
+    ChartItem_t * pxChartItems;
+    size_t xChartCount;
+    size_t xChartSize;
+} Analyzer_t;
+
+/*-----------------------------------------------------------*/
+
+static double prvMilliseconds( const Analyzer_t * pxAnalyzer,
+                               double dCounts )
+{
+    return ( dCounts * 1000.0 ) / pxAnalyzer->dCountsPerSecond;
+}
+/*-----------------------------------------------------------*/
+
+/* Time of ullTime in milliseconds from the start of the trace. */
+static double prvTraceMilliseconds( const Analyzer_t * pxAnalyzer,
+                                    uint64_t ullTime )
+{
+    return prvMilliseconds( pxAnalyzer, ( double ) ( ullTime - pxAnalyzer->ullFirstTime ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvChart( Analyzer_t * pxAnalyzer,
+                      eChartItemType eType,
+                      int iTask,
+                      uint64_t ullStart,
+                      uint64_t ullEnd )
+{
+    const uint64_t ullFrom = pxAnalyzer->ullFirstTime + pxAnalyzer->ullChartFrom;
+    const uint64_t ullTo = pxAnalyzer->ullFirstTime + pxAnalyzer->ullChartTo;
+
+    if( ( pxAnalyzer->iChart != 0 ) && ( ullEnd >= ullFrom ) && ( ullStart <= ullTo ) )
+    {
+        if( pxAnalyzer->xChartCount == pxAnalyzer->xChartSize )
+        {
+            pxAnalyzer->xChartSize = ( pxAnalyzer->xChartSize == 0 ) ? 1024 : ( pxAnalyzer->xChartSize * 2 );
+            pxAnalyzer->pxChartItems = realloc( pxAnalyzer->pxChartItems, pxAnalyzer->xChartSize * sizeof( ChartItem_t ) );
+
+            if( pxAnalyzer->pxChartItems == NULL )
+            {
+                fprintf( stderr, "out of memory\n" );
+                exit( 1 );
+            }
+        }
+
+        pxAnalyzer->pxChartItems[ pxAnalyzer->xChartCount ].eType = eType;
+        pxAnalyzer->pxChartItems[ pxAnalyzer->xChartCount ].iTask = iTask;
+        pxAnalyzer->pxChartItems[ pxAnalyzer->xChartCount ].ullStart = ullStart;
+        pxAnalyzer->pxChartItems[ pxAnalyzer->xChartCount ].ullEnd = ullEnd;
+        pxAnalyzer->xChartCount++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetReady( Analyzer_t * pxAnalyzer,
+                         int iTask,
+                         int iReady )
+{
+    AnalyzerTask_t * const pxTask = &( pxAnalyzer->xTasks[ iTask ] );
+    int x;
+
+    if( ( iReady != 0 ) && ( pxTask->iReady == 0 ) )
+    {
+        pxAnalyzer->iReadyTasks[ pxAnalyzer->iReadyCount++ ] = iTask;
+    }
+    else if( ( iReady == 0 ) && ( pxTask->iReady != 0 ) )
+    {
+        for( x = 0; x < pxAnalyzer->iReadyCount; x++ )
+        {
+            if( pxAnalyzer->iReadyTasks[ x ] == iTask )
+            {
+                pxAnalyzer->iReadyTasks[ x ] = pxAnalyzer->iReadyTasks[ --pxAnalyzer->iReadyCount ];
+                break;
+            }
+        }
+    }
+
+    pxTask->iReady = iReady;
+}
+/*-----------------------------------------------------------*/
+
+static void prvReleaseJob( Analyzer_t * pxAnalyzer,
+                           int iTask,
+                           uint64_t ullTime )
+{
+    AnalyzerTask_t * const pxTask = &( pxAnalyzer->xTasks[ iTask ] );
+    const uint64_t ullTickTime = ( pxAnalyzer->iHaveTick != 0 ) ? pxAnalyzer->ullLastTickTime : ullTime;
+
+    pxTask->iJobActive = 1;
+    pxTask->iJobStarted = 0;
+    pxTask->ulJobPreemptions = 0;
+    pxTask->ullRelease = ullTime;
+    pxTask->ullReleaseTick = pxAnalyzer->ullTicks;
+
+    if( pxTask->ulPeriod != 0 )
+    {
+        pxTask->ullDeadlineTick = pxAnalyzer->ullTicks + pxTask->ulDeadline;
+        pxTask->ullDeadline = ullTickTime + ( uint64_t ) ( ( double ) pxTask->ulDeadline * pxAnalyzer->dCountsPerTick );
+
+        if( ( pxTask->iHavePreviousRelease != 0 ) && ( ( pxAnalyzer->ullTicks - pxTask->ullPreviousReleaseTick ) != pxTask->ulPeriod ) )
+        {
+            pxTask->ulOffPeriodReleases++;
+        }
+
+        pxTask->iHavePreviousRelease = 1;
+        pxTask->ullPreviousReleaseTick = pxAnalyzer->ullTicks;
+        prvChart( pxAnalyzer, eChartRelease, iTask, ullTime, ullTime );
+    }
+    else
+    {
+        pxTask->ullDeadlineTick = analyzeNO_DEADLINE;
+        pxTask->ullDeadline = analyzeNO_DEADLINE;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvCompleteJob( Analyzer_t * pxAnalyzer,
+                            int iTask,
+                            uint64_t ullTime )
+{
+    AnalyzerTask_t * const pxTask = &( pxAnalyzer->xTasks[ iTask ] );
+    const uint64_t ullResponse = ullTime - pxTask->ullRelease;
+    int64_t llLateness = 0;
+
+    pxTask->iJobActive = 0;
+
+    if( pxTask->ulPeriod == 0 )
+    {
+        return;
+    }
+
+    llLateness = ( int64_t ) ullTime - ( int64_t ) pxTask->ullDeadline;
+
+    if( ( pxTask->ulJobs == 0 ) || ( ullResponse < pxTask->ullResponseMin ) )
+    {
+        pxTask->ullResponseMin = ullResponse;
+    }
+
+    if( ( pxTask->ulJobs == 0 ) || ( llLateness > pxTask->llLatenessMax ) )
+    {
+        pxTask->llLatenessMax = llLateness;
+    }
+
+    if( ullResponse > pxTask->ullResponseMax )
+    {
+        pxTask->ullResponseMax = ullResponse;
+    }
+
+    if( pxTask->ulJobPreemptions > pxTask->ulPreemptionsMax )
+    {
+        pxTask->ulPreemptionsMax = pxTask->ulJobPreemptions;
+    }
+
+    pxTask->dResponseSum += ( double ) ullResponse;
+    pxTask->ulPreemptions += pxTask->ulJobPreemptions;
+    pxTask->ulJobs++;
+
+    if( llLateness > 0 )
+    {
+        pxTask->ulMissed++;
+    }
+
+    prvChart( pxAnalyzer, ( llLateness > 0 ) ? eChartMissedDeadline : eChartDeadline, iTask, pxTask->ullDeadline, pxTask->ullDeadline );
+
+    if( pxAnalyzer->pxJobs != NULL )
+    {
+        fprintf( pxAnalyzer->pxJobs, "%s,%lu,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%lu\n",
+                 pxTask->cName, pxTask->ulJobs,
+                 prvTraceMilliseconds( pxAnalyzer, pxTask->ullRelease ),
+                 prvTraceMilliseconds( pxAnalyzer, ( pxTask->iJobStarted != 0 ) ? pxTask->ullStart : ullTime ),
+                 prvTraceMilliseconds( pxAnalyzer, ullTime ),
+                 prvTraceMilliseconds( pxAnalyzer, pxTask->ullDeadline ),
+                 prvMilliseconds( pxAnalyzer, ( double ) ullResponse ),
+                 prvMilliseconds( pxAnalyzer, ( double ) llLateness ),
+                 ( unsigned long ) pxTask->ulJobPreemptions );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvDeadlineTick( const Analyzer_t * pxAnalyzer,
+                                 int iTask )
+{
+    const AnalyzerTask_t * const pxTask = &( pxAnalyzer->xTasks[ iTask ] );
+
+    return ( pxTask->iJobActive != 0 ) ? pxTask->ullDeadlineTick : analyzeNO_DEADLINE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvEndInversion( Analyzer_t * pxAnalyzer,
+                             uint64_t ullTime )
+{
+    const uint64_t ullDuration = ullTime - pxAnalyzer->ullInversionStart;
+
+    pxAnalyzer->iInverted = 0;
+
+    if( ullDuration > pxAnalyzer->ullAllowance )
+    {
+        pxAnalyzer->ulViolations++;
+        pxAnalyzer->ullViolationTime += ullDuration;
+
+        if( ullDuration > pxAnalyzer->ullViolationMax )
+        {
+            pxAnalyzer->ullViolationMax = ullDuration;
+        }
+
+        if( pxAnalyzer->ulViolations <= pxAnalyzer->ulViolationsToPrint )
+        {
+            printf( "violation at %.3f ms for %.3f ms: %s ran while %s with an earlier deadline was ready\n",
+                    prvTraceMilliseconds( pxAnalyzer, pxAnalyzer->ullInversionStart ),
+                    prvMilliseconds( pxAnalyzer, ( double ) ullDuration ),
+                    pxAnalyzer->xTasks[ pxAnalyzer->iInversionRunning ].cName,
+                    pxAnalyzer->xTasks[ pxAnalyzer->iInversionWaiting ].cName );
+        }
+
+        prvChart( pxAnalyzer, eChartViolation, pxAnalyzer->iInversionRunning, pxAnalyzer->ullInversionStart, ullTime );
+    }
+}
+/*-----------------------------------------------------------*/
+
+/* Check the EDF invariant after every event - no ready task may have an
+ * earlier deadline than the running task. */
+static void prvCheckInvariant( Analyzer_t * pxAnalyzer,
+                               uint64_t ullTime )
+{
+    uint64_t ullRunning, ullEarliest = analyzeNO_DEADLINE;
+    int x, iEarliest = analyzeNO_TASK;
+
+    if( pxAnalyzer->iRunning == analyzeNO_TASK )
+    {
+        return;
+    }
+
+    ullRunning = prvDeadlineTick( pxAnalyzer, pxAnalyzer->iRunning );
+
+    for( x = 0; x < pxAnalyzer->iReadyCount; x++ )
+    {
+        const int iTask = pxAnalyzer->iReadyTasks[ x ];
+        const uint64_t ullDeadline = prvDeadlineTick( pxAnalyzer, iTask );
+
+        if( ( iTask != pxAnalyzer->iRunning ) && ( ullDeadline < ullEarliest ) )
+        {
+            ullEarliest = ullDeadline;
+            iEarliest = iTask;
+        }
+    }
+
+    if( ullEarliest < ullRunning )
+    {
+        /* A different task running with a later deadline is a separate
+         * violation. */
+        if( ( pxAnalyzer->iInverted != 0 ) && ( pxAnalyzer->iInversionRunning != pxAnalyzer->iRunning ) )
+        {
+            prvEndInversion( pxAnalyzer, ullTime );
+        }
+
+        if( pxAnalyzer->iInverted == 0 )
+        {
+            pxAnalyzer->iInverted = 1;
+            pxAnalyzer->ullInversionStart = ullTime;
+            pxAnalyzer->iInversionRunning = pxAnalyzer->iRunning;
+            pxAnalyzer->iInversionWaiting = iEarliest;
+        }
+    }
+    else if( pxAnalyzer->iInverted != 0 )
+    {
+        prvEndInversion( pxAnalyzer, ullTime );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchOut( Analyzer_t * pxAnalyzer,
+                          uint64_t ullTime )
+{
+    if( pxAnalyzer->iRunning != analyzeNO_TASK )
+    {
+        pxAnalyzer->xTasks[ pxAnalyzer->iRunning ].ullRunTime += ullTime - pxAnalyzer->ullRunStart;
+        prvChart( pxAnalyzer, eChartRun, pxAnalyzer->iRunning, pxAnalyzer->ullRunStart, ullTime );
+        pxAnalyzer->iRunning = analyzeNO_TASK;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvRecord( void * pvContext,
+                       uint64_t ullTime,
+                       int iEvent,
+                       int iNumber )
+{
+    Analyzer_t * pxAnalyzer = ( Analyzer_t * ) pvContext;
+    AnalyzerTask_t * const pxTask = &( pxAnalyzer->xTasks[ iNumber ] );
+
+    if( pxAnalyzer->iHaveTime == 0 )
+    {
+        pxAnalyzer->iHaveTime = 1;
+        pxAnalyzer->ullFirstTime = ullTime;
+    }
+
+    pxAnalyzer->ullLastTime = ullTime;
+
+    switch( iEvent )
+    {
+        case streamEVENT_TICK:
+            pxAnalyzer->ullTicks++;
+            pxAnalyzer->ullLastTickTime = ullTime;
+            pxAnalyzer->iHaveTick = 1;
+            break;
+
+        case streamEVENT_MOVED_TO_READY:
+            pxTask->iSeen = 1;
+
+            /* A task already ready is only being moved within the ready
+             * list. */
+            if( pxTask->iReady == 0 )
+            {
+                prvSetReady( pxAnalyzer, iNumber, 1 );
+
+                if( pxTask->iJobActive == 0 )
+                {
+                    prvReleaseJob( pxAnalyzer, iNumber, ullTime );
+                }
+            }
+
+            break;
+
+        case streamEVENT_LEFT_READY:
+            pxTask->iSeen = 1;
+            prvSetReady( pxAnalyzer, iNumber, 0 );
+
+            if( pxTask->iJobActive != 0 )
+            {
+                prvCompleteJob( pxAnalyzer, iNumber, ullTime );
+            }
+
+            break;
+
+        case streamEVENT_SWITCHED_IN:
+            pxTask->iSeen = 1;
+
+            if( iNumber != pxAnalyzer->iRunning )
+            {
+                if( pxAnalyzer->iRunning != analyzeNO_TASK )
+                {
+                    AnalyzerTask_t * const pxPrevious = &( pxAnalyzer->xTasks[ pxAnalyzer->iRunning ] );
+
+                    if( ( pxPrevious->iReady != 0 ) && ( pxPrevious->iJobActive != 0 ) )
+                    {
+                        pxPrevious->ulJobPreemptions++;
+                    }
+                }
+
+                prvSwitchOut( pxAnalyzer, ullTime );
+                pxAnalyzer->iRunning = iNumber;
+                pxAnalyzer->ullRunStart = ullTime;
+            }
+
+            if( ( pxTask->iJobActive != 0 ) && ( pxTask->iJobStarted == 0 ) )
+            {
+                pxTask->iJobStarted = 1;
+                pxTask->ullStart = ullTime;
+            }
+
+            break;
+
+        default:
+            pxAnalyzer->ulQueueEvents++;
+            break;
+    }
+
+    prvCheckInvariant( pxAnalyzer, ullTime );
+}
+/*-----------------------------------------------------------*/
+
+static void prvLost( void * pvContext,
+                     uint64_t ullTime,
+                     uint32_t ulFrames )
+{
+    Analyzer_t * pxAnalyzer = ( Analyzer_t * ) pvContext;
+    int x;
+
+    ( void ) ulFrames;
+
+    /* Nothing is known about the time since the last good frame, so start
+     * afresh without the jobs in progress.  Ticks were lost too, so deadlines
+     * are only compared between jobs released after the gap. */
+    if( pxAnalyzer->iInverted != 0 )
+    {
+        prvEndInversion( pxAnalyzer, pxAnalyzer->ullLastTime );
+    }
+
+    prvSwitchOut( pxAnalyzer, pxAnalyzer->ullLastTime );
+
+    for( x = 0; x < analyzeMAX_TASKS; x++ )
+    {
+        pxAnalyzer->xTasks[ x ].iReady = 0;
+        pxAnalyzer->xTasks[ x ].iJobActive = 0;
+        pxAnalyzer->xTasks[ x ].iHavePreviousRelease = 0;
+    }
+
+    pxAnalyzer->iReadyCount = 0;
+    pxAnalyzer->iHaveTick = 0;
+    pxAnalyzer->ullLastTime = ullTime;
+    pxAnalyzer->ulLostPeriods++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvDropped( void * pvContext,
+                        uint64_t ullTime,
+                        uint32_t ulEvents )
+{
+    Analyzer_t * pxAnalyzer = ( Analyzer_t * ) pvContext;
+
+    /* The dropped events were lost from the middle of the ring, which is no
+     * better than losing frames. */
+    pxAnalyzer->ulDroppedEvents += ulEvents;
+    prvLost( pvContext, ullTime, 0 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvWriteChart( const Analyzer_t * pxAnalyzer,
+                           FILE * pxFile )
+{
+    static const char * const pcColours[] = { "#4e79a7", "#f28e2b", "#59a14f", "#b07aa1", "#76b7b2", "#edc948", "#ff9da7", "#9c755f" };
+    int iRow[ analyzeMAX_TASKS ];
+    int x, iRows = 0;
+    size_t xItem;
+    const double dFrom = ( double ) pxAnalyzer->ullChartFrom;
+    const double dScale = ( double ) ( analyzeCHART_WIDTH - analyzeCHART_LABEL_WIDTH ) / ( double ) ( pxAnalyzer->ullChartTo - pxAnalyzer->ullChartFrom );
+    const double dFromMilliseconds = prvMilliseconds( pxAnalyzer, dFrom );
+    const double dToMilliseconds = prvMilliseconds( pxAnalyzer, ( double ) pxAnalyzer->ullChartTo );
+
+    for( x = 0; x < analyzeMAX_TASKS; x++ )
+    {
+        iRow[ x ] = ( pxAnalyzer->xTasks[ x ].iSeen != 0 ) ? iRows++ : -1;
+    }
+
+    fprintf( pxFile, "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"%d\" height=\"%d\" font-family=\"monospace\" font-size=\"12\">\n",
+             analyzeCHART_WIDTH, ( iRows * analyzeCHART_ROW_HEIGHT ) + analyzeCHART_AXIS_HEIGHT );
+
+    for( x = 0; x < analyzeMAX_TASKS; x++ )
+    {
+        if( iRow[ x ] >= 0 )
+        {
+            fprintf( pxFile, "<text x=\"4\" y=\"%d\">%s</text>\n", ( iRow[ x ] * analyzeCHART_ROW_HEIGHT ) + 16, pxAnalyzer->xTasks[ x ].cName );
+            fprintf( pxFile, "<line x1=\"%d\" y1=\"%d\" x2=\"%d\" y2=\"%d\" stroke=\"#ddd\"/>\n", analyzeCHART_LABEL_WIDTH, ( iRow[ x ] + 1 ) * analyzeCHART_ROW_HEIGHT,
+                     analyzeCHART_WIDTH, ( iRow[ x ] + 1 ) * analyzeCHART_ROW_HEIGHT );
+        }
+    }
+
+    for( xItem = 0; xItem < pxAnalyzer->xChartCount; xItem++ )
+    {
+        const ChartItem_t * const pxItem = &( pxAnalyzer->pxChartItems[ xItem ] );
+        const int iY = iRow[ pxItem->iTask ] * analyzeCHART_ROW_HEIGHT;
+        double dStart = ( ( ( double ) ( pxItem->ullStart - pxAnalyzer->ullFirstTime ) ) - dFrom ) * dScale;
+        double dEnd = ( ( ( double ) ( pxItem->ullEnd - pxAnalyzer->ullFirstTime ) ) - dFrom ) * dScale;
+
+        if( pxItem->ullStart < pxAnalyzer->ullFirstTime )
+        {
+            dStart = 0.0;
+        }
+
+        dStart = ( dStart < 0.0 ) ? 0.0 : dStart;
+        dEnd = ( dEnd > ( analyzeCHART_WIDTH - analyzeCHART_LABEL_WIDTH ) ) ? ( analyzeCHART_WIDTH - analyzeCHART_LABEL_WIDTH ) : dEnd;
+        dStart += analyzeCHART_LABEL_WIDTH;
+        dEnd += analyzeCHART_LABEL_WIDTH;
+
+        switch( pxItem->eType )
+        {
+            case eChartRun:
+                fprintf( pxFile, "<rect x=\"%.2f\" y=\"%d\" width=\"%.2f\" height=\"%d\" fill=\"%s\"/>\n",
+                         dStart, iY + 6, ( dEnd - dStart < 0.5 ) ? 0.5 : ( dEnd - dStart ), analyzeCHART_ROW_HEIGHT - 8, pcColours[ pxItem->iTask % 8 ] );
+                break;
+
+            case eChartViolation:
+                fprintf( pxFile, "<rect x=\"%.2f\" y=\"%d\" width=\"%.2f\" height=\"3\" fill=\"#e15759\"/>\n",
+                         dStart, iY + 2, ( dEnd - dStart < 1.0 ) ? 1.0 : ( dEnd - dStart ) );
+                break;
+
+            case eChartRelease:
+                fprintf( pxFile, "<path d=\"M%.2f %d l-3 6 h6 z\" fill=\"#333\"/>\n", dStart, iY + 2 );
+                break;
+
+            case eChartDeadline:
+            case eChartMissedDeadline:
+                fprintf( pxFile, "<line x1=\"%.2f\" y1=\"%d\" x2=\"%.2f\" y2=\"%d\" stroke=\"%s\" stroke-width=\"%d\"/>\n",
+                         dStart, iY + 2, dStart, iY + analyzeCHART_ROW_HEIGHT - 2,
+                         ( pxItem->eType == eChartMissedDeadline ) ? "#e15759" : "#333", ( pxItem->eType == eChartMissedDeadline ) ? 2 : 1 );
+                break;
+        }
+    }
+
+    fprintf( pxFile, "<text x=\"%d\" y=\"%d\">%.3f ms</text>\n", analyzeCHART_LABEL_WIDTH, ( iRows * analyzeCHART_ROW_HEIGHT ) + 20, dFromMilliseconds );
+    fprintf( pxFile, "<text x=\"%d\" y=\"%d\" text-anchor=\"end\">%.3f ms</text>\n", analyzeCHART_WIDTH - 4, ( iRows * analyzeCHART_ROW_HEIGHT ) + 20, dToMilliseconds );
+    fprintf( pxFile, "</svg>\n" );
+}
+/*-----------------------------------------------------------*/
+
+static void prvPrintSummary( const Analyzer_t * pxAnalyzer,
+                             const TraceStream_t * pxStream )
+{
+    const double dDuration = ( double ) ( pxAnalyzer->ullLastTime - pxAnalyzer->ullFirstTime );
+    int x;
+
+    printf( "\n%lu records in %lu frames over %.3f ms, %lu corrupt and %lu lost frames, %lu events dropped on the target\n",
+            pxStream->ulRecords, pxStream->ulFrames, prvMilliseconds( pxAnalyzer, dDuration ),
+            pxStream->ulBadFrames, pxStream->ulLostFrames, pxAnalyzer->ulDroppedEvents );
+    printf( "%lu violations of EDF order, %.3f ms in total, longest %.3f ms\n\n",
+            pxAnalyzer->ulViolations, prvMilliseconds( pxAnalyzer, ( double ) pxAnalyzer->ullViolationTime ),
+            prvMilliseconds( pxAnalyzer, ( double ) pxAnalyzer->ullViolationMax ) );
+
+    printf( "%-20s %7s %6s %7s %9s %9s %9s %9s %7s %5s %6s\n",
+            "task", "jobs", "missed", "off-T", "resp min", "resp avg", "resp max", "late max", "preempt", "max", "load%" );
+
+    for( x = 0; x < analyzeMAX_TASKS; x++ )
+    {
+        const AnalyzerTask_t * const pxTask = &( pxAnalyzer->xTasks[ x ] );
+        const double dLoad = ( dDuration > 0.0 ) ? ( ( 100.0 * ( double ) pxTask->ullRunTime ) / dDuration ) : 0.0;
+
+        if( pxTask->iSeen == 0 )
+        {
+            continue;
+        }
+
+        if( pxTask->ulJobs > 0 )
+        {
+            printf( "%-20s %7lu %6lu %7lu %9.3f %9.3f %9.3f %9.3f %7lu %5lu %6.2f\n",
+                    pxTask->cName, pxTask->ulJobs, pxTask->ulMissed, pxTask->ulOffPeriodReleases,
+                    prvMilliseconds( pxAnalyzer, ( double ) pxTask->ullResponseMin ),
+                    prvMilliseconds( pxAnalyzer, pxTask->dResponseSum / ( double ) pxTask->ulJobs ),
+                    prvMilliseconds( pxAnalyzer, ( double ) pxTask->ullResponseMax ),
+                    prvMilliseconds( pxAnalyzer, ( double ) pxTask->llLatenessMax ),
+                    pxTask->ulPreemptions, ( unsigned long ) pxTask->ulPreemptionsMax, dLoad );
+        }
+        else
+        {
+            printf( "%-20s %7s %6s %7s %9s %9s %9s %9s %7s %5s %6.2f\n",
+                    pxTask->cName, "-", "-", "-", "-", "-", "-", "-", "-", "-", dLoad );
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+static int prvReadTaskSet( Analyzer_t * pxAnalyzer,
+                           const char * pcFile )
+{
+    char cLine[ 256 ], cName[ 32 ];
+    int iNumber, iFields, iLine = 0;
+    unsigned long ulPeriod, ulDeadline;
+    FILE * pxFile = fopen( pcFile, "r" );
+
+    if( pxFile == NULL )
+    {
+        perror( pcFile );
+        return 0;
+    }
+
+    while( fgets( cLine, sizeof( cLine ), pxFile ) != NULL )
+    {
+        char * pcComment = strchr( cLine, '#' );
+
+        iLine++;
+
+        if( pcComment != NULL )
+        {
+            *pcComment = '\0';
+        }
+
+        iFields = sscanf( cLine, "%d %31s %lu %lu", &iNumber, cName, &ulPeriod, &ulDeadline );
+
+        if( iFields <= 0 )
+        {
+            continue;
+        }
+
+        if( ( iFields < 2 ) || ( iNumber < 0 ) || ( iNumber >= analyzeMAX_TASKS ) )
+        {
+            fprintf( stderr, "%s:%d: expected number name [period [deadline]]\n", pcFile, iLine );
+            fclose( pxFile );
+            return 0;
+        }
+
+        strcpy( pxAnalyzer->xTasks[ iNumber ].cName, cName );
+        pxAnalyzer->xTasks[ iNumber ].ulPeriod = ( iFields >= 3 ) ? ( uint32_t ) ulPeriod : 0;
+        pxAnalyzer->xTasks[ iNumber ].ulDeadline = ( iFields >= 4 ) ? ( uint32_t ) ulDeadline : ( uint32_t ) ulPeriod;
+    }
+
+    fclose( pxFile );
+
+    return 1;
+}
+/*-----------------------------------------------------------*/
+
+int main( int argc,
+          char ** argv )
+{
+    static const TraceStreamCallbacks_t xCallbacks = { prvRecord, prvLost, prvDropped };
+    static Analyzer_t xAnalyzer;
+    static TraceStream_t xStream;
+    static uint8_t ucBuffer[ 1 << 16 ];
+    const char * pcTaskSet = NULL;
+    const char * pcChart = NULL;
+    const char * pcJobs = NULL;
+    double dTickRate = 1000.0, dFrom = 0.0, dTo = 200.0;
+    size_t xRead;
+    int x, iArg;
+    FILE * pxInput = stdin;
+
+    xAnalyzer.dCountsPerSecond = 59940.0;
+    xAnalyzer.ullAllowance = 1;
+    xAnalyzer.ulViolationsToPrint = 10;
+    xAnalyzer.iRunning = analyzeNO_TASK;
+
+    for( x = 0; x < analyzeMAX_TASKS; x++ )
+    {
+        snprintf( xAnalyzer.xTasks[ x ].cName, sizeof( xAnalyzer.xTasks[ x ].cName ), "Task %d", x );
+    }
+
+    for( iArg = 1; iArg < argc; iArg++ )
+    {
+        const char * const pcOption = argv[ iArg ];
+        const char * const pcValue = ( iArg + 1 < argc ) ? argv[ iArg + 1 ] : NULL;
+
+        if( ( pcOption[ 0 ] == '-' ) && ( pcOption[ 1 ] != '\0' ) && ( pcOption[ 2 ] == '\0' ) && ( pcValue != NULL ) &&
+            ( strchr( "sfravjgw", pcOption[ 1 ] ) != NULL ) )
+        {
+            iArg++;
+
+            switch( pcOption[ 1 ] )
+            {
+                case 's': pcTaskSet = pcValue; break;
+                case 'f': xAnalyzer.dCountsPerSecond = atof( pcValue ); break;
+                case 'r': dTickRate = atof( pcValue ); break;
+                case 'a': xAnalyzer.ullAllowance = strtoull( pcValue, NULL, 0 ); break;
+                case 'v': xAnalyzer.ulViolationsToPrint = strtoul( pcValue, NULL, 0 ); break;
+                case 'j': pcJobs = pcValue; break;
+                case 'g': pcChart = pcValue; break;
+                case 'w':
+
+                    if( sscanf( pcValue, "%lf:%lf", &dFrom, &dTo ) != 2 )
+                    {
+                        dTo = -1.0;
+                    }
+
+                    break;
+            }
+        }
+        else if( ( pcOption[ 0 ] != '-' ) && ( pxInput == stdin ) )
+        {
+            pxInput = fopen( pcOption, "rb" );
+
+            if( pxInput == NULL )
+            {
+                perror( pcOption );
+                return 1;
+            }
+        }
+        else
+        {
+            pcTaskSet = NULL;
+            break;
+        }
+    }
+
+    if( ( pcTaskSet == NULL ) || ( xAnalyzer.dCountsPerSecond <= 0.0 ) || ( dTickRate <= 0.0 ) || ( dFrom < 0.0 ) || ( dTo <= dFrom ) )
+    {
+        fprintf( stderr, "usage: %s -s taskset [-f hz] [-r hz] [-a counts] [-v count] [-j jobs.csv] [-g chart.svg] [-w from:to] [stream]\n", argv[ 0 ] );
+        return 1;
+    }
+
+    if( prvReadTaskSet( &xAnalyzer, pcTaskSet ) == 0 )
+    {
+        return 1;
+    }
+
+    xAnalyzer.dCountsPerTick = xAnalyzer.dCountsPerSecond / dTickRate;
+
+    if( pcJobs != NULL )
+    {
+        xAnalyzer.pxJobs = fopen( pcJobs, "w" );
+
+        if( xAnalyzer.pxJobs == NULL )
+        {
+            perror( pcJobs );
+            return 1;
+        }
+
+        fprintf( xAnalyzer.pxJobs, "task,job,release_ms,start_ms,completion_ms,deadline_ms,response_ms,lateness_ms,preemptions\n" );
+    }
+
+    if( pcChart != NULL )
+    {
+        xAnalyzer.iChart = 1;
+        xAnalyzer.ullChartFrom = ( uint64_t ) ( ( dFrom * xAnalyzer.dCountsPerSecond ) / 1000.0 );
+        xAnalyzer.ullChartTo = ( uint64_t ) ( ( dTo * xAnalyzer.dCountsPerSecond ) / 1000.0 );
+
+        if( xAnalyzer.ullChartTo <= xAnalyzer.ullChartFrom )
+        {
+            xAnalyzer.ullChartTo = xAnalyzer.ullChartFrom + 1;
+        }
+    }
+
+    vTraceStreamInit( &xStream, &xCallbacks, &xAnalyzer );
+
+    while( ( xRead = fread( ucBuffer, 1, sizeof( ucBuffer ), pxInput ) ) > 0 )
+    {
+        vTraceStreamFeed( &xStream, ucBuffer, xRead );
+    }
+
+    if( xAnalyzer.iInverted != 0 )
+    {
+        prvEndInversion( &xAnalyzer, xAnalyzer.ullLastTime );
+    }
+
+    prvSwitchOut( &xAnalyzer, xAnalyzer.ullLastTime );
+    prvPrintSummary( &xAnalyzer, &xStream );
+
+    if( pcChart != NULL )
+    {
+        FILE * pxChart = fopen( pcChart, "w" );
+
+        if( pxChart == NULL )
+        {
+            perror( pcChart );
+            return 1;
+        }
+
+        prvWriteChart( &xAnalyzer, pxChart );
+        fclose( pxChart );
+    }
+
+    if( xAnalyzer.pxJobs != NULL )
+    {
+        fclose( xAnalyzer.pxJobs );
+    }
+
+    if( pxInput != stdin )
+    {
+        fclose( pxInput );
+    }
+
+    free( xAnalyzer.pxChartItems );
+
+    return 0;
+}
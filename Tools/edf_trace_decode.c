@@ -0,0 +1,310 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - EDF trace stream decoder
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Host side decoder of the scheduler event stream sent by
+ * xEDFTraceStreamGetByte(), see Src/edf_trace.h for the format.  Reads a
+ * captured stream and writes a trace in the Chrome JSON trace event format,
+ * which Perfetto (https://ui.perfetto.dev) and chrome://tracing open.  Every
+ * task is a thread of the "Tasks" process with a slice for each time it ran
+ * and instant events each time it entered or left the ready state, and every
+ * queue is a thread of the "Queues" process with an instant event for each
+ * send and receive.
+ *
+ * Build and run on the host:
+ *
+ *     cc -std=c99 -O2 -o edf_trace_decode Tools/edf_trace_decode.c
+ *     stty -F /dev/ttyUSB0 115200 raw
+ *     cat /dev/ttyUSB0 > trace.bin
+ *     ./edf_trace_decode -t 1=Button_1 -t 2=Button_2 trace.bin > trace.json
+ *
+ * Options:
+ *     -f hz           run time counter frequency, 59940 by default for T1TC
+ *                     with T1PR = 1000 at 60MHz
+ *     -k              also output an instant event for every tick
+ *     -t number=name  name task number, repeated for each task
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "edf_trace_stream.h"
+
+#define decodeMAX_TASKS        256
+#define decodePID_TASKS        1
+#define decodePID_QUEUES       2
+#define decodeNO_TASK          ( -1 )
+
+typedef struct xDECODER
+{
+    double dCountsPerSecond;
+    int iTicks;
+    const char * pcTaskNames[ decodeMAX_TASKS ];
+    int iTaskNamed[ decodeMAX_TASKS ];  /* Thread name metadata written. */
+    int iQueueNamed[ decodeMAX_TASKS ];
+    int iRunning;                       /* Task with an open slice, or decodeNO_TASK. */
+    uint64_t ullTime;                   /* Time of the last event written. */
+    unsigned long ulEvents;
+} Decoder_t;
+
+/*-----------------------------------------------------------*/
+
+static void prvEvent( Decoder_t * pxDecoder,
+                      const char * pcJson )
+{
+    printf( "%s\n%s", ( pxDecoder->ulEvents == 0 ) ? "" : ",", pcJson );
+    pxDecoder->ulEvents++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvNameThread( Decoder_t * pxDecoder,
+                           int iPid,
+                           int iNumber )
+{
+    char cJson[ 256 ];
+    int * piNamed = ( iPid == decodePID_TASKS ) ? pxDecoder->iTaskNamed : pxDecoder->iQueueNamed;
+
+    if( piNamed[ iNumber ] == 0 )
+    {
+        piNamed[ iNumber ] = 1;
+
+        if( ( iPid == decodePID_TASKS ) && ( pxDecoder->pcTaskNames[ iNumber ] != NULL ) )
+        {
+            snprintf( cJson, sizeof( cJson ), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                      iPid, iNumber, pxDecoder->pcTaskNames[ iNumber ] );
+        }
+        else
+        {
+            snprintf( cJson, sizeof( cJson ), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"%s %d\"}}",
+                      iPid, iNumber, ( iPid == decodePID_TASKS ) ? "Task" : "Queue", iNumber );
+        }
+
+        prvEvent( pxDecoder, cJson );
+    }
+}
+/*-----------------------------------------------------------*/
+
+/* Write an event of phase pcPhase at the current time, on thread iNumber of
+ * process iPid, or with global scope if iPid is 0. */
+static void prvTimedEvent( Decoder_t * pxDecoder,
+                           int iPid,
+                           int iNumber,
+                           const char * pcName,
+                           const char * pcPhase )
+{
+    char cJson[ 256 ];
+    const double dMicroseconds = ( ( double ) pxDecoder->ullTime * 1000000.0 ) / pxDecoder->dCountsPerSecond;
+
+    if( iPid == 0 )
+    {
+        snprintf( cJson, sizeof( cJson ), "{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"g\",\"pid\":%d,\"tid\":0,\"ts\":%.3f}",
+                  pcName, decodePID_TASKS, dMicroseconds );
+    }
+    else
+    {
+        prvNameThread( pxDecoder, iPid, iNumber );
+        snprintf( cJson, sizeof( cJson ), "{\"name\":\"%s\",\"ph\":\"%s\",%s\"pid\":%d,\"tid\":%d,\"ts\":%.3f}",
+                  pcName, pcPhase, ( strcmp( pcPhase, "i" ) == 0 ) ? "\"s\":\"t\"," : "", iPid, iNumber, dMicroseconds );
+    }
+
+    prvEvent( pxDecoder, cJson );
+}
+/*-----------------------------------------------------------*/
+
+static void prvCloseSlice( Decoder_t * pxDecoder )
+{
+    if( pxDecoder->iRunning != decodeNO_TASK )
+    {
+        prvTimedEvent( pxDecoder, decodePID_TASKS, pxDecoder->iRunning, "running", "E" );
+        pxDecoder->iRunning = decodeNO_TASK;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvRecord( void * pvContext,
+                       uint64_t ullTime,
+                       int iEvent,
+                       int iNumber )
+{
+    Decoder_t * pxDecoder = ( Decoder_t * ) pvContext;
+
+    pxDecoder->ullTime = ullTime;
+
+    switch( iEvent )
+    {
+        case streamEVENT_SWITCHED_IN:
+            prvCloseSlice( pxDecoder );
+            prvTimedEvent( pxDecoder, decodePID_TASKS, iNumber, "running", "B" );
+            pxDecoder->iRunning = iNumber;
+            break;
+
+        case streamEVENT_MOVED_TO_READY:
+            prvTimedEvent( pxDecoder, decodePID_TASKS, iNumber, "ready", "i" );
+            break;
+
+        case streamEVENT_LEFT_READY:
+            prvTimedEvent( pxDecoder, decodePID_TASKS, iNumber, "blocked", "i" );
+            break;
+
+        case streamEVENT_TICK:
+
+            if( pxDecoder->iTicks != 0 )
+            {
+                prvTimedEvent( pxDecoder, 0, 0, "tick", "i" );
+            }
+
+            break;
+
+        case streamEVENT_QUEUE_SEND:
+            prvTimedEvent( pxDecoder, decodePID_QUEUES, iNumber, "send", "i" );
+            break;
+
+        case streamEVENT_QUEUE_RECEIVE:
+            prvTimedEvent( pxDecoder, decodePID_QUEUES, iNumber, "receive", "i" );
+            break;
+
+        default:
+            break;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvLost( void * pvContext,
+                     uint64_t ullTime,
+                     uint32_t ulFrames )
+{
+    Decoder_t * pxDecoder = ( Decoder_t * ) pvContext;
+
+    ( void ) ulFrames;
+
+    /* Nothing is known about the time since the last good frame. */
+    prvCloseSlice( pxDecoder );
+    pxDecoder->ullTime = ullTime;
+    prvTimedEvent( pxDecoder, 0, 0, "frames lost", "i" );
+}
+/*-----------------------------------------------------------*/
+
+static void prvDropped( void * pvContext,
+                        uint64_t ullTime,
+                        uint32_t ulEvents )
+{
+    Decoder_t * pxDecoder = ( Decoder_t * ) pvContext;
+    char cName[ 64 ];
+
+    pxDecoder->ullTime = ullTime;
+    snprintf( cName, sizeof( cName ), "%lu events dropped", ( unsigned long ) ulEvents );
+    prvTimedEvent( pxDecoder, 0, 0, cName, "i" );
+}
+/*-----------------------------------------------------------*/
+
+int main( int argc,
+          char ** argv )
+{
+    static const TraceStreamCallbacks_t xCallbacks = { prvRecord, prvLost, prvDropped };
+    static Decoder_t xDecoder;
+    static TraceStream_t xStream;
+    static uint8_t ucBuffer[ 65536 ];
+    size_t xRead;
+    int iArg;
+    FILE * pxInput = stdin;
+
+    xDecoder.dCountsPerSecond = 59940.0;
+    xDecoder.iRunning = decodeNO_TASK;
+
+    for( iArg = 1; iArg < argc; iArg++ )
+    {
+        if( ( strcmp( argv[ iArg ], "-f" ) == 0 ) && ( iArg + 1 < argc ) )
+        {
+            xDecoder.dCountsPerSecond = atof( argv[ ++iArg ] );
+        }
+        else if( strcmp( argv[ iArg ], "-k" ) == 0 )
+        {
+            xDecoder.iTicks = 1;
+        }
+        else if( ( strcmp( argv[ iArg ], "-t" ) == 0 ) && ( iArg + 1 < argc ) )
+        {
+            char * pcName = strchr( argv[ ++iArg ], '=' );
+            int iNumber = atoi( argv[ iArg ] );
+
+            if( ( pcName == NULL ) || ( iNumber < 0 ) || ( iNumber >= decodeMAX_TASKS ) )
+            {
+                fprintf( stderr, "%s: expected -t number=name\n", argv[ 0 ] );
+                return 1;
+            }
+
+            xDecoder.pcTaskNames[ iNumber ] = pcName + 1;
+        }
+        else if( ( argv[ iArg ][ 0 ] != '-' ) && ( pxInput == stdin ) )
+        {
+            pxInput = fopen( argv[ iArg ], "rb" );
+
+            if( pxInput == NULL )
+            {
+                perror( argv[ iArg ] );
+                return 1;
+            }
+        }
+        else
+        {
+            fprintf( stderr, "usage: %s [-f hz] [-k] [-t number=name]... [stream]\n", argv[ 0 ] );
+            return 1;
+        }
+    }
+
+    if( xDecoder.dCountsPerSecond <= 0.0 )
+    {
+        fprintf( stderr, "%s: the counter frequency must be positive\n", argv[ 0 ] );
+        return 1;
+    }
+
+    printf( "{\"traceEvents\":[" );
+    prvEvent( &xDecoder, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Tasks\"}}" );
+    prvEvent( &xDecoder, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":2,\"args\":{\"name\":\"Queues\"}}" );
+
+    vTraceStreamInit( &xStream, &xCallbacks, &xDecoder );
+
+    while( ( xRead = fread( ucBuffer, 1, sizeof( ucBuffer ), pxInput ) ) > 0 )
+    {
+        vTraceStreamFeed( &xStream, ucBuffer, xRead );
+    }
+
+    prvCloseSlice( &xDecoder );
+    printf( "\n],\"displayTimeUnit\":\"ms\"}\n" );
+
+    fprintf( stderr, "%lu frames, %lu corrupt, %lu lost, %lu events dropped on the target\n",
+             xStream.ulFrames, xStream.ulBadFrames, xStream.ulLostFrames, ( unsigned long ) xStream.ulDropped );
+
+    if( pxInput != stdin )
+    {
+        fclose( pxInput );
+    }
+
+    return 0;
+}
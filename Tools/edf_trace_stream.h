@@ -0,0 +1,318 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - EDF trace stream parser
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Parser of the scheduler event stream sent by xEDFTraceStreamGetByte(), see
+ * Src/edf_trace.h for the format, shared by the host tools in this directory.
+ * Bytes are fed in as they are read and every record is passed to a callback
+ * with its absolute time in run time counter increments, unwrapped to 64
+ * bits.  Corrupt frames are skipped and the parser resynchronises at the next
+ * frame.  Header only, as every tool is built from a single source file.
+ */
+
+#ifndef EDF_TRACE_STREAM_H
+#define EDF_TRACE_STREAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Events, as eEDFTraceEvent in Src/edf_trace.h. */
+#define streamEVENT_SWITCHED_IN       1
+#define streamEVENT_MOVED_TO_READY    2
+#define streamEVENT_TICK              3
+#define streamEVENT_QUEUE_SEND        4
+#define streamEVENT_QUEUE_RECEIVE     5
+#define streamEVENT_LEFT_READY        6
+
+#define streamMAX_FRAME_LENGTH        256
+
+typedef struct xTRACE_STREAM_CALLBACKS
+{
+    /* A record of event iEvent for task or queue iNumber, 0 for ticks. */
+    void ( * vRecord )( void * pvContext,
+                        uint64_t ullTime,
+                        int iEvent,
+                        int iNumber );
+
+    /* ulFrames frames were lost, so nothing is known about the time up to
+     * ullTime.  May be NULL. */
+    void ( * vLost )( void * pvContext,
+                      uint64_t ullTime,
+                      uint32_t ulFrames );
+
+    /* The target dropped ulEvents events since the previous frame because its
+     * ring was full.  May be NULL. */
+    void ( * vDropped )( void * pvContext,
+                         uint64_t ullTime,
+                         uint32_t ulEvents );
+} TraceStreamCallbacks_t;
+
+typedef struct xTRACE_STREAM
+{
+    const TraceStreamCallbacks_t * pxCallbacks;
+    void * pvContext;
+    uint8_t ucFrame[ streamMAX_FRAME_LENGTH ]; /* Bytes received since the last 0 byte. */
+    size_t xLength;
+    int iOverflow;                             /* The frame being received is too long to be valid. */
+    int iSynchronised;                         /* A frame has been decoded. */
+    uint32_t ulSequence;                       /* Sequence number expected next. */
+    uint32_t ulDropped;                        /* Dropped count of the last frame. */
+    uint64_t ullTime;                          /* Absolute time of the last record. */
+    unsigned long ulFrames;
+    unsigned long ulBadFrames;
+    unsigned long ulLostFrames;
+    unsigned long ulRecords;
+} TraceStream_t;
+
+/*-----------------------------------------------------------*/
+
+static void vTraceStreamInit( TraceStream_t * pxStream,
+                              const TraceStreamCallbacks_t * pxCallbacks,
+                              void * pvContext )
+{
+    static const TraceStream_t xEmpty = { 0 };
+
+    *pxStream = xEmpty;
+    pxStream->pxCallbacks = pxCallbacks;
+    pxStream->pvContext = pvContext;
+}
+/*-----------------------------------------------------------*/
+
+/* Returns 0 if the varint runs past pucEnd. */
+static int prvTraceStreamVarint( const uint8_t ** ppucNext,
+                                 const uint8_t * pucEnd,
+                                 uint64_t * pullValue )
+{
+    uint64_t ullValue = 0;
+    unsigned uShift = 0;
+
+    while( ( *ppucNext < pucEnd ) && ( uShift < 64 ) )
+    {
+        const uint8_t ucByte = **ppucNext;
+
+        ( *ppucNext )++;
+        ullValue |= ( uint64_t ) ( ucByte & 0x7fU ) << uShift;
+
+        if( ( ucByte & 0x80U ) == 0 )
+        {
+            *pullValue = ullValue;
+            return 1;
+        }
+
+        uShift += 7;
+    }
+
+    return 0;
+}
+/*-----------------------------------------------------------*/
+
+/* Returns the length of the decoded frame, or 0 if it is not valid COBS. */
+static size_t prvTraceStreamCobsDecode( const uint8_t * pucFrame,
+                                        size_t xLength,
+                                        uint8_t * pucPayload )
+{
+    size_t xIn = 0, xOut = 0;
+
+    while( xIn < xLength )
+    {
+        const uint8_t ucCode = pucFrame[ xIn ];
+        uint8_t x;
+
+        if( ( ucCode == 0 ) || ( ( xIn + ucCode ) > xLength ) )
+        {
+            return 0;
+        }
+
+        xIn++;
+
+        for( x = 1; x < ucCode; x++ )
+        {
+            pucPayload[ xOut++ ] = pucFrame[ xIn++ ];
+        }
+
+        if( ( ucCode < 0xffU ) && ( xIn < xLength ) )
+        {
+            pucPayload[ xOut++ ] = 0;
+        }
+    }
+
+    return xOut;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTraceStreamFrame( TraceStream_t * pxStream )
+{
+    uint8_t ucPayload[ streamMAX_FRAME_LENGTH ];
+    const uint8_t * pucNext = ucPayload;
+    const uint8_t * pucEnd;
+    uint64_t ullSequence, ullDropped, ullTimeBase, ullRecord, ullTime;
+    uint8_t ucSum = 0;
+    size_t x, xPayloadLength;
+    int iLost;
+
+    xPayloadLength = prvTraceStreamCobsDecode( pxStream->ucFrame, pxStream->xLength, ucPayload );
+
+    for( x = 0; x < xPayloadLength; x++ )
+    {
+        ucSum = ( uint8_t ) ( ucSum + ucPayload[ x ] );
+    }
+
+    pucEnd = &( ucPayload[ xPayloadLength ] );
+
+    if( ( xPayloadLength < 4 ) || ( ucSum != 0 ) ||
+        ( prvTraceStreamVarint( &pucNext, pucEnd, &ullSequence ) == 0 ) ||
+        ( prvTraceStreamVarint( &pucNext, pucEnd, &ullDropped ) == 0 ) ||
+        ( prvTraceStreamVarint( &pucNext, pucEnd, &ullTimeBase ) == 0 ) )
+    {
+        pxStream->ulBadFrames++;
+        return;
+    }
+
+    /* Leave out the checksum. */
+    pucEnd--;
+
+    iLost = ( pxStream->iSynchronised != 0 ) && ( ( uint32_t ) ullSequence != pxStream->ulSequence );
+
+    /* The run time counter wraps, so take the time base closest to the last
+     * record. */
+    if( pxStream->iSynchronised == 0 )
+    {
+        ullTime = ( uint32_t ) ullTimeBase;
+        pxStream->ulDropped = ( uint32_t ) ullDropped;
+    }
+    else
+    {
+        ullTime = ( pxStream->ullTime & ~( uint64_t ) 0xffffffffU ) | ( uint32_t ) ullTimeBase;
+
+        if( ( ullTime + 0x80000000U ) < pxStream->ullTime )
+        {
+            ullTime += ( uint64_t ) 1 << 32;
+        }
+        else if( ( ullTime > ( pxStream->ullTime + 0x80000000U ) ) && ( ullTime >= ( ( uint64_t ) 1 << 32 ) ) )
+        {
+            ullTime -= ( uint64_t ) 1 << 32;
+        }
+    }
+
+    pxStream->ullTime = ullTime;
+
+    if( iLost != 0 )
+    {
+        pxStream->ulLostFrames += ( uint32_t ) ullSequence - pxStream->ulSequence;
+
+        if( pxStream->pxCallbacks->vLost != NULL )
+        {
+            pxStream->pxCallbacks->vLost( pxStream->pvContext, ullTime, ( uint32_t ) ullSequence - pxStream->ulSequence );
+        }
+    }
+
+    pxStream->iSynchronised = 1;
+    pxStream->ulSequence = ( uint32_t ) ullSequence + 1U;
+    pxStream->ulFrames++;
+
+    if( ( uint32_t ) ullDropped != pxStream->ulDropped )
+    {
+        if( pxStream->pxCallbacks->vDropped != NULL )
+        {
+            pxStream->pxCallbacks->vDropped( pxStream->pvContext, ullTime, ( uint32_t ) ullDropped - pxStream->ulDropped );
+        }
+
+        pxStream->ulDropped = ( uint32_t ) ullDropped;
+    }
+
+    while( pucNext < pucEnd )
+    {
+        int iEvent, iNumber = 0;
+
+        if( prvTraceStreamVarint( &pucNext, pucEnd, &ullRecord ) == 0 )
+        {
+            pxStream->ulBadFrames++;
+            return;
+        }
+
+        iEvent = ( int ) ( ullRecord & 0x7U );
+        pxStream->ullTime += ullRecord >> 3;
+
+        if( ( iEvent < streamEVENT_SWITCHED_IN ) || ( iEvent > streamEVENT_LEFT_READY ) )
+        {
+            pxStream->ulBadFrames++;
+            return;
+        }
+
+        if( iEvent != streamEVENT_TICK )
+        {
+            if( pucNext >= pucEnd )
+            {
+                pxStream->ulBadFrames++;
+                return;
+            }
+
+            iNumber = *pucNext;
+            pucNext++;
+        }
+
+        pxStream->ulRecords++;
+        pxStream->pxCallbacks->vRecord( pxStream->pvContext, pxStream->ullTime, iEvent, iNumber );
+    }
+}
+/*-----------------------------------------------------------*/
+
+/* Feed xLength bytes of the stream to the parser.  A frame is everything up
+ * to the next 0 byte, so bytes before the first 0 byte, which may be the end
+ * of a frame sent before the capture started, are discarded as corrupt. */
+static void vTraceStreamFeed( TraceStream_t * pxStream,
+                              const uint8_t * pucBytes,
+                              size_t xLength )
+{
+    size_t x;
+
+    for( x = 0; x < xLength; x++ )
+    {
+        if( pucBytes[ x ] == 0 )
+        {
+            if( ( pxStream->iOverflow == 0 ) && ( pxStream->xLength > 0 ) )
+            {
+                prvTraceStreamFrame( pxStream );
+            }
+
+            pxStream->xLength = 0;
+            pxStream->iOverflow = 0;
+        }
+        else if( pxStream->xLength < sizeof( pxStream->ucFrame ) )
+        {
+            pxStream->ucFrame[ pxStream->xLength++ ] = pucBytes[ x ];
+        }
+        else
+        {
+            pxStream->iOverflow = 1;
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+#endif /* EDF_TRACE_STREAM_H */
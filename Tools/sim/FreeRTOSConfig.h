@@ -0,0 +1,94 @@
+/*
+ * FreeRTOS V202112.00
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/*-----------------------------------------------------------
+ * Configuration of the virtual time simulator, see edf_sim.h.  The kernel
+ * runs on the port of Tools/sim, against a clock that only advances when a
+ * task consumes execution time or the processor is idle.
+ *----------------------------------------------------------*/
+
+/*****************************************************************/
+#define configUSE_PREEMPTION		1
+#define configUSE_IDLE_HOOK			1									/* Advances the clock while the processor is idle */
+#define configUSE_TICK_HOOK			0
+#define configTICK_RATE_HZ			( ( TickType_t ) 1000 )
+#define configMAX_PRIORITIES		( 10 )
+#define configMINIMAL_STACK_SIZE	( ( unsigned short ) 4096 )			/* Words, each task is a coroutine running C library code */
+#define configMAX_TASK_NAME_LEN		( 20 )
+#define configUSE_16_BIT_TICKS		0
+#define configIDLE_SHOULD_YIELD		1
+#define configUSE_TIME_SLICING		0
+#define configUSE_MUTEXES			0
+#define configUSE_TIMERS			0
+#define configCHECK_FOR_STACK_OVERFLOW	0
+#define configUSE_TICKLESS_IDLE		1									/* Jump over the ticks the processor is idle for */
+
+#define configSIM_COUNTS_PER_TICK	1000								/* Resolution of the virtual clock, microseconds at 1kHz */
+
+#define configGENERATE_RUN_TIME_STATS	0
+#define configSUPPORT_STATIC_ALLOCATION			0
+#define configSUPPORT_DYNAMIC_ALLOCATION		1							/* heap_3.c, tasks are allocated with malloc() */
+#define configUSE_TRACE_FACILITY				1
+#define configINCLUDE_FREERTOS_TASK_C_ADDITIONS_H	1						/* xSimGetNextTaskUnblockTime(), see freertos_tasks_c_additions.h */
+
+#define configQUEUE_REGISTRY_SIZE	0
+
+/* Configuration for EDF Scheduler.  Features that act on every tick, such as
+ * servers and mixed criticality budgets, stop the port from skipping the
+ * ticks at which no task is released, see port.c. */
+#define configUSE_EDF_SCHEDULER				1
+
+/* Every switch is added to the schedule hash of the simulation, see edf_sim.c. */
+extern void vSimTaskSwitchedIn( unsigned long uxTaskNumber );
+extern void vSimAssertCalled( const char * pcFile, int iLine );
+
+#define traceTASK_SWITCHED_IN()			vSimTaskSwitchedIn( ( unsigned long ) pxCurrentTCB->uxTCBNumber )
+
+#define configASSERT( x )	do{ if( ( x ) == 0 ){ vSimAssertCalled( __FILE__, __LINE__ ); } }while(0)
+
+
+/* Co-routine definitions. */
+#define configUSE_CO_ROUTINES 		0
+#define configMAX_CO_ROUTINE_PRIORITIES ( 2 )
+
+/* Set the following definitions to 1 to include the API function, or zero
+to exclude the API function. */
+
+#define INCLUDE_vTaskPrioritySet		0
+#define INCLUDE_uxTaskPriorityGet		0
+#define INCLUDE_vTaskDelete				0
+#define INCLUDE_vTaskCleanUpResources	0
+#define INCLUDE_vTaskSuspend			1
+#define INCLUDE_vTaskDelayUntil			1
+#define INCLUDE_vTaskDelay				1
+#define INCLUDE_xTaskGetSchedulerState	1
+#define INCLUDE_xTaskGetCurrentTaskHandle	1							/* Used by the port to find the running coroutine */
+
+#endif /* FREERTOS_CONFIG_H */
@@ -0,0 +1,202 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - EDF scheduler simulator
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+/*
+ * Harness of the simulator, see edf_sim.h: the periodic tasks of a
+ * simulation, the hooks of the kernel and the statistics of a run.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "edf.h"
+#include "edf_sim.h"
+
+#define simFNV_OFFSET    0xCBF29CE484222325ULL
+#define simFNV_PRIME     0x00000100000001B3ULL
+
+static uint32_t ulSwitches = 0UL;
+static unsigned long uxLastTaskNumber = 0UL;
+static uint64_t ullBusyTime = 0ULL;
+static uint64_t ullHash = simFNV_OFFSET;
+
+/*-----------------------------------------------------------*/
+
+static void prvHash( uint64_t ullValue )
+{
+    int x;
+
+    for( x = 0; x < 8; x++ )
+    {
+        ullHash = ( ullHash ^ ( ullValue & 0xFFULL ) ) * simFNV_PRIME;
+        ullValue >>= 8;
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vSimTaskSwitchedIn( unsigned long uxTaskNumber )
+{
+    /* A yield that selects the running task again is not a switch. */
+    if( uxTaskNumber != uxLastTaskNumber )
+    {
+        uxLastTaskNumber = uxTaskNumber;
+        ulSwitches++;
+        prvHash( ullSimGetTime() );
+        prvHash( ( uint64_t ) uxTaskNumber );
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vSimAssertCalled( const char * pcFile,
+                       int iLine )
+{
+    fprintf( stderr, "assertion failed at %s:%d, %llu counts into the simulation\n", pcFile, iLine, ( unsigned long long ) ullSimGetTime() );
+    abort();
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationIdleHook( void )
+{
+    vSimIdle();
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvExecutionTime( SimTask_t * const pxTask )
+{
+    /* xorshift64*, so that the execution times are the same on every host. */
+    pxTask->ullRandom ^= pxTask->ullRandom >> 12;
+    pxTask->ullRandom ^= pxTask->ullRandom << 25;
+    pxTask->ullRandom ^= pxTask->ullRandom >> 27;
+
+    if( pxTask->ulWcet <= pxTask->ulBcet )
+    {
+        return pxTask->ulWcet;
+    }
+
+    return pxTask->ulBcet + ( ( pxTask->ullRandom * 2685821657736338717ULL ) >> 32 ) % ( ( uint64_t ) ( pxTask->ulWcet - pxTask->ulBcet ) + 1ULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSimTask( void * pvParameters )
+{
+    SimTask_t * const pxTask = ( SimTask_t * ) pvParameters;
+    const uint64_t ullPeriod = ( uint64_t ) pxTask->xPeriod * simCOUNTS_PER_TICK;
+    const TickType_t xDeadline = ( pxTask->xDeadline == ( TickType_t ) 0U ) ? pxTask->xPeriod : pxTask->xDeadline;
+    const uint64_t ullDeadline = ( uint64_t ) xDeadline * simCOUNTS_PER_TICK;
+    TickType_t xLastWakeTime = 0;
+    uint64_t ullRelease, ullResponse, ullExecutionTime;
+
+    /* Every task blocks until tick 1 before its first job, so that the first
+     * jobs are released at the same time. */
+    ( void ) xTaskDelayUntil( &xLastWakeTime, ( TickType_t ) 1U );
+    ullRelease = simCOUNTS_PER_TICK;
+
+    for( ; ; )
+    {
+        ullExecutionTime = prvExecutionTime( pxTask );
+        pxTask->ulPreemptions += ulSimConsume( ullExecutionTime );
+        ullBusyTime += ullExecutionTime;
+
+        ullResponse = ullSimGetTime() - ullRelease;
+        pxTask->ulJobs++;
+        pxTask->ullTotalResponse += ullResponse;
+
+        if( ullResponse > pxTask->ullMaxResponse )
+        {
+            pxTask->ullMaxResponse = ullResponse;
+        }
+
+        if( ullResponse > ullDeadline )
+        {
+            pxTask->ulMissedDeadlines++;
+        }
+
+        /* The next release is one period on even if this job was late, as
+         * xTaskDelayUntil() does not delay past a wake time already gone. */
+        ullRelease += ullPeriod;
+
+        ( void ) xTaskDelayUntil( &xLastWakeTime, pxTask->xPeriod );
+    }
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xSimRun( SimTask_t * const pxTasks,
+                    UBaseType_t uxNumberOfTasks,
+                    uint64_t ullTicks,
+                    uint64_t ullSeed,
+                    SimResult_t * const pxResult )
+{
+    PeriodicTaskParameters_t xDefinition = { 0 };
+    UBaseType_t uxTask;
+
+    configASSERT( pxTasks );
+    configASSERT( pxResult );
+
+    for( uxTask = 0; uxTask < uxNumberOfTasks; uxTask++ )
+    {
+        SimTask_t * const pxTask = &( pxTasks[ uxTask ] );
+
+        configASSERT( pxTask->xPeriod > ( TickType_t ) 0U );
+        configASSERT( pxTask->xDeadline <= pxTask->xPeriod );
+
+        pxTask->ulJobs = 0UL;
+        pxTask->ulMissedDeadlines = 0UL;
+        pxTask->ulPreemptions = 0UL;
+        pxTask->ullMaxResponse = 0ULL;
+        pxTask->ullTotalResponse = 0ULL;
+        pxTask->ullRandom = ( ( ullSeed + ( uint64_t ) uxTask ) * 0x9E3779B97F4A7C15ULL ) | 1ULL;
+
+        xDefinition.pvTaskCode = prvSimTask;
+        xDefinition.pcName = pxTask->pcName;
+        xDefinition.usStackDepth = configMINIMAL_STACK_SIZE;
+        xDefinition.pvParameters = pxTask;
+        xDefinition.uxPriority = 1;
+        xDefinition.xPeriod = pxTask->xPeriod;
+        xDefinition.xDeadline = pxTask->xDeadline;
+        xDefinition.xWcet = ( TickType_t ) ( ( ( uint64_t ) pxTask->ulWcet + simCOUNTS_PER_TICK - 1ULL ) / simCOUNTS_PER_TICK );
+
+        if( xTaskPeriodicCreateFromParameters( &xDefinition, NULL ) != pdPASS )
+        {
+            return pdFAIL;
+        }
+    }
+
+    vSimSetEndTime( ullTicks * simCOUNTS_PER_TICK );
+
+    /* Returns when the end time is reached. */
+    vTaskStartScheduler();
+
+    pxResult->ullTicks = ullTicks;
+    pxResult->ullTicksProcessed = ullSimGetTicksProcessed();
+    pxResult->ullBusyTime = ullBusyTime;
+    pxResult->ulSwitches = ulSwitches;
+    pxResult->ullHash = ullHash;
+
+    return pdPASS;
+}
@@ -0,0 +1,159 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - EDF scheduler simulator
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+/*
+ * Deterministic simulation of the EDF kernel of Src/tasks.c on the host.
+ * Every task is a coroutine of the only host thread, and time is virtual: it
+ * advances when a task consumes execution time with ulSimConsume(), or when
+ * the processor is idle, and jumps over the ticks at which nothing happens.
+ * Kernel code takes no virtual time.  The same task set and seed always give
+ * the same schedule, whatever the host and its load.
+ *
+ * The kernel can only be started once, so xSimRun() can only be called once
+ * by a process.  Fork a process for each task set to run many of them.
+ */
+
+#ifndef INC_EDF_SIM_H
+#define INC_EDF_SIM_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include edf_sim.h"
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/* Number of counts of the virtual clock in a tick. */
+#define simCOUNTS_PER_TICK    ( ( uint64_t ) configSIM_COUNTS_PER_TICK )
+
+/*
+ * A periodic task of a simulation.  Its jobs are released at tick 1 and then
+ * once per period, and each runs for a time drawn uniformly between ulBcet
+ * and ulWcet.  The deadline is passed to the kernel as the xDeadline of the
+ * task, as edf.hpp does.
+ */
+typedef struct xSIM_TASK
+{
+    /* Set by the caller. */
+    const char * pcName;
+    TickType_t xPeriod;         /*< Period in ticks. */
+    uint32_t ulWcet;            /*< Longest execution time of a job in counts. */
+    uint32_t ulBcet;            /*< Shortest execution time of a job in counts, at most ulWcet. */
+    TickType_t xDeadline;       /*< Relative deadline in ticks, at most xPeriod.  0 for a deadline equal to the period. */
+
+    /* Set by xSimRun(). */
+    uint32_t ulJobs;            /*< Number of jobs completed. */
+    uint32_t ulMissedDeadlines; /*< Number of jobs completed after their deadline. */
+    uint32_t ulPreemptions;     /*< Number of times a job was switched out before it completed. */
+    uint64_t ullMaxResponse;    /*< Longest time from the release to the completion of a job in counts. */
+    uint64_t ullTotalResponse;  /*< Sum of the response times of the jobs in counts. */
+    uint64_t ullRandom;         /*< State of the generator of the execution times. */
+} SimTask_t;
+
+/* Used with xSimRun() to return the totals of a simulation. */
+typedef struct xSIM_RESULT
+{
+    uint64_t ullTicks;          /*< Number of ticks simulated. */
+    uint64_t ullTicksProcessed; /*< Number of them processed by xTaskIncrementTick(), the others were stepped over. */
+    uint64_t ullBusyTime;       /*< Time consumed by the completed jobs in counts. */
+    uint32_t ulSwitches;        /*< Number of task switches. */
+    uint64_t ullHash;           /*< Hash of the time and task of every switch, equal for equal schedules. */
+} SimResult_t;
+
+/**
+ * edf_sim. h
+ * <pre>
+ * BaseType_t xSimRun( SimTask_t * const pxTasks, UBaseType_t uxNumberOfTasks, uint64_t ullTicks, uint64_t ullSeed, SimResult_t * const pxResult );
+ * </pre>
+ *
+ * Create a periodic task for each of the uxNumberOfTasks members of pxTasks,
+ * run the scheduler for ullTicks ticks of virtual time, and fill in the
+ * statistics of pxTasks and pxResult.  ullSeed selects the execution times of
+ * the jobs.
+ *
+ * @return pdPASS, or pdFAIL if a task could not be created, for example as
+ * it was rejected by admission control.
+ *
+ * Example usage:
+ * <pre>
+ * SimTask_t xTasks[ 2 ] = { { "A", 10, 3000, 3000 }, { "B", 15, 6000, 2000 } };
+ * SimResult_t xResult;
+ *
+ *  if( xSimRun( xTasks, 2, 3600000, 1, &xResult ) == pdPASS )
+ *  {
+ *      printf( "%lu deadlines missed\n", ( unsigned long ) xTasks[ 1 ].ulMissedDeadlines );
+ *  }
+ * </pre>
+ */
+BaseType_t xSimRun( SimTask_t * const pxTasks,
+                    UBaseType_t uxNumberOfTasks,
+                    uint64_t ullTicks,
+                    uint64_t ullSeed,
+                    SimResult_t * const pxResult );
+
+/**
+ * edf_sim. h
+ * <pre>
+ * uint32_t ulSimConsume( uint64_t ullCounts );
+ * </pre>
+ *
+ * Consume ullCounts counts of execution time in the running task, in place of
+ * the busy loop that would run on the target.  The ticks that fall within
+ * that time are processed, and can switch to other tasks.  Must not be called
+ * from a critical section.
+ *
+ * @return The number of times the calling task was switched out.
+ */
+uint32_t ulSimConsume( uint64_t ullCounts );
+
+/**
+ * edf_sim. h
+ * <pre>
+ * uint64_t ullSimGetTime( void );
+ * </pre>
+ *
+ * @return The virtual time in counts since the scheduler was started.
+ */
+uint64_t ullSimGetTime( void );
+
+/* Used by the port and the harness, not the application. */
+void vSimIdle( void );
+void vSimSetEndTime( uint64_t ullEndTime );
+uint64_t ullSimGetTicksProcessed( void );
+TickType_t xSimGetNextTaskUnblockTime( void );
+UBaseType_t uxSimGetReadyTaskCount( void );
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* INC_EDF_SIM_H */
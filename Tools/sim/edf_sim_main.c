@@ -0,0 +1,219 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - EDF scheduler simulator
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+/*
+ * Command line front end of the simulator, see edf_sim.h.  Simulates a task
+ * set read from a file, one task per line as
+ *
+ *     name period wcet [bcet [deadline]]
+ *
+ * with all times in ticks, the execution times possibly fractional, and
+ * prints the statistics of every task.  The deadline is the period unless
+ * given.  Lines starting with # are ignored.
+ * The output only depends on the task set, the duration and the seed, so it
+ * can be compared between runs; the host time taken goes to stderr.
+ *
+ * Build with a FreeRTOS-Kernel V10.4.6 checkout in $KERNEL:
+ *
+ *     cc -std=gnu99 -O2 -ITools/sim -ISrc -I$KERNEL/include -o edf_sim \
+ *        Tools/sim/edf_sim_main.c Tools/sim/edf_sim.c Tools/sim/port.c Src/tasks.c \
+ *        $KERNEL/list.c $KERNEL/portable/MemMang/heap_3.c
+ *     ./edf_sim -d 3600000 taskset.txt
+ *
+ * Options:
+ *     -d ticks  ticks to simulate, 3600000 (an hour at 1kHz) by default
+ *     -S seed   seed of the execution times, 1 by default
+ *     -c        print CSV instead of a table
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "edf_sim.h"
+
+#define simMAX_TASKS    1000
+
+static SimTask_t xTasks[ simMAX_TASKS ];
+static char cNames[ simMAX_TASKS ][ configMAX_TASK_NAME_LEN ];
+
+/*-----------------------------------------------------------*/
+
+static int prvReadTaskSet( const char * pcFileName )
+{
+    char cLine[ 256 ], cName[ 64 ];
+    double dPeriod, dWcet, dBcet, dDeadline;
+    int iFields, iTasks = 0, iLine = 0;
+    FILE * pxFile = fopen( pcFileName, "r" );
+
+    if( pxFile == NULL )
+    {
+        perror( pcFileName );
+        return -1;
+    }
+
+    while( fgets( cLine, sizeof( cLine ), pxFile ) != NULL )
+    {
+        iLine++;
+        iFields = sscanf( cLine, "%63s %lf %lf %lf %lf", cName, &dPeriod, &dWcet, &dBcet, &dDeadline );
+
+        if( ( iFields <= 0 ) || ( cName[ 0 ] == '#' ) )
+        {
+            continue;
+        }
+
+        if( iFields == 3 )
+        {
+            dBcet = dWcet;
+        }
+
+        if( iFields <= 4 )
+        {
+            dDeadline = dPeriod;
+        }
+
+        if( ( iFields < 3 ) || ( dPeriod < 1.0 ) || ( dWcet < 0.0 ) || ( dBcet < 0.0 ) || ( dBcet > dWcet ) ||
+            ( dDeadline < 1.0 ) || ( dDeadline > dPeriod ) || ( iTasks == simMAX_TASKS ) )
+        {
+            fprintf( stderr, "%s:%d: expected name period wcet [bcet [deadline]]\n", pcFileName, iLine );
+            fclose( pxFile );
+            return -1;
+        }
+
+        /* Names longer than the kernel keeps are cut to its length. */
+        snprintf( cNames[ iTasks ], sizeof( cNames[ iTasks ] ), "%.*s", ( int ) sizeof( cNames[ iTasks ] ) - 1, cName );
+        xTasks[ iTasks ].pcName = cNames[ iTasks ];
+        xTasks[ iTasks ].xPeriod = ( TickType_t ) dPeriod;
+        xTasks[ iTasks ].ulWcet = ( uint32_t ) ( dWcet * ( double ) simCOUNTS_PER_TICK + 0.5 );
+        xTasks[ iTasks ].ulBcet = ( uint32_t ) ( dBcet * ( double ) simCOUNTS_PER_TICK + 0.5 );
+        xTasks[ iTasks ].xDeadline = ( TickType_t ) dDeadline;
+        iTasks++;
+    }
+
+    fclose( pxFile );
+
+    return iTasks;
+}
+/*-----------------------------------------------------------*/
+
+static double prvTicks( uint64_t ullCounts )
+{
+    return ( double ) ullCounts / ( double ) simCOUNTS_PER_TICK;
+}
+/*-----------------------------------------------------------*/
+
+int main( int argc,
+          char ** argv )
+{
+    const char * pcTaskSet = NULL;
+    uint64_t ullTicks = 3600000ULL, ullSeed = 1ULL;
+    SimResult_t xResult;
+    struct timespec xStart, xEnd;
+    int iArg, iTasks, x, iCsv = 0;
+
+    for( iArg = 1; iArg < argc; iArg++ )
+    {
+        const char * const pcOption = argv[ iArg ];
+        const char * const pcValue = ( iArg + 1 < argc ) ? argv[ iArg + 1 ] : NULL;
+
+        if( strcmp( pcOption, "-c" ) == 0 )
+        {
+            iCsv = 1;
+        }
+        else if( ( strcmp( pcOption, "-d" ) == 0 ) && ( pcValue != NULL ) )
+        {
+            ullTicks = strtoull( pcValue, NULL, 0 );
+            iArg++;
+        }
+        else if( ( strcmp( pcOption, "-S" ) == 0 ) && ( pcValue != NULL ) )
+        {
+            ullSeed = strtoull( pcValue, NULL, 0 );
+            iArg++;
+        }
+        else if( ( pcOption[ 0 ] != '-' ) && ( pcTaskSet == NULL ) )
+        {
+            pcTaskSet = pcOption;
+        }
+        else
+        {
+            pcTaskSet = NULL;
+            break;
+        }
+    }
+
+    if( ( pcTaskSet == NULL ) || ( ullTicks == 0ULL ) )
+    {
+        fprintf( stderr, "usage: %s [-d ticks] [-S seed] [-c] taskset\n", argv[ 0 ] );
+        return 1;
+    }
+
+    iTasks = prvReadTaskSet( pcTaskSet );
+
+    if( iTasks <= 0 )
+    {
+        return 1;
+    }
+
+    ( void ) clock_gettime( CLOCK_MONOTONIC, &xStart );
+
+    if( xSimRun( xTasks, ( UBaseType_t ) iTasks, ullTicks, ullSeed, &xResult ) != pdPASS )
+    {
+        fprintf( stderr, "the task set was not accepted by the kernel\n" );
+        return 1;
+    }
+
+    ( void ) clock_gettime( CLOCK_MONOTONIC, &xEnd );
+
+    printf( iCsv ? "task,period,deadline,wcet,bcet,jobs,missed,preemptions,max_response,mean_response\n" :
+            "task                 period deadline     wcet     bcet       jobs   missed  preempts  max resp mean resp\n" );
+
+    for( x = 0; x < iTasks; x++ )
+    {
+        const SimTask_t * const pxTask = &( xTasks[ x ] );
+        const double dMean = ( pxTask->ulJobs == 0UL ) ? 0.0 : prvTicks( pxTask->ullTotalResponse ) / ( double ) pxTask->ulJobs;
+
+        printf( iCsv ? "%s,%lu,%lu,%.3f,%.3f,%lu,%lu,%lu,%.3f,%.3f\n" : "%-20s %6lu %8lu %8.3f %8.3f %10lu %8lu %9lu %9.3f %9.3f\n",
+                pxTask->pcName, ( unsigned long ) pxTask->xPeriod, ( unsigned long ) pxTask->xDeadline, prvTicks( pxTask->ulWcet ), prvTicks( pxTask->ulBcet ),
+                ( unsigned long ) pxTask->ulJobs, ( unsigned long ) pxTask->ulMissedDeadlines, ( unsigned long ) pxTask->ulPreemptions,
+                prvTicks( pxTask->ullMaxResponse ), dMean );
+    }
+
+    if( iCsv == 0 )
+    {
+        printf( "\n%llu ticks simulated, %llu processed, %.2f%% busy, %lu switches, schedule hash %016llx\n",
+                ( unsigned long long ) xResult.ullTicks, ( unsigned long long ) xResult.ullTicksProcessed,
+                100.0 * prvTicks( xResult.ullBusyTime ) / ( double ) xResult.ullTicks, ( unsigned long ) xResult.ulSwitches,
+                ( unsigned long long ) xResult.ullHash );
+    }
+
+    fprintf( stderr, "simulated in %.3f s\n", ( double ) ( xEnd.tv_sec - xStart.tv_sec ) + ( ( double ) ( xEnd.tv_nsec - xStart.tv_nsec ) / 1e9 ) );
+
+    return 0;
+}
@@ -0,0 +1,480 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - EDF scheduler simulator
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+/*
+ * Acceptance ratio benchmark built on the simulator, see edf_sim.h.  For each
+ * utilisation level it generates random task sets with UUniFast-discard, with
+ * periods drawn log-uniformly between two bounds, simulates every set in a
+ * process of its own, and prints for the level:
+ *
+ *     schedulable  fraction of the sets in which no job missed its deadline
+ *     miss ratio   fraction of the jobs that missed their deadline
+ *     preempt/job  preemptions per job
+ *     switch/job   task switches per job
+ *     tick/job     ticks processed by xTaskIncrementTick() per job
+ *     host us/job  host processor time per job, the cost of the kernel and of
+ *                  the simulator port, as the jobs themselves take no host time
+ *
+ * The sets are run as many at a time as there are host processors.  The
+ * results only depend on the options, except for the host time.
+ *
+ * Build with a FreeRTOS-Kernel V10.4.6 checkout in $KERNEL:
+ *
+ *     cc -std=gnu99 -O2 -ITools/sim -ISrc -I$KERNEL/include -o edf_sim_sweep \
+ *        Tools/sim/edf_sim_sweep.c Tools/sim/edf_sim.c Tools/sim/port.c Src/tasks.c \
+ *        $KERNEL/list.c $KERNEL/portable/MemMang/heap_3.c -lm
+ *     ./edf_sim_sweep -n 1000 -t 10 -D
+ *
+ * Options:
+ *     -n sets            task sets per utilisation level, 100 by default
+ *     -t tasks           tasks per set, 10 by default
+ *     -u from:to:step    utilisation levels, 0.5:1.0:0.05 by default
+ *     -p min:max         bounds of the periods in ticks, 10:1000 by default
+ *     -b fraction        best case execution time as a fraction of the WCET,
+ *                        1 by default so that every job runs for its WCET
+ *     -D                 constrained deadlines, drawn uniformly between the
+ *                        WCET and the period, instead of the periods
+ *     -d ticks           ticks simulated per set, 100000 by default
+ *     -j processes       sets simulated at once, the number of processors
+ *                        by default
+ *     -S seed            seed of the task sets and execution times, 1 by default
+ *     -c                 print CSV instead of a table
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "edf_sim.h"
+
+#define sweepMAX_TASKS     200
+#define sweepMAX_LEVELS    100
+
+/* The outcome of the simulation of one set, written by the process that ran
+ * it to its pipe. */
+typedef struct xSWEEP_RESULT
+{
+    BaseType_t xPassed;          /*< pdFALSE if the kernel did not accept the set. */
+    uint64_t ullJobs;
+    uint64_t ullMissed;
+    uint64_t ullPreemptions;
+    uint64_t ullSwitches;
+    uint64_t ullTicksProcessed;
+    uint64_t ullHostNanoseconds;
+} SweepResult_t;
+
+/* The totals of a utilisation level. */
+typedef struct xSWEEP_LEVEL
+{
+    double dUtilisation;
+    uint32_t ulSets;
+    uint32_t ulSchedulable;
+    uint32_t ulRejected;         /*< Sets the kernel did not accept, or whose process failed. */
+    SweepResult_t xTotals;
+} SweepLevel_t;
+
+/* A set being simulated by a child process. */
+typedef struct xSWEEP_CHILD
+{
+    pid_t xPid;
+    int iPipe;
+    SweepLevel_t * pxLevel;
+} SweepChild_t;
+
+static SimTask_t xTasks[ sweepMAX_TASKS ];
+static char cNames[ sweepMAX_TASKS ][ 8 ];
+static SweepLevel_t xLevels[ sweepMAX_LEVELS ];
+
+/*-----------------------------------------------------------*/
+
+static uint64_t prvRandom( uint64_t * pullState )
+{
+    /* xorshift64*, as in edf_sim.c, so every host generates the same sets. */
+    *pullState ^= *pullState >> 12;
+    *pullState ^= *pullState << 25;
+    *pullState ^= *pullState >> 27;
+
+    return *pullState * 2685821657736338717ULL;
+}
+/*-----------------------------------------------------------*/
+
+static double prvUniform( uint64_t * pullState )
+{
+    /* 53 random bits, uniform in [0, 1). */
+    return ( double ) ( prvRandom( pullState ) >> 11 ) * ( 1.0 / 9007199254740992.0 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvUUniFastDiscard( double dUtilisation,
+                                int iTasks,
+                                double * pdUtilisations,
+                                uint64_t * pullState )
+{
+    double dSum, dNext;
+    int x, iValid;
+
+    /* UUniFast draws utilisations uniformly distributed over the sets that
+     * sum to dUtilisation.  Sets with a task above 1 are drawn again. */
+    do
+    {
+        dSum = dUtilisation;
+        iValid = 1;
+
+        for( x = 0; x < iTasks - 1; x++ )
+        {
+            dNext = dSum * pow( prvUniform( pullState ), 1.0 / ( double ) ( iTasks - x - 1 ) );
+            pdUtilisations[ x ] = dSum - dNext;
+            dSum = dNext;
+            iValid &= ( pdUtilisations[ x ] <= 1.0 );
+        }
+
+        pdUtilisations[ iTasks - 1 ] = dSum;
+        iValid &= ( dSum <= 1.0 );
+    } while( iValid == 0 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvGenerateTaskSet( double dUtilisation,
+                                int iTasks,
+                                TickType_t xMinPeriod,
+                                TickType_t xMaxPeriod,
+                                double dBcetFraction,
+                                int iConstrained,
+                                uint64_t ullSeed )
+{
+    double dUtilisations[ sweepMAX_TASKS ];
+    uint64_t ullState = ( ullSeed * 0x9E3779B97F4A7C15ULL ) | 1ULL;
+    TickType_t xPeriod, xMinDeadline;
+    uint64_t ullWcet;
+    int x;
+
+    prvUUniFastDiscard( dUtilisation, iTasks, dUtilisations, &ullState );
+
+    for( x = 0; x < iTasks; x++ )
+    {
+        /* Log-uniform, so that each decade holds as many periods. */
+        xPeriod = ( TickType_t ) exp( log( ( double ) xMinPeriod ) + ( prvUniform( &ullState ) * ( log( ( double ) xMaxPeriod + 1.0 ) - log( ( double ) xMinPeriod ) ) ) );
+        xPeriod = ( xPeriod > xMaxPeriod ) ? xMaxPeriod : xPeriod;
+
+        /* Rounded down, so that the set never exceeds its utilisation. */
+        ullWcet = ( uint64_t ) ( dUtilisations[ x ] * ( double ) xPeriod * ( double ) simCOUNTS_PER_TICK );
+        ullWcet = ( ullWcet == 0ULL ) ? 1ULL : ullWcet;
+
+        xTasks[ x ].pcName = cNames[ x ];
+        xTasks[ x ].xPeriod = xPeriod;
+        xTasks[ x ].ulWcet = ( uint32_t ) ullWcet;
+        xTasks[ x ].ulBcet = ( uint32_t ) ( ( double ) ullWcet * dBcetFraction );
+        xTasks[ x ].xDeadline = 0;
+
+        if( iConstrained != 0 )
+        {
+            xMinDeadline = ( TickType_t ) ( ( ullWcet + simCOUNTS_PER_TICK - 1ULL ) / simCOUNTS_PER_TICK );
+            xTasks[ x ].xDeadline = xMinDeadline + ( TickType_t ) ( prvUniform( &ullState ) * ( double ) ( xPeriod - xMinDeadline + 1U ) );
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvCpuNanoseconds( void )
+{
+    struct timespec xTime;
+
+    ( void ) clock_gettime( CLOCK_PROCESS_CPUTIME_ID, &xTime );
+
+    return ( ( uint64_t ) xTime.tv_sec * 1000000000ULL ) + ( uint64_t ) xTime.tv_nsec;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRunTaskSet( int iTasks,
+                           uint64_t ullTicks,
+                           uint64_t ullSeed,
+                           int iPipe )
+{
+    SweepResult_t xResult;
+    SimResult_t xSimResult;
+    uint64_t ullStart;
+    int x;
+
+    memset( &xResult, 0x00, sizeof( xResult ) );
+    ullStart = prvCpuNanoseconds();
+
+    if( xSimRun( xTasks, ( UBaseType_t ) iTasks, ullTicks, ullSeed, &xSimResult ) == pdPASS )
+    {
+        xResult.xPassed = pdTRUE;
+        xResult.ullHostNanoseconds = prvCpuNanoseconds() - ullStart;
+        xResult.ullSwitches = xSimResult.ulSwitches;
+        xResult.ullTicksProcessed = xSimResult.ullTicksProcessed;
+
+        for( x = 0; x < iTasks; x++ )
+        {
+            xResult.ullJobs += xTasks[ x ].ulJobs;
+            xResult.ullMissed += xTasks[ x ].ulMissedDeadlines;
+            xResult.ullPreemptions += xTasks[ x ].ulPreemptions;
+        }
+    }
+
+    /* Less than PIPE_BUF, so the parent reads it whole. */
+    if( write( iPipe, &xResult, sizeof( xResult ) ) != ( ssize_t ) sizeof( xResult ) )
+    {
+        _exit( 1 );
+    }
+
+    _exit( 0 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvCollect( SweepChild_t * pxChildren,
+                        int * piRunning )
+{
+    SweepResult_t xResult;
+    SweepLevel_t * pxLevel;
+    int x, iStatus;
+    pid_t xPid;
+
+    xPid = wait( &iStatus );
+
+    for( x = 0; x < *piRunning; x++ )
+    {
+        if( pxChildren[ x ].xPid == xPid )
+        {
+            break;
+        }
+    }
+
+    if( x == *piRunning )
+    {
+        return;
+    }
+
+    pxLevel = pxChildren[ x ].pxLevel;
+    pxLevel->ulSets++;
+
+    if( WIFEXITED( iStatus ) && ( WEXITSTATUS( iStatus ) == 0 ) &&
+        ( read( pxChildren[ x ].iPipe, &xResult, sizeof( xResult ) ) == ( ssize_t ) sizeof( xResult ) ) &&
+        ( xResult.xPassed != pdFALSE ) )
+    {
+        pxLevel->ulSchedulable += ( xResult.ullMissed == 0ULL ) ? 1UL : 0UL;
+        pxLevel->xTotals.ullJobs += xResult.ullJobs;
+        pxLevel->xTotals.ullMissed += xResult.ullMissed;
+        pxLevel->xTotals.ullPreemptions += xResult.ullPreemptions;
+        pxLevel->xTotals.ullSwitches += xResult.ullSwitches;
+        pxLevel->xTotals.ullTicksProcessed += xResult.ullTicksProcessed;
+        pxLevel->xTotals.ullHostNanoseconds += xResult.ullHostNanoseconds;
+    }
+    else
+    {
+        pxLevel->ulRejected++;
+    }
+
+    close( pxChildren[ x ].iPipe );
+    pxChildren[ x ] = pxChildren[ *piRunning - 1 ];
+    ( *piRunning )--;
+}
+/*-----------------------------------------------------------*/
+
+static double prvPerJob( uint64_t ullValue,
+                         const SweepLevel_t * const pxLevel )
+{
+    return ( pxLevel->xTotals.ullJobs == 0ULL ) ? 0.0 : ( double ) ullValue / ( double ) pxLevel->xTotals.ullJobs;
+}
+/*-----------------------------------------------------------*/
+
+int main( int argc,
+          char ** argv )
+{
+    int iSets = 100, iTasks = 10, iConstrained = 0, iCsv = 0, iParallel;
+    double dFrom = 0.5, dTo = 1.0, dStep = 0.05, dBcetFraction = 1.0;
+    unsigned long ulMinPeriod = 10UL, ulMaxPeriod = 1000UL;
+    uint64_t ullTicks = 100000ULL, ullSeed = 1ULL, ullSetSeed;
+    SweepChild_t * pxChildren;
+    int iArg, iLevels, iLevel, iSet, iRunning = 0, iPipes[ 2 ], iUsage = 0, x;
+    pid_t xPid;
+
+    iParallel = ( int ) sysconf( _SC_NPROCESSORS_ONLN );
+
+    for( iArg = 1; iArg < argc; iArg++ )
+    {
+        const char * const pcOption = argv[ iArg ];
+        const char * const pcValue = ( iArg + 1 < argc ) ? argv[ iArg + 1 ] : NULL;
+
+        if( strcmp( pcOption, "-c" ) == 0 )
+        {
+            iCsv = 1;
+        }
+        else if( strcmp( pcOption, "-D" ) == 0 )
+        {
+            iConstrained = 1;
+        }
+        else if( pcValue == NULL )
+        {
+            iUsage = 1;
+        }
+        else if( strcmp( pcOption, "-n" ) == 0 )
+        {
+            iSets = atoi( pcValue );
+        }
+        else if( strcmp( pcOption, "-t" ) == 0 )
+        {
+            iTasks = atoi( pcValue );
+        }
+        else if( strcmp( pcOption, "-u" ) == 0 )
+        {
+            iUsage |= ( sscanf( pcValue, "%lf:%lf:%lf", &dFrom, &dTo, &dStep ) != 3 );
+        }
+        else if( strcmp( pcOption, "-p" ) == 0 )
+        {
+            iUsage |= ( sscanf( pcValue, "%lu:%lu", &ulMinPeriod, &ulMaxPeriod ) != 2 );
+        }
+        else if( strcmp( pcOption, "-b" ) == 0 )
+        {
+            dBcetFraction = atof( pcValue );
+        }
+        else if( strcmp( pcOption, "-d" ) == 0 )
+        {
+            ullTicks = strtoull( pcValue, NULL, 0 );
+        }
+        else if( strcmp( pcOption, "-j" ) == 0 )
+        {
+            iParallel = atoi( pcValue );
+        }
+        else if( strcmp( pcOption, "-S" ) == 0 )
+        {
+            ullSeed = strtoull( pcValue, NULL, 0 );
+        }
+        else
+        {
+            iUsage = 1;
+        }
+
+        if( ( pcOption[ 1 ] != 'c' ) && ( pcOption[ 1 ] != 'D' ) )
+        {
+            iArg++;
+        }
+    }
+
+    iLevels = ( dStep > 0.0 ) ? ( int ) floor( ( ( dTo - dFrom ) / dStep ) + 1e-9 ) + 1 : 0;
+
+    if( ( iUsage != 0 ) || ( iSets <= 0 ) || ( iTasks < 1 ) || ( iTasks > sweepMAX_TASKS ) || ( iLevels < 1 ) ||
+        ( iLevels > sweepMAX_LEVELS ) || ( dFrom <= 0.0 ) || ( dTo > ( double ) iTasks ) || ( ulMinPeriod < 1UL ) ||
+        ( ulMaxPeriod < ulMinPeriod ) || ( dBcetFraction < 0.0 ) || ( dBcetFraction > 1.0 ) || ( ullTicks == 0ULL ) )
+    {
+        fprintf( stderr, "usage: %s [-n sets] [-t tasks] [-u from:to:step] [-p min:max] [-b fraction] [-D] [-d ticks] [-j processes] [-S seed] [-c]\n", argv[ 0 ] );
+        return 1;
+    }
+
+    iParallel = ( iParallel < 1 ) ? 1 : iParallel;
+    pxChildren = calloc( ( size_t ) iParallel, sizeof( SweepChild_t ) );
+
+    if( pxChildren == NULL )
+    {
+        perror( "calloc" );
+        return 1;
+    }
+
+    for( x = 0; x < iTasks; x++ )
+    {
+        snprintf( cNames[ x ], sizeof( cNames[ x ] ), "T%d", x );
+    }
+
+    for( iLevel = 0; iLevel < iLevels; iLevel++ )
+    {
+        xLevels[ iLevel ].dUtilisation = dFrom + ( ( double ) iLevel * dStep );
+
+        for( iSet = 0; iSet < iSets; iSet++ )
+        {
+            if( iRunning == iParallel )
+            {
+                prvCollect( pxChildren, &iRunning );
+            }
+
+            /* Each set has a seed of its own, so it does not depend on the
+             * number of sets or on the order in which they complete. */
+            ullSetSeed = ullSeed ^ ( ( ( uint64_t ) iLevel << 40 ) | ( uint64_t ) iSet );
+            prvGenerateTaskSet( xLevels[ iLevel ].dUtilisation, iTasks, ( TickType_t ) ulMinPeriod, ( TickType_t ) ulMaxPeriod,
+                                dBcetFraction, iConstrained, ullSetSeed );
+
+            if( pipe( iPipes ) != 0 )
+            {
+                perror( "pipe" );
+                return 1;
+            }
+
+            fflush( stdout );
+            xPid = fork();
+
+            if( xPid == 0 )
+            {
+                close( iPipes[ 0 ] );
+                prvRunTaskSet( iTasks, ullTicks, ullSetSeed, iPipes[ 1 ] );
+            }
+
+            close( iPipes[ 1 ] );
+
+            if( xPid < 0 )
+            {
+                perror( "fork" );
+                return 1;
+            }
+
+            pxChildren[ iRunning ].xPid = xPid;
+            pxChildren[ iRunning ].iPipe = iPipes[ 0 ];
+            pxChildren[ iRunning ].pxLevel = &( xLevels[ iLevel ] );
+            iRunning++;
+        }
+    }
+
+    while( iRunning > 0 )
+    {
+        prvCollect( pxChildren, &iRunning );
+    }
+
+    printf( iCsv ? "utilisation,sets,rejected,schedulable,miss_ratio,preemptions_per_job,switches_per_job,ticks_per_job,host_us_per_job\n" :
+            "utilisation  sets rejected schedulable  miss ratio preempt/job switch/job   tick/job host us/job\n" );
+
+    for( iLevel = 0; iLevel < iLevels; iLevel++ )
+    {
+        const SweepLevel_t * const pxLevel = &( xLevels[ iLevel ] );
+        const uint32_t ulSimulated = pxLevel->ulSets - pxLevel->ulRejected;
+
+        printf( iCsv ? "%.3f,%lu,%lu,%.4f,%.6f,%.4f,%.4f,%.4f,%.3f\n" : "%11.3f %5lu %8lu %11.4f %11.6f %11.4f %10.4f %10.4f %11.3f\n",
+                pxLevel->dUtilisation, ( unsigned long ) pxLevel->ulSets, ( unsigned long ) pxLevel->ulRejected,
+                ( ulSimulated == 0UL ) ? 0.0 : ( double ) pxLevel->ulSchedulable / ( double ) ulSimulated,
+                prvPerJob( pxLevel->xTotals.ullMissed, pxLevel ), prvPerJob( pxLevel->xTotals.ullPreemptions, pxLevel ),
+                prvPerJob( pxLevel->xTotals.ullSwitches, pxLevel ), prvPerJob( pxLevel->xTotals.ullTicksProcessed, pxLevel ),
+                prvPerJob( pxLevel->xTotals.ullHostNanoseconds, pxLevel ) / 1000.0 );
+    }
+
+    free( pxChildren );
+
+    return 0;
+}
@@ -0,0 +1,50 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - EDF scheduler simulator
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+/*
+ * Included at the end of tasks.c when configINCLUDE_FREERTOS_TASK_C_ADDITIONS_H
+ * is 1, to give the simulator port read access to kernel state.
+ */
+
+#ifndef FREERTOS_TASKS_C_ADDITIONS_H
+#define FREERTOS_TASKS_C_ADDITIONS_H
+
+/* The tick count at which the next delayed task unblocks, so that the port
+ * can step over the ticks before it without processing them. */
+TickType_t xSimGetNextTaskUnblockTime( void )
+{
+    return xNextTaskUnblockTime;
+}
+/*-----------------------------------------------------------*/
+
+/* The number of tasks in the ready list, the idle task included. */
+UBaseType_t uxSimGetReadyTaskCount( void )
+{
+    return listCURRENT_LIST_LENGTH( &( pxReadyTasksLists ) );
+}
+
+#endif /* FREERTOS_TASKS_C_ADDITIONS_H */
@@ -0,0 +1,337 @@
+/*
+ * FreeRTOS Kernel V10.4.6 - EDF scheduler simulator
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+/*
+ * Port of the kernel to a virtual clock on the host.  Each task is a
+ * ucontext coroutine whose context is held at the top of its stack, and the
+ * tick is not an interrupt: the clock only advances in ulSimConsume() and
+ * vSimIdle(), which process the ticks that fall within the time consumed.
+ * Ticks at which no delayed task unblocks are stepped over with
+ * vTaskStepTick() instead of being processed one by one, unless the
+ * configuration has kernel features that act on every tick.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ucontext.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "edf.h"
+#include "edf_sim.h"
+
+#if ( configUSE_TICKLESS_IDLE == 0 ) || ( INCLUDE_xTaskGetCurrentTaskHandle != 1 ) || ( INCLUDE_xTaskGetSchedulerState != 1 )
+    #error The simulator port requires configUSE_TICKLESS_IDLE, INCLUDE_xTaskGetCurrentTaskHandle and INCLUDE_xTaskGetSchedulerState
+#endif
+
+/* Only step over ticks if processing them would have no other effect than
+ * incrementing the tick count. */
+#if ( configUSE_TICK_HOOK == 0 ) && ( configUSE_TIME_SLICING == 0 ) &&                       \
+    ( configUSE_EDF_SERVERS == 0 ) && ( configUSE_EDF_SLACK_STEALING == 0 ) &&               \
+    ( configUSE_EDF_MIXED_CRITICALITY == 0 ) && ( configUSE_EDF_JOB_STATISTICS == 0 ) &&     \
+    ( configUSE_EDF_TRACE == 0 )
+    #define portSTEP_TICKS    1
+#else
+    #define portSTEP_TICKS    0
+#endif
+
+typedef struct xSIM_CONTEXT
+{
+    ucontext_t xContext;
+    TaskFunction_t pxCode;
+    void * pvParameters;
+} SimContext_t;
+
+static ucontext_t xSchedulerContext;                  /*< Context of the caller of vTaskStartScheduler(), resumed when the simulation ends. */
+static UBaseType_t uxCriticalNesting = 0;
+static BaseType_t xYieldHeld = pdFALSE;               /*< A yield was requested in a critical section. */
+static uint64_t ullNow = 0ULL;                        /*< Virtual time in counts. */
+static uint64_t ullNextTick = simCOUNTS_PER_TICK;     /*< Virtual time of the next tick, always after ullNow. */
+static uint64_t ullEndTime = UINT64_MAX;
+static uint64_t ullTicksProcessed = 0ULL;
+static uint64_t ullIdleYieldTime = UINT64_MAX;       /*< Time at which the idle task last let ready jobs run instead of idling. */
+
+/*-----------------------------------------------------------*/
+
+static SimContext_t * prvGetCurrentContext( void )
+{
+    /* pxTopOfStack, the first member of the TCB, points to the context. */
+    return *( ( SimContext_t ** ) xTaskGetCurrentTaskHandle() );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTaskEntry( void )
+{
+    SimContext_t * const pxContext = prvGetCurrentContext();
+
+    pxContext->pxCode( pxContext->pvParameters );
+
+    /* Tasks must not return. */
+    configASSERT( pdFALSE );
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvSwitchContext( void )
+{
+    SimContext_t * const pxFrom = prvGetCurrentContext();
+    SimContext_t * pxTo;
+
+    vTaskSwitchContext();
+    pxTo = prvGetCurrentContext();
+
+    if( pxTo == pxFrom )
+    {
+        return pdFALSE;
+    }
+
+    /* Returns when the task is switched back in. */
+    ( void ) swapcontext( &( pxFrom->xContext ), &( pxTo->xContext ) );
+
+    return pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvProcessTick( void )
+{
+    ullNow = ullNextTick;
+    ullNextTick += simCOUNTS_PER_TICK;
+    ullTicksProcessed++;
+
+    if( ullNow >= ullEndTime )
+    {
+        /* Does not return. */
+        vTaskEndScheduler();
+    }
+
+    if( xTaskIncrementTick() != pdFALSE )
+    {
+        return prvSwitchContext();
+    }
+
+    return pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvTicksBeforeEnd( void )
+{
+    /* The tick at the end time is always processed, as it ends the run. */
+    return ( ullEndTime > ullNextTick ) ? ( ( ullEndTime - ullNextTick ) / simCOUNTS_PER_TICK ) : 0ULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvStepTicks( uint64_t ullTicks )
+{
+    if( ullTicks > 0ULL )
+    {
+        vTaskStepTick( ( TickType_t ) ullTicks );
+        ullNextTick += ullTicks * simCOUNTS_PER_TICK;
+    }
+}
+/*-----------------------------------------------------------*/
+
+StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
+                                     StackType_t * pxEndOfStack,
+                                     TaskFunction_t pxCode,
+                                     void * pvParameters )
+{
+    SimContext_t * pxContext;
+
+    /* The context takes the top of the stack, and the coroutine the rest. */
+    pxContext = ( SimContext_t * ) ( ( ( uintptr_t ) ( pxTopOfStack + 1 ) - sizeof( SimContext_t ) ) & ~( uintptr_t ) portBYTE_ALIGNMENT_MASK );
+    configASSERT( ( uintptr_t ) pxContext > ( uintptr_t ) pxEndOfStack );
+
+    ( void ) getcontext( &( pxContext->xContext ) );
+    pxContext->xContext.uc_stack.ss_sp = pxEndOfStack;
+    pxContext->xContext.uc_stack.ss_size = ( size_t ) ( ( uint8_t * ) pxContext - ( uint8_t * ) pxEndOfStack );
+    pxContext->xContext.uc_link = NULL;
+    makecontext( &( pxContext->xContext ), prvTaskEntry, 0 );
+    pxContext->pxCode = pxCode;
+    pxContext->pvParameters = pvParameters;
+
+    return ( StackType_t * ) pxContext;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortStartScheduler( void )
+{
+    uxCriticalNesting = 0;
+
+    /* Returns when the simulation ends. */
+    ( void ) swapcontext( &xSchedulerContext, &( prvGetCurrentContext()->xContext ) );
+
+    return pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+    ( void ) setcontext( &xSchedulerContext );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+    if( uxCriticalNesting > ( UBaseType_t ) 0U )
+    {
+        xYieldHeld = pdTRUE;
+    }
+    else
+    {
+        ( void ) prvSwitchContext();
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+    uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+    configASSERT( uxCriticalNesting > ( UBaseType_t ) 0U );
+    uxCriticalNesting--;
+
+    if( ( uxCriticalNesting == ( UBaseType_t ) 0U ) && ( xYieldHeld != pdFALSE ) )
+    {
+        xYieldHeld = pdFALSE;
+        ( void ) prvSwitchContext();
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+{
+    uint64_t ullTicks = ( uint64_t ) xExpectedIdleTime - 1ULL;
+
+    /* Called by the idle task with the scheduler suspended.  Sleep until the
+     * tick at which the next task unblocks, which is pended until the idle
+     * task resumes the scheduler. */
+    if( ullTicks > prvTicksBeforeEnd() )
+    {
+        ullTicks = prvTicksBeforeEnd();
+    }
+
+    prvStepTicks( ullTicks );
+    ( void ) prvProcessTick();
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulSimConsume( uint64_t ullCounts )
+{
+    uint64_t ullTicks;
+    uint32_t ulSwitchedOut = 0UL;
+
+    configASSERT( uxCriticalNesting == ( UBaseType_t ) 0U );
+
+    while( ullCounts >= ( ullNextTick - ullNow ) )
+    {
+        ullCounts -= ullNextTick - ullNow;
+
+        #if ( portSTEP_TICKS == 1 )
+            {
+                /* The ticks before the one at which the next task unblocks
+                 * change nothing but the tick count, unless the scheduler is
+                 * suspended and they would be pended. */
+                ullTicks = 0ULL;
+
+                if( xTaskGetSchedulerState() == taskSCHEDULER_RUNNING )
+                {
+                    ullTicks = ( uint64_t ) ( TickType_t ) ( xSimGetNextTaskUnblockTime() - xTaskGetTickCount() );
+                    ullTicks = ( ullTicks > 0ULL ) ? ( ullTicks - 1ULL ) : 0ULL;
+
+                    if( ullTicks > ( ullCounts / simCOUNTS_PER_TICK ) + 1ULL )
+                    {
+                        ullTicks = ( ullCounts / simCOUNTS_PER_TICK ) + 1ULL;
+                    }
+
+                    if( ullTicks > prvTicksBeforeEnd() )
+                    {
+                        ullTicks = prvTicksBeforeEnd();
+                    }
+                }
+
+                if( ullTicks > 0ULL )
+                {
+                    /* The first stepped tick was reached above, the others
+                     * are consumed here. */
+                    ullCounts -= ( ullTicks - 1ULL ) * simCOUNTS_PER_TICK;
+                    prvStepTicks( ullTicks );
+                    ullNow = ullNextTick - simCOUNTS_PER_TICK;
+                    continue;
+                }
+            }
+        #else
+            ( void ) ullTicks;
+        #endif /* portSTEP_TICKS */
+
+        if( prvProcessTick() != pdFALSE )
+        {
+            ulSwitchedOut++;
+        }
+    }
+
+    ullNow += ullCounts;
+
+    return ulSwitchedOut;
+}
+/*-----------------------------------------------------------*/
+
+void vSimIdle( void )
+{
+    /* When jobs are ready the idle task only renews its deadline and yields,
+     * which takes no simulated time.  If it is selected again, its deadline
+     * is still the earliest, and the processor idles until the next tick as
+     * when no job is ready. */
+    if( ( uxSimGetReadyTaskCount() > ( UBaseType_t ) 1 ) && ( ullIdleYieldTime != ullNow ) )
+    {
+        ullIdleYieldTime = ullNow;
+    }
+    else
+    {
+        ( void ) ulSimConsume( ullNextTick - ullNow );
+    }
+}
+/*-----------------------------------------------------------*/
+
+uint64_t ullSimGetTime( void )
+{
+    return ullNow;
+}
+/*-----------------------------------------------------------*/
+
+void vSimSetEndTime( uint64_t ullTime )
+{
+    ullEndTime = ullTime;
+}
+/*-----------------------------------------------------------*/
+
+uint64_t ullSimGetTicksProcessed( void )
+{
+    return ullTicksProcessed;
+}